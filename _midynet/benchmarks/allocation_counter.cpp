@@ -0,0 +1,29 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.h"
+
+
+static std::atomic<size_t> allocationCount(0);
+
+static void* countedAllocation(size_t size){
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc((size == 0) ? 1 : size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t size) { return countedAllocation(size); }
+void* operator new[](size_t size) { return countedAllocation(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace FastMIDyNet{
+
+size_t getAllocationCount() { return allocationCount.load(std::memory_order_relaxed); }
+
+}
@@ -0,0 +1,32 @@
+#ifndef FAST_MIDYNET_BENCH_ALLOCATION_COUNTER_H
+#define FAST_MIDYNET_BENCH_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+
+
+namespace FastMIDyNet{
+
+/* Number of calls to the global `operator new` since the start of the program. The
+ * operator is replaced in allocation_counter.cpp, which is only linked in the benchmarks. */
+size_t getAllocationCount();
+
+/* Reports the average number of allocations per iteration of a benchmark, counted
+ * from its construction to its destruction. It must be constructed after the set up
+ * of the benchmark, right before the timing loop. */
+class AllocationCounter{
+    benchmark::State& m_state;
+    size_t m_initialCount;
+public:
+    AllocationCounter(benchmark::State& state): m_state(state), m_initialCount(getAllocationCount()) { }
+    ~AllocationCounter(){
+        m_state.counters["allocs/op"] = benchmark::Counter(
+            getAllocationCount() - m_initialCount, benchmark::Counter::kAvgIterations
+        );
+    }
+};
+
+}
+
+#endif
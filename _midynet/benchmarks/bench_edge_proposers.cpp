@@ -0,0 +1,87 @@
+#include "fixtures.hpp"
+#include "FastMIDyNet/proposer/edge/double_edge_swap.h"
+#include "FastMIDyNet/proposer/edge/hinge_flip.h"
+
+
+namespace FastMIDyNet{
+
+/* Proposal of a move and computation of its proposal ratio, without applying it. */
+template<typename Proposer>
+static void benchmarkEdgeProposer(benchmark::State& state, Proposer& proposer){
+    seed(42);
+    auto graph = getRandomMultiGraph(state.range(0), state.range(1));
+    proposer.setUp(graph);
+    AllocationCounter counter(state);
+    for (auto _: state){
+        auto move = proposer.proposeMove();
+        benchmark::DoNotOptimize(proposer.getLogProposalProbRatio(move));
+    }
+}
+
+static void BM_DoubleEdgeSwapProposer_proposeMove(benchmark::State& state){
+    DoubleEdgeSwapProposer proposer;
+    benchmarkEdgeProposer(state, proposer);
+}
+BENCHMARK(BM_DoubleEdgeSwapProposer_proposeMove)->Apply(applyGraphArgs);
+
+/* Proposal ratio alone, either of the last proposed move, whose swap descriptor is
+ * cached, or of older proposals, whose edges are looked up in the edge sampler. */
+static void benchmarkDoubleEdgeSwapRatio(benchmark::State& state, bool isCached){
+    seed(42);
+    auto graph = getRandomMultiGraph(state.range(0), state.range(1));
+    DoubleEdgeSwapProposer proposer;
+    proposer.setUp(graph);
+    std::vector<GraphMove> moves;
+    for (size_t i = 0; i < 1024; ++i)
+        moves.push_back(proposer.proposeMove());
+    // proposed last, hence the only cached move
+    GraphMove lastMove = proposer.proposeMove();
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state){
+        const GraphMove& move = isCached ? lastMove : moves[i++ % moves.size()];
+        benchmark::DoNotOptimize(proposer.getLogProposalProbRatio(move));
+    }
+}
+
+static void BM_DoubleEdgeSwapProposer_getLogProposalProbRatioWithCache(benchmark::State& state){
+    benchmarkDoubleEdgeSwapRatio(state, true);
+}
+BENCHMARK(BM_DoubleEdgeSwapProposer_getLogProposalProbRatioWithCache)->Apply(applyGraphArgs);
+
+static void BM_DoubleEdgeSwapProposer_getLogProposalProbRatioWithoutCache(benchmark::State& state){
+    benchmarkDoubleEdgeSwapRatio(state, false);
+}
+BENCHMARK(BM_DoubleEdgeSwapProposer_getLogProposalProbRatioWithoutCache)->Apply(applyGraphArgs);
+
+static void BM_HingeFlipUniformProposer_proposeMove(benchmark::State& state){
+    HingeFlipUniformProposer proposer;
+    benchmarkEdgeProposer(state, proposer);
+}
+BENCHMARK(BM_HingeFlipUniformProposer_proposeMove)->Apply(applyGraphArgs);
+
+static void BM_HingeFlipDegreeProposer_proposeMove(benchmark::State& state){
+    HingeFlipDegreeProposer proposer;
+    benchmarkEdgeProposer(state, proposer);
+}
+BENCHMARK(BM_HingeFlipDegreeProposer_proposeMove)->Apply(applyGraphArgs);
+
+/* Proposal and application of hinge flips, with the graph updated as in the MCMC. */
+static void BM_HingeFlipUniformProposer_applyGraphMove(benchmark::State& state){
+    seed(42);
+    auto graph = getRandomMultiGraph(state.range(0), state.range(1));
+    HingeFlipUniformProposer proposer;
+    proposer.setUp(graph);
+    AllocationCounter counter(state);
+    for (auto _: state){
+        auto move = proposer.proposeMove();
+        for (auto edge: move.removedEdges)
+            graph.removeEdgeIdx(edge.first, edge.second);
+        for (auto edge: move.addedEdges)
+            graph.addEdgeIdx(edge.first, edge.second);
+        proposer.applyGraphMove(move);
+    }
+}
+BENCHMARK(BM_HingeFlipUniformProposer_applyGraphMove)->Apply(applyGraphArgs);
+
+}
@@ -0,0 +1,39 @@
+#include "fixtures.hpp"
+#include "FastMIDyNet/proposer/label/mixed.hpp"
+#include "FastMIDyNet/proposer/label/uniform.hpp"
+
+
+namespace FastMIDyNet{
+
+template<typename Proposer>
+static void benchmarkLabelProposer(benchmark::State& state, Proposer& proposer){
+    seed(42);
+    BenchSBM graphPrior(state.range(0), state.range(1), state.range(2));
+    graphPrior.sample();
+    proposer.setUp(graphPrior);
+    AllocationCounter counter(state);
+    for (auto _: state){
+        auto move = proposer.proposeMove();
+        benchmark::DoNotOptimize(proposer.getLogProposalProbRatio(move));
+    }
+}
+
+static void BM_GibbsUniformLabelProposer_proposeMove(benchmark::State& state){
+    GibbsUniformLabelProposer<BlockIndex> proposer;
+    benchmarkLabelProposer(state, proposer);
+}
+BENCHMARK(BM_GibbsUniformLabelProposer_proposeMove)->Apply(applyBlockArgs);
+
+static void BM_GibbsMixedLabelProposer_proposeMove(benchmark::State& state){
+    GibbsMixedLabelProposer<BlockIndex> proposer;
+    benchmarkLabelProposer(state, proposer);
+}
+BENCHMARK(BM_GibbsMixedLabelProposer_proposeMove)->Apply(applyBlockArgs);
+
+static void BM_RestrictedMixedLabelProposer_proposeMove(benchmark::State& state){
+    RestrictedMixedLabelProposer<BlockIndex> proposer;
+    benchmarkLabelProposer(state, proposer);
+}
+BENCHMARK(BM_RestrictedMixedLabelProposer_proposeMove)->Apply(applyBlockArgs);
+
+}
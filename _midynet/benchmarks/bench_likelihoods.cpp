@@ -0,0 +1,43 @@
+#include "fixtures.hpp"
+
+
+namespace FastMIDyNet{
+
+static void BM_SISDynamics_getLogLikelihoodRatioFromGraphMove(benchmark::State& state){
+    seed(42);
+    BenchErdosRenyi graphPrior(state.range(0), state.range(1));
+    SISDynamics<RandomGraph> dynamics(graphPrior, state.range(2), 0.5);
+    dynamics.sample();
+    auto moves = getHingeFlipMoves(graphPrior.getGraph());
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(dynamics.getLogLikelihoodRatioFromGraphMove(moves[i++ % moves.size()]));
+}
+BENCHMARK(BM_SISDynamics_getLogLikelihoodRatioFromGraphMove)->Apply(applyDynamicsArgs);
+
+static void BM_StochasticBlockModelFamily_getLogLikelihoodRatioFromGraphMove(benchmark::State& state){
+    seed(42);
+    BenchSBM graphPrior(state.range(0), state.range(1), state.range(2));
+    graphPrior.sample();
+    auto moves = getHingeFlipMoves(graphPrior.getGraph());
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(graphPrior.getLogLikelihoodRatioFromGraphMove(moves[i++ % moves.size()]));
+}
+BENCHMARK(BM_StochasticBlockModelFamily_getLogLikelihoodRatioFromGraphMove)->Apply(applyBlockArgs);
+
+static void BM_StochasticBlockModelFamily_getLogLikelihoodRatioFromLabelMove(benchmark::State& state){
+    seed(42);
+    BenchSBM graphPrior(state.range(0), state.range(1), state.range(2));
+    graphPrior.sample();
+    auto moves = getRandomLabelMoves(graphPrior.getLabels(), state.range(2));
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(graphPrior.getLogLikelihoodRatioFromLabelMove(moves[i++ % moves.size()]));
+}
+BENCHMARK(BM_StochasticBlockModelFamily_getLogLikelihoodRatioFromLabelMove)->Apply(applyBlockArgs);
+
+}
@@ -0,0 +1,132 @@
+#include "fixtures.hpp"
+#include "FastMIDyNet/proposer/label/mixed.hpp"
+#include "FastMIDyNet/mcmc/reconstruction.hpp"
+#include "FastMIDyNet/mcmc/information.hpp"
+#include "FastMIDyNet/clone.hpp"
+#include "FastMIDyNet/utility/partition_distance.h"
+
+
+namespace FastMIDyNet{
+
+/* Number of Metropolis-Hastings steps in a sweep, reported as moves per second. */
+static const size_t BENCH_SWEEP_SIZE = 1000;
+
+static void BM_GraphReconstructionMCMC_doMHSweep(benchmark::State& state){
+    seed(42);
+    BenchErdosRenyi graphPrior(state.range(0), state.range(1));
+    SISDynamics<RandomGraph> dynamics(graphPrior, state.range(2), 0.5);
+    HingeFlipUniformProposer edgeProposer;
+    GraphReconstructionMCMC<RandomGraph> mcmc(dynamics, edgeProposer);
+    dynamics.sample();
+    mcmc.setUp();
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(mcmc.doMHSweep(BENCH_SWEEP_SIZE));
+    state.counters["moves/s"] = benchmark::Counter(state.iterations() * BENCH_SWEEP_SIZE, benchmark::Counter::kIsRate);
+    mcmc.tearDown();
+}
+BENCHMARK(BM_GraphReconstructionMCMC_doMHSweep)->Apply(applyDynamicsArgs)->Unit(benchmark::kMillisecond);
+
+static void BM_VertexLabeledGraphReconstructionMCMC_doMHSweep(benchmark::State& state){
+    seed(42);
+    BenchSBM graphPrior(state.range(0), state.range(1), state.range(2));
+    SISDynamics<VertexLabeledRandomGraph<BlockIndex>> dynamics(graphPrior, 10, 0.5);
+    HingeFlipUniformProposer edgeProposer;
+    GibbsMixedLabelProposer<BlockIndex> labelProposer;
+    VertexLabeledGraphReconstructionMCMC<BlockIndex> mcmc(dynamics, edgeProposer, labelProposer);
+    dynamics.sample();
+    mcmc.setUp();
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(mcmc.doMHSweep(BENCH_SWEEP_SIZE));
+    state.counters["moves/s"] = benchmark::Counter(state.iterations() * BENCH_SWEEP_SIZE, benchmark::Counter::kIsRate);
+    mcmc.tearDown();
+}
+BENCHMARK(BM_VertexLabeledGraphReconstructionMCMC_doMHSweep)->Apply(applyBlockArgs)->Unit(benchmark::kMillisecond);
+
+/* One mutual information sample per model and per iteration, with a short chain. */
+static void BM_InformationEstimator_compute(benchmark::State& state){
+    struct Model{
+        BenchErdosRenyi graphPrior;
+        SISDynamics<RandomGraph> dynamics;
+        HingeFlipUniformProposer edgeProposer;
+        GraphReconstructionMCMC<RandomGraph> mcmc;
+        Model(size_t size, size_t edgeCount):
+            graphPrior(size, edgeCount), dynamics(graphPrior, 10, 0.5), mcmc(dynamics, edgeProposer) { }
+    };
+    size_t modelCount = state.range(2);
+    std::vector<std::unique_ptr<Model>> models;
+    std::vector<GraphReconstructionMCMC<RandomGraph>*> mcmcs;
+    for (size_t i = 0; i < modelCount; ++i){
+        models.push_back(std::unique_ptr<Model>(new Model(state.range(0), state.range(1))));
+        mcmcs.push_back(&models.back()->mcmc);
+    }
+    InformationEstimator<RandomGraph> estimator(mcmcs, "meanfield", 10, 1, 100);
+    size_t iteration = 0;
+    for (auto _: state)
+        benchmark::DoNotOptimize(estimator.compute(modelCount, modelCount * iteration++));
+    state.counters["samples/s"] = benchmark::Counter(state.iterations() * modelCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_InformationEstimator_compute)->Args({100, 250, 1})->Args({100, 250, 4})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/* Replication of a set up model into independent chains sharing its time series. */
+static void BM_CloneMap_getMCMC(benchmark::State& state){
+    seed(42);
+    EdgeCountDeltaPrior edgeCountPrior(state.range(1));
+    ErdosRenyiFamily graphPrior(state.range(0), edgeCountPrior);
+    SISDynamics<RandomGraph> dynamics(graphPrior, state.range(2), 0.5);
+    HingeFlipUniformProposer edgeProposer;
+    GraphReconstructionMCMC<RandomGraph> mcmc(dynamics, edgeProposer);
+    dynamics.sample();
+    mcmc.setUp();
+    const size_t chainCount = 64;
+    for (auto _: state){
+        std::vector<std::unique_ptr<CloneMap>> cloneMaps;
+        for (size_t i = 0; i < chainCount; ++i){
+            cloneMaps.emplace_back(new CloneMap());
+            benchmark::DoNotOptimize(&cloneMaps.back()->get(mcmc));
+        }
+    }
+    state.counters["chains/s"] = benchmark::Counter(state.iterations() * chainCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CloneMap_getMCMC)->Args({100, 250, 100})->Args({1000, 2500, 100})->Unit(benchmark::kMillisecond);
+
+
+/* Short sweeps of 10 steps, with or without collecting the edge marginals at their end. */
+static void BM_CollectEdgeMultiplicityOnSweep_doMHSweep(benchmark::State& state){
+    seed(42);
+    EdgeCountDeltaPrior edgeCountPrior(state.range(1));
+    ErdosRenyiFamily graphPrior(state.range(0), edgeCountPrior);
+    SISDynamics<RandomGraph> dynamics(graphPrior, 10, 0.5);
+    HingeFlipUniformProposer edgeProposer;
+    GraphReconstructionMCMC<RandomGraph> mcmc(dynamics, edgeProposer);
+    CollectEdgeMultiplicityOnSweep<GraphReconstructionMCMC<RandomGraph>> collector;
+    dynamics.sample();
+    if (state.range(2))
+        mcmc.insertCallBack("collector", collector);
+    mcmc.setUp();
+    for (auto _: state)
+        mcmc.doMHSweep(10);
+    state.counters["sweeps/s"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CollectEdgeMultiplicityOnSweep_doMHSweep)->Args({1000, 2500, 0})->Args({1000, 2500, 1})->Args({10000, 25000, 1});
+
+
+/* Pairwise variation of information between random partitions of N vertices in B blocks. */
+static void BM_getPartitionDistanceMatrix(benchmark::State& state){
+    seed(42);
+    const size_t partitionCount = state.range(0), size = state.range(1), blockCount = state.range(2);
+    std::uniform_int_distribution<BlockIndex> labelDistribution(0, blockCount - 1);
+    std::vector<BlockSequence> partitions(partitionCount, BlockSequence(size));
+    for (auto& partition: partitions)
+        for (auto& label: partition)
+            label = labelDistribution(rng);
+    for (auto _: state)
+        benchmark::DoNotOptimize(getPartitionDistanceMatrix(partitions, "vi"));
+    state.counters["pairs/s"] = benchmark::Counter(
+        state.iterations() * partitionCount * (partitionCount - 1) / 2, benchmark::Counter::kIsRate
+    );
+}
+BENCHMARK(BM_getPartitionDistanceMatrix)->Args({200, 1000, 10})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}
@@ -0,0 +1,77 @@
+#include "fixtures.hpp"
+#include "FastMIDyNet/proposer/sampler/edge_sampler.h"
+#include "FastMIDyNet/proposer/sampler/vertex_sampler.h"
+
+
+namespace FastMIDyNet{
+
+static void setUpSampler(EdgeSampler& sampler, const MultiGraph& graph){
+    for (auto vertex: graph)
+        for (auto neighbor: graph.getNeighboursOfIdx(vertex))
+            if (vertex <= neighbor.vertexIndex)
+                sampler.onEdgeInsertion({vertex, neighbor.vertexIndex}, neighbor.label);
+}
+
+static void setUpSampler(VertexDegreeSampler& sampler, const MultiGraph& graph){
+    for (auto vertex: graph)
+        sampler.onVertexInsertion(vertex);
+    for (auto vertex: graph)
+        for (auto neighbor: graph.getNeighboursOfIdx(vertex))
+            if (vertex <= neighbor.vertexIndex)
+                sampler.onEdgeInsertion({vertex, neighbor.vertexIndex}, neighbor.label);
+}
+
+static void BM_EdgeSampler_sample(benchmark::State& state){
+    seed(42);
+    EdgeSampler sampler;
+    setUpSampler(sampler, getRandomMultiGraph(state.range(0), state.range(1)));
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(sampler.sample());
+}
+BENCHMARK(BM_EdgeSampler_sample)->Apply(applyGraphArgs);
+
+/* An addition followed by the removal of the same edge, which leaves the sampler unchanged. */
+static void BM_EdgeSampler_addAndRemoveEdge(benchmark::State& state){
+    seed(42);
+    EdgeSampler sampler;
+    auto graph = getRandomMultiGraph(state.range(0), state.range(1));
+    setUpSampler(sampler, graph);
+    auto moves = getHingeFlipMoves(graph);
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state){
+        auto edge = getOrderedEdge(moves[i++ % moves.size()].addedEdges[0]);
+        sampler.onEdgeAddition(edge);
+        sampler.onEdgeRemoval(edge);
+    }
+}
+BENCHMARK(BM_EdgeSampler_addAndRemoveEdge)->Apply(applyGraphArgs);
+
+static void BM_VertexDegreeSampler_sample(benchmark::State& state){
+    seed(42);
+    VertexDegreeSampler sampler;
+    setUpSampler(sampler, getRandomMultiGraph(state.range(0), state.range(1)));
+    AllocationCounter counter(state);
+    for (auto _: state)
+        benchmark::DoNotOptimize(sampler.sample());
+}
+BENCHMARK(BM_VertexDegreeSampler_sample)->Apply(applyGraphArgs);
+
+static void BM_VertexDegreeSampler_addAndRemoveEdge(benchmark::State& state){
+    seed(42);
+    VertexDegreeSampler sampler;
+    auto graph = getRandomMultiGraph(state.range(0), state.range(1));
+    setUpSampler(sampler, graph);
+    auto moves = getHingeFlipMoves(graph);
+    size_t i = 0;
+    AllocationCounter counter(state);
+    for (auto _: state){
+        auto edge = getOrderedEdge(moves[i++ % moves.size()].addedEdges[0]);
+        sampler.onEdgeAddition(edge);
+        sampler.onEdgeRemoval(edge);
+    }
+}
+BENCHMARK(BM_VertexDegreeSampler_addAndRemoveEdge)->Apply(applyGraphArgs);
+
+}
@@ -0,0 +1,120 @@
+#ifndef FAST_MIDYNET_BENCH_FIXTURES_HPP
+#define FAST_MIDYNET_BENCH_FIXTURES_HPP
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "FastMIDyNet/prior/sbm/block_count.h"
+#include "FastMIDyNet/prior/sbm/block.h"
+#include "FastMIDyNet/prior/sbm/edge_count.h"
+#include "FastMIDyNet/prior/sbm/edge_matrix.h"
+#include "FastMIDyNet/random_graph/erdosrenyi.h"
+#include "FastMIDyNet/random_graph/sbm.h"
+#include "FastMIDyNet/dynamics/sis.hpp"
+#include "FastMIDyNet/proposer/edge/hinge_flip.h"
+#include "FastMIDyNet/rng.h"
+#include "allocation_counter.h"
+
+
+namespace FastMIDyNet{
+
+/* Sizes over which the benchmarks are parametrized: N vertices, E edges, B blocks
+ * and T time steps. */
+static const std::vector<int64_t> BENCH_SIZES = {100, 1000, 10000};
+static const std::vector<int64_t> BENCH_AVERAGE_DEGREES = {4, 16};
+static const std::vector<int64_t> BENCH_BLOCK_COUNTS = {5, 50};
+static const std::vector<int64_t> BENCH_STEP_COUNTS = {10, 100};
+
+/* Number of moves drawn before the timing loop and cycled over by the ratio kernels. */
+static const size_t BENCH_MOVE_COUNT = 1024;
+
+/* Arguments (N, E), (N, E, B) and (N, E, T) of the benchmarks, where the edge count
+ * is set from the average degree. */
+inline void applyGraphArgs(benchmark::internal::Benchmark* benchmark){
+    benchmark->ArgNames({"N", "E"});
+    for (auto size: BENCH_SIZES)
+        for (auto degree: BENCH_AVERAGE_DEGREES)
+            benchmark->Args({size, size * degree / 2});
+}
+
+inline void applyBlockArgs(benchmark::internal::Benchmark* benchmark){
+    benchmark->ArgNames({"N", "E", "B"});
+    for (auto size: BENCH_SIZES)
+        for (auto degree: BENCH_AVERAGE_DEGREES)
+            for (auto blockCount: BENCH_BLOCK_COUNTS)
+                benchmark->Args({size, size * degree / 2, blockCount});
+}
+
+inline void applyDynamicsArgs(benchmark::internal::Benchmark* benchmark){
+    benchmark->ArgNames({"N", "E", "T"});
+    for (auto size: BENCH_SIZES)
+        for (auto degree: BENCH_AVERAGE_DEGREES)
+            for (auto stepCount: BENCH_STEP_COUNTS)
+                benchmark->Args({size, size * degree / 2, stepCount});
+}
+
+inline MultiGraph getRandomMultiGraph(size_t size, size_t edgeCount){
+    MultiGraph graph(size);
+    std::uniform_int_distribution<BaseGraph::VertexIndex> vertexDistribution(0, size - 1);
+    for (size_t i = 0; i < edgeCount; ++i)
+        graph.addEdgeIdx(vertexDistribution(rng), vertexDistribution(rng));
+    return graph;
+}
+
+class BenchErdosRenyi: public ErdosRenyiFamily{
+    EdgeCountDeltaPrior m_edgeCountPrior;
+public:
+    BenchErdosRenyi(size_t size, size_t edgeCount):
+        ErdosRenyiFamily(size), m_edgeCountPrior(edgeCount) { setEdgeCountPrior(m_edgeCountPrior); }
+};
+
+class BenchSBM: public StochasticBlockModelFamily{
+    BlockCountDeltaPrior m_blockCountPrior;
+    BlockUniformPrior m_blockPrior;
+    EdgeCountDeltaPrior m_edgeCountPrior;
+    EdgeMatrixUniformPrior m_edgeMatrixPrior;
+public:
+    BenchSBM(size_t size, size_t edgeCount, size_t blockCount):
+        StochasticBlockModelFamily(size),
+        m_blockCountPrior(blockCount),
+        m_blockPrior(size, m_blockCountPrior),
+        m_edgeCountPrior(edgeCount),
+        m_edgeMatrixPrior(m_edgeCountPrior, m_blockPrior) {
+        setBlockPrior(m_blockPrior);
+        setEdgeMatrixPrior(m_edgeMatrixPrior);
+    }
+};
+
+/* Graph moves proposed by a uniform hinge flip proposer, without being applied. */
+inline std::vector<GraphMove> getHingeFlipMoves(const MultiGraph& graph, size_t moveCount=BENCH_MOVE_COUNT){
+    HingeFlipUniformProposer proposer;
+    proposer.setUp(graph);
+    std::vector<GraphMove> moves;
+    while (moves.size() < moveCount){
+        auto move = proposer.proposeMove();
+        if (move.removedEdges != move.addedEdges)
+            moves.push_back(move);
+    }
+    return moves;
+}
+
+/* Label moves of uniform vertices to uniform other labels, without being applied. */
+inline std::vector<BlockMove> getRandomLabelMoves(const std::vector<BlockIndex>& labels, size_t labelCount, size_t moveCount=BENCH_MOVE_COUNT){
+    std::uniform_int_distribution<BaseGraph::VertexIndex> vertexDistribution(0, labels.size() - 1);
+    std::uniform_int_distribution<BlockIndex> labelDistribution(0, labelCount - 2);
+    std::vector<BlockMove> moves;
+    for (size_t i = 0; i < moveCount; ++i){
+        BaseGraph::VertexIndex vertex = vertexDistribution(rng);
+        BlockIndex nextLabel = labelDistribution(rng);
+        if (nextLabel >= labels[vertex])
+            ++nextLabel;
+        moves.push_back({vertex, labels[vertex], nextLabel});
+    }
+    return moves;
+}
+
+}
+
+#endif
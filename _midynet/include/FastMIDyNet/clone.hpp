@@ -0,0 +1,88 @@
+#ifndef FAST_MIDYNET_CLONE_HPP
+#define FAST_MIDYNET_CLONE_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "FastMIDyNet/rv.hpp"
+
+
+namespace FastMIDyNet{
+
+/* Deep copy of an object graph of random variables, e.g. a reconstruction MCMC with its
+ * dynamics, random graph, priors and proposers. `get` clones an object the first time it
+ * is reached and returns the same clone afterwards, so that an object shared by several
+ * others (e.g. the block prior of the edge matrix and degree priors) is cloned once and
+ * the clones are wired to each other like the originals. The clones are owned by the map.
+ *
+ * With `shareData`, the immutable data of the originals (the time series of the dynamics)
+ * is shared with the clones, and only copied by the one that replaces it. */
+class CloneMap{
+private:
+    const bool m_shareData;
+    std::unordered_map<const void*, NestedRandomVariable*> m_clones;
+    std::unordered_map<const void*, const NestedRandomVariable*> m_originals;
+    std::vector<std::unique_ptr<NestedRandomVariable>> m_ownedClones;
+
+    static const void* getKey(const NestedRandomVariable& object) { return dynamic_cast<const void*>(&object); }
+public:
+    explicit CloneMap(bool shareData=true): m_shareData(shareData) { }
+    CloneMap(const CloneMap&) = delete;
+    CloneMap& operator=(const CloneMap&) = delete;
+
+    template<typename T>
+    T& get(const T& original){
+        auto it = m_clones.find(getKey(original));
+        if (it != m_clones.end())
+            return dynamic_cast<T&>(*it->second);
+        /* already a clone, e.g. a member of a clone to which its copy constructor points */
+        if (m_originals.count(getKey(original)) != 0)
+            return const_cast<T&>(original);
+
+        std::unique_ptr<NestedRandomVariable> clone(original.clone());
+        if (typeid(*clone) != typeid(original))
+            throw std::logic_error("CloneMap: cloning is not implemented for `"
+                + std::string(typeid(original).name()) + "`.");
+        NestedRandomVariable& cloneRef = *clone;
+        cloneRef.isRoot(original.isRoot());
+        m_clones[getKey(original)] = clone.get();
+        m_originals[getKey(cloneRef)] = &original;
+        m_ownedClones.push_back(std::move(clone));
+        cloneRef.remapDependencies(*this);
+        return dynamic_cast<T&>(cloneRef);
+    }
+    /* Redirects `ptr` to the clone of the object it points to. */
+    template<typename T>
+    void remap(T*& ptr){
+        if (ptr != nullptr)
+            ptr = &get(*ptr);
+    }
+    /* Declares `clone` as the clone of `original`, e.g. for the objects owned by value by a
+     * clone, so that the pointers to the members of the original are redirected to the
+     * members of the clone. It must precede any `get` of `original`. */
+    void insert(const NestedRandomVariable& original, NestedRandomVariable& clone){
+        auto it = m_clones.find(getKey(original));
+        if (it != m_clones.end() and it->second != &clone)
+            throw std::logic_error("CloneMap: `" + std::string(typeid(original).name())
+                + "` has already been cloned.");
+        m_clones[getKey(original)] = &clone;
+        m_originals[getKey(clone)] = &original;
+    }
+    /* Object of which `clone` is the clone. */
+    template<typename T>
+    const T& getOriginal(const T& clone) const {
+        return dynamic_cast<const T&>(*m_originals.at(getKey(clone)));
+    }
+
+    bool contains(const NestedRandomVariable& original) const { return m_clones.count(getKey(original)) != 0; }
+    const size_t size() const { return m_ownedClones.size(); }
+    const bool sharesData() const { return m_shareData; }
+};
+
+}
+
+#endif
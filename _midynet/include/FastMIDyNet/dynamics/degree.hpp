@@ -19,6 +19,8 @@ class DegreeDynamics: public BinaryDynamics<GraphPriorType> {
         DegreeDynamics(GraphPriorType& graphPrior, size_t numSteps, double C):
                 BaseClass(graphPrior, numSteps, 0, 0, false, -1), m_C(C) { }
 
+        DegreeDynamics* clone() const override { return new DegreeDynamics(*this); }
+
         const double getActivationProb(const VertexNeighborhoodState& vertexNeighborState) const override {
             return (vertexNeighborState[0] + vertexNeighborState[1]) / m_C;
         }
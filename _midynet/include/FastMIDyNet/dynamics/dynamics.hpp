@@ -4,7 +4,11 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <iostream>
+#include <algorithm>
+#include <string>
+#include <stdexcept>
 
 #include "BaseGraph/types.h"
 
@@ -14,6 +18,7 @@
 #include "FastMIDyNet/random_graph/random_graph.hpp"
 #include "FastMIDyNet/dynamics/types.h"
 #include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/parallel.hpp"
 #include "FastMIDyNet/rng.h"
 #include "FastMIDyNet/generators.h"
 
@@ -28,10 +33,19 @@ protected:
     State m_state;
     std::vector<State> m_neighborsState;
     const bool m_normalizeCoupling;
-    StateSequence m_pastStateSequence;
-    StateSequence m_futureStateSequence;
+    /* The time series are shared with the clones of the dynamics, and replaced rather
+     * than modified in place, so that a clone never sees the series of another change. */
+    std::shared_ptr<const StateSequence> m_pastStateSequence = std::make_shared<StateSequence>();
+    std::shared_ptr<const StateSequence> m_futureStateSequence = std::make_shared<StateSequence>();
+    /* Contiguous row-major copies of the time series, made on demand once per series
+     * and shared with read-only views (e.g. NumPy arrays) that may outlive the dynamics. */
+    mutable std::shared_ptr<const std::vector<VertexState>> m_pastStateArray, m_futureStateArray;
     GraphPriorType* m_graphPriorPtr = nullptr;
     NeighborsStateSequence m_neighborsPastStateSequence;
+    /* Edge count normalizing the coupling in place of the one of the graph prior, while
+     * the likelihood of other graphs is evaluated. */
+    size_t m_couplingEdgeCount = 0;
+    bool m_hasCouplingEdgeCount = false;
 
     void updateNeighborsStateInPlace(
         BaseGraph::VertexIndex vertexIdx,
@@ -46,6 +60,8 @@ protected:
         std::map<BaseGraph::VertexIndex, VertexNeighborhoodStateSequence>&
     ) const ;
 
+    const double computeLogLikelihood(const MultiGraph& graph, std::vector<VertexNeighborhoodState>& neighborhoodStates) const;
+
     void checkConsistencyOfNeighborsState() const ;
     void checkConsistencyOfNeighborsPastStateSequence() const ;
 public:
@@ -62,10 +78,29 @@ public:
 
     const State& getCurrentState() const { return m_state; }
     const NeighborsState& getCurrentNeighborsState() const { return m_neighborsState; }
-    const StateSequence& getPastStates() const { return m_pastStateSequence; }
-    const StateSequence& getFutureStates() const { return m_futureStateSequence; }
+    const StateSequence& getPastStates() const { return *m_pastStateSequence; }
+    const StateSequence& getFutureStates() const { return *m_futureStateSequence; }
+    std::shared_ptr<const std::vector<VertexState>> getPastStateArray() const {
+        if (not m_pastStateArray)
+            m_pastStateArray = getStateArray(*m_pastStateSequence);
+        return m_pastStateArray;
+    }
+    std::shared_ptr<const std::vector<VertexState>> getFutureStateArray() const {
+        if (not m_futureStateArray)
+            m_futureStateArray = getStateArray(*m_futureStateSequence);
+        return m_futureStateArray;
+    }
+    static std::shared_ptr<const std::vector<VertexState>> getStateArray(const StateSequence& stateSequence){
+        auto stateArray = std::make_shared<std::vector<VertexState>>();
+        for (const auto& vertexStates : stateSequence)
+            stateArray->insert(stateArray->end(), vertexStates.begin(), vertexStates.end());
+        return stateArray;
+    }
     const NeighborsStateSequence& getNeighborsPastStates() const { return m_neighborsPastStateSequence; }
     const bool normalizeCoupling() const { return m_normalizeCoupling; }
+    const size_t getCouplingEdgeCount() const {
+        return m_hasCouplingEdgeCount ? m_couplingEdgeCount : m_graphPriorPtr->getEdgeCount();
+    }
     void setState(State& state) {
         m_state = state;
         m_neighborsState = computeNeighborsState(m_state);
@@ -73,6 +108,7 @@ public:
         checkConsistency();
         #endif
     }
+    void setStateSequences(const StateSequence& pastStates, const StateSequence& futureStates);
     const MultiGraph& getGraph() const { return m_graphPriorPtr->getGraph(); }
     void setGraph(const MultiGraph& graph) ;
 
@@ -82,6 +118,13 @@ public:
         m_graphPriorPtr = &randomGraph;
         m_graphPriorPtr->isRoot(false);
     }
+    void remapDependencies(CloneMap& cloneMap) override {
+        cloneMap.remap(m_graphPriorPtr);
+        if (not cloneMap.sharesData()){
+            m_pastStateSequence = std::make_shared<StateSequence>(*m_pastStateSequence);
+            m_futureStateSequence = std::make_shared<StateSequence>(*m_futureStateSequence);
+        }
+    }
 
     const size_t getSize() const { return m_graphPriorPtr->getSize(); }
     const size_t getNumStates() const { return m_numStates; }
@@ -110,6 +153,7 @@ public:
     void asyncUpdateState(size_t num_updates);
 
     const double getLogLikelihood() const;
+    const std::vector<double> getLogLikelihoods(const std::vector<MultiGraph>& graphs, size_t numThreads=0);
     const double getLogPrior() const {
         return NestedRandomVariable::processRecursiveFunction<double>([&](){
             return m_graphPriorPtr->getLogJoint();
@@ -153,8 +197,8 @@ public:
 
     bool isSafe() const override {
         return (m_graphPriorPtr != nullptr) and (m_graphPriorPtr->isSafe())
-           and (m_state.size() != 0) and (m_pastStateSequence.size() != 0)
-           and (m_futureStateSequence.size() != 0) and (m_neighborsPastStateSequence.size() != 0);
+           and (m_state.size() != 0) and (m_pastStateSequence->size() != 0)
+           and (m_futureStateSequence->size() != 0) and (m_neighborsPastStateSequence.size() != 0);
     }
 };
 
@@ -179,22 +223,23 @@ void Dynamics<GraphPriorType>::sampleState(const State& x0, bool async){
     }
 
 
-    m_pastStateSequence.clear();
-    m_pastStateSequence.resize(getSize());
-    m_futureStateSequence.clear();
-    m_futureStateSequence.resize(getSize());
+    StateSequence pastStateSequence(getSize());
+    StateSequence futureStateSequence(getSize());
     m_neighborsPastStateSequence.clear();
     m_neighborsPastStateSequence.resize(getSize());
     for (const auto& idx : getGraph()){
-        m_pastStateSequence[idx].resize(m_numSteps);
-        m_futureStateSequence[idx].resize(m_numSteps);
+        pastStateSequence[idx].resize(m_numSteps);
+        futureStateSequence[idx].resize(m_numSteps);
         m_neighborsPastStateSequence[idx].resize(m_numSteps);
         for (size_t t = 0; t < m_numSteps; t++){
-            m_pastStateSequence[idx][t] = reversedPastState[t][idx];
-            m_futureStateSequence[idx][t] = reversedFutureState[t][idx];
+            pastStateSequence[idx][t] = reversedPastState[t][idx];
+            futureStateSequence[idx][t] = reversedFutureState[t][idx];
             m_neighborsPastStateSequence[idx][t] = reversedNeighborsPastState[t][idx];
         }
     }
+    m_pastStateSequence = std::make_shared<StateSequence>(std::move(pastStateSequence));
+    m_futureStateSequence = std::make_shared<StateSequence>(std::move(futureStateSequence));
+    m_pastStateArray = m_futureStateArray = nullptr;
 
     #if DEBUG
     checkConsistency();
@@ -202,13 +247,48 @@ void Dynamics<GraphPriorType>::sampleState(const State& x0, bool async){
 
 }
 
+/* Sets observed time series in place of sampled ones. The sequences have one row of
+ * T states per vertex, the future states being the states following the past ones.
+ * The number of steps becomes T and the current state the last future state. */
+template<typename GraphPriorType>
+void Dynamics<GraphPriorType>::setStateSequences(const StateSequence& pastStates, const StateSequence& futureStates){
+    if (pastStates.size() != getSize() or futureStates.size() != getSize())
+        throw std::logic_error("Dynamics: state sequences must have one row per vertex, "
+            + std::to_string(getSize()) + " expected.");
+    size_t numSteps = (getSize() == 0) ? 0 : pastStates[0].size();
+    for (BaseGraph::VertexIndex idx = 0; idx < getSize(); ++idx){
+        if (pastStates[idx].size() != numSteps or futureStates[idx].size() != numSteps)
+            throw std::logic_error("Dynamics: state sequence of vertex " + std::to_string(idx)
+                + " does not have " + std::to_string(numSteps) + " steps.");
+        for (size_t t = 0; t < numSteps; ++t)
+            if (pastStates[idx][t] >= m_numStates or futureStates[idx][t] >= m_numStates)
+                throw std::logic_error("Dynamics: state of vertex " + std::to_string(idx)
+                    + " at step " + std::to_string(t) + " is not smaller than "
+                    + std::to_string(m_numStates) + ".");
+    }
+
+    m_numSteps = numSteps;
+    m_pastStateSequence = std::make_shared<StateSequence>(pastStates);
+    m_futureStateSequence = std::make_shared<StateSequence>(futureStates);
+    m_pastStateArray = m_futureStateArray = nullptr;
+    m_state.resize(getSize());
+    for (BaseGraph::VertexIndex idx = 0; idx < getSize(); ++idx)
+        m_state[idx] = (numSteps == 0) ? 0 : futureStates[idx][numSteps - 1];
+    m_neighborsState = computeNeighborsState(m_state);
+    m_neighborsPastStateSequence = computeNeighborsStateSequence(*m_pastStateSequence);
+
+    #if DEBUG
+    checkConsistency();
+    #endif
+}
+
 template<typename GraphPriorType>
 void Dynamics<GraphPriorType>::setGraph(const MultiGraph& graph) {
     m_graphPriorPtr->setGraph(graph);
-    if (m_pastStateSequence.size() == 0)
+    if (m_pastStateSequence->size() == 0)
         return;
     m_neighborsState = computeNeighborsState(m_state);
-    m_neighborsPastStateSequence = computeNeighborsStateSequence(m_pastStateSequence);
+    m_neighborsPastStateSequence = computeNeighborsStateSequence(*m_pastStateSequence);
 
     #if DEBUG
     checkConsistency();
@@ -309,8 +389,8 @@ const double Dynamics<GraphPriorType>::getLogLikelihood() const {
     for (size_t t = 0; t < m_numSteps; t++){
         for (auto idx: getGraph()){
             logLikelihood += log(getTransitionProb(
-                m_pastStateSequence[idx][t],
-                m_futureStateSequence[idx][t],
+                (*m_pastStateSequence)[idx][t],
+                (*m_futureStateSequence)[idx][t],
                 m_neighborsPastStateSequence[idx][t]
             ));
         }
@@ -318,6 +398,67 @@ const double Dynamics<GraphPriorType>::getLogLikelihood() const {
     return logLikelihood;
 };
 
+template<typename GraphPriorType>
+const double Dynamics<GraphPriorType>::computeLogLikelihood(
+    const MultiGraph& graph,
+    std::vector<VertexNeighborhoodState>& neighborhoodStates
+) const {
+    double logLikelihood = 0;
+    for (auto idx: graph){
+        for (auto& neighborhoodState: neighborhoodStates)
+            std::fill(neighborhoodState.begin(), neighborhoodState.end(), 0);
+        for (const auto& neighbor: graph.getNeighboursOfIdx(idx)){
+            const auto& neighborStates = (*m_pastStateSequence)[neighbor.vertexIndex];
+            for (size_t t = 0; t < m_numSteps; t++)
+                neighborhoodStates[t][neighborStates[t]] += neighbor.label;
+        }
+        for (size_t t = 0; t < m_numSteps; t++)
+            logLikelihood += log(getTransitionProb(
+                (*m_pastStateSequence)[idx][t],
+                (*m_futureStateSequence)[idx][t],
+                neighborhoodStates[t]
+            ));
+    }
+    return logLikelihood;
+};
+
+/* Log-likelihoods of the observed states for each graph, evaluated in parallel
+ * without touching the current graph. When the coupling is normalized, it is
+ * normalized by the edge count of each graph, the graphs being evaluated in batches
+ * of equal edge count. */
+template<typename GraphPriorType>
+const std::vector<double> Dynamics<GraphPriorType>::getLogLikelihoods(const std::vector<MultiGraph>& graphs, size_t numThreads) {
+    for (const auto& graph: graphs)
+        if (graph.getSize() != getSize())
+            throw std::logic_error("Dynamics: cannot evaluate the likelihood of a graph of size "
+                                   + std::to_string(graph.getSize()) + " with states of size "
+                                   + std::to_string(getSize()) + ".");
+
+    std::map<size_t, std::vector<size_t>> batches;
+    for (size_t i = 0; i < graphs.size(); ++i)
+        batches[m_normalizeCoupling ? graphs[i].getTotalEdgeNumber() : 0].push_back(i);
+
+    std::vector<double> logLikelihoods(graphs.size());
+    try {
+        for (const auto& batch: batches){
+            const auto& indices = batch.second;
+            m_couplingEdgeCount = batch.first;
+            m_hasCouplingEdgeCount = m_normalizeCoupling;
+            parallelFor(indices.size(), numThreads, [&](size_t begin, size_t end){
+                std::vector<VertexNeighborhoodState> neighborhoodStates(m_numSteps, VertexNeighborhoodState(m_numStates));
+                for (size_t i = begin; i < end; ++i)
+                    logLikelihoods[indices[i]] = computeLogLikelihood(graphs[indices[i]], neighborhoodStates);
+            });
+        }
+    }
+    catch (...) {
+        m_hasCouplingEdgeCount = false;
+        throw;
+    }
+    m_hasCouplingEdgeCount = false;
+    return logLikelihoods;
+};
+
 template<typename GraphPriorType>
 const std::vector<double> Dynamics<GraphPriorType>::getTransitionProbs(VertexState prevVertexState, VertexNeighborhoodState neighborhoodState) const{
     std::vector<double> transProbs(getNumStates());
@@ -354,8 +495,8 @@ void Dynamics<GraphPriorType>::updateNeighborsStateFromEdgeMove(
 
     VertexState vState, uState;
     for (size_t t = 0; t < m_numSteps; t++) {
-        uState = m_pastStateSequence[u][t];
-        vState = m_pastStateSequence[v][t];
+        uState = (*m_pastStateSequence)[u][t];
+        vState = (*m_pastStateSequence)[v][t];
         nextNeighborMap[u][t][vState] += counter;
         if (u != v)
             nextNeighborMap[v][t][uState] += counter;
@@ -385,10 +526,10 @@ const double Dynamics<GraphPriorType>::getLogLikelihoodRatioFromGraphMove(const
     for (const auto& idx: verticesAffected){
         for (size_t t = 0; t < m_numSteps; t++) {
             logLikelihoodRatio += log(
-                getTransitionProb(m_pastStateSequence[idx][t], m_futureStateSequence[idx][t], nextNeighborMap[idx][t])
+                getTransitionProb((*m_pastStateSequence)[idx][t], (*m_futureStateSequence)[idx][t], nextNeighborMap[idx][t])
             );
             logLikelihoodRatio -= log(
-                getTransitionProb(m_pastStateSequence[idx][t], m_futureStateSequence[idx][t], prevNeighborMap[idx][t])
+                getTransitionProb((*m_pastStateSequence)[idx][t], (*m_futureStateSequence)[idx][t], prevNeighborMap[idx][t])
             );
         }
     }
@@ -441,7 +582,7 @@ void Dynamics<GraphPriorType>::checkConsistencyOfNeighborsPastStateSequence() co
                 + std::to_string(m_neighborsPastStateSequence.size())
                 + ", expected size " + std::to_string(getSize()) + ".");
     const auto& actual = m_neighborsPastStateSequence;
-    const auto expected = computeNeighborsStateSequence(m_pastStateSequence);
+    const auto expected = computeNeighborsStateSequence(*m_pastStateSequence);
     for (size_t v=0; v<getSize(); ++v){
         if (actual[v].size() != getNumSteps())
             throw ConsistencyError("Dynamics: `m_neighborsPastStateSequence` is inconsistent with past states at (v="
@@ -502,9 +643,9 @@ void Dynamics<GraphPriorType>::checkSelfSafety() const {
 
     if (m_state.size() == 0)
         throw SafetyError("Dynamics: unsafe graph family since `m_state` is empty.");
-    if (m_pastStateSequence.size() == 0)
+    if (m_pastStateSequence->size() == 0)
         throw SafetyError("Dynamics: unsafe graph family since `m_pastStateSequence` is empty.");
-    if (m_futureStateSequence.size() == 0)
+    if (m_futureStateSequence->size() == 0)
         throw SafetyError("Dynamics: unsafe graph family since `m_futureStateSequence` is empty.");
     if (m_neighborsPastStateSequence.size() == 0)
         throw SafetyError("Dynamics: unsafe graph family since `m_neighborsPastStateSequence` is empty.");
@@ -0,0 +1,178 @@
+#ifndef FAST_MIDYNET_EXACT_EVIDENCE_HPP
+#define FAST_MIDYNET_EXACT_EVIDENCE_HPP
+
+#include <cmath>
+#include <exception>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+#include "FastMIDyNet/dynamics/dynamics.hpp"
+#include "FastMIDyNet/utility/cache.hpp"
+#include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/graph_enumeration.h"
+
+
+namespace FastMIDyNet{
+
+struct ExactEvidence{
+    double logEvidence = -INFINITY;
+    size_t graphCount = 0;
+    // edgeLogMarginals[edge][m] is the log-posterior probability that `edge` has multiplicity m
+    std::map<BaseGraph::Edge, std::vector<double>> edgeLogMarginals;
+};
+
+namespace detail{
+
+struct ExactEvidenceAccumulator{
+    LogSumExp evidence;
+    size_t graphCount = 0;
+    std::vector<std::vector<LogSumExp>> edgeMultiplicities;
+    std::exception_ptr error = nullptr;
+
+    void add(const std::vector<size_t>& multiplicities, double logJoint){
+        if (not (logJoint > -INFINITY))
+            return;
+        evidence.add(logJoint);
+        ++graphCount;
+        for (size_t i = 0; i < multiplicities.size(); ++i){
+            if (multiplicities[i] == 0)
+                continue;
+            if (edgeMultiplicities[i].size() < multiplicities[i])
+                edgeMultiplicities[i].resize(multiplicities[i]);
+            edgeMultiplicities[i][multiplicities[i] - 1].add(logJoint);
+        }
+    }
+};
+
+/* Only the graphs compatible with the graph prior are counted. The dynamics is only set
+ * to compatible graphs, and only moved between them, so that the graph prior keeps the
+ * state it had before the enumeration: setting an incompatible graph would overwrite the
+ * state of delta priors, which would then accept any graph, and moving to it would change
+ * states that setting a graph does not restore (e.g. the degrees). The compatibility is
+ * followed move by move, the graph being built only to resync the dynamics. */
+template<typename GraphPriorType>
+void accumulateExactEvidence(
+    Dynamics<GraphPriorType>& dynamics,
+    GraphEnumerator& enumerator,
+    ExactEvidenceAccumulator& accumulator
+){
+    accumulator.edgeMultiplicities.resize(enumerator.getEdges().size());
+    double logJoint = 0;
+    bool isSynced = false;
+    size_t moveCount = 0;
+    GraphMove move;
+    std::unique_ptr<GraphCompatibilityTracker> tracker(dynamics.getGraphPrior().getCompatibilityTracker());
+    tracker->setGraph(enumerator.getGraph());
+    while (true){
+        if (not tracker->isCompatible())
+            isSynced = false;
+        else {
+            if (not isSynced){
+                dynamics.setGraph(enumerator.getGraph());
+                logJoint = dynamics.getLogJoint();
+                isSynced = true;
+            }
+            else {
+                logJoint += dynamics.getLogJointRatioFromGraphMove(move);
+                dynamics.applyGraphMove(move);
+                // impossible graphs and accumulated rounding errors are resolved exactly
+                if (not std::isfinite(logJoint) or ++moveCount % LogProbabilityCache::RECOMPUTATION_PERIOD == 0)
+                    logJoint = dynamics.getLogJoint();
+            }
+            accumulator.add(enumerator.getEdgeMultiplicities(), logJoint);
+        }
+        if (not enumerator.next(move))
+            break;
+        tracker->applyGraphMove(move);
+    }
+}
+
+}
+
+/* Exact evidence of the past and future states of the dynamics, obtained by
+ * enumerating every graph with the edge count of its graph prior that is
+ * compatible with the graph prior. Consecutive graphs differ by one edge move,
+ * so the log-joint is updated incrementally. The enumeration is split evenly
+ * between the replicas, each running on its own thread; the replicas must hold
+ * the same states and priors. */
+template<typename GraphPriorType>
+ExactEvidence getExactEvidence(
+    const std::vector<Dynamics<GraphPriorType>*>& replicas,
+    bool allowSelfLoops=true,
+    bool allowMultiEdges=true
+){
+    if (replicas.size() == 0)
+        throw std::logic_error("getExactEvidence: at least one replica of the dynamics is required.");
+    size_t size = replicas[0]->getSize();
+    size_t edgeCount = replicas[0]->getGraphPrior().getEdgeCount();
+    size_t graphCount = GraphEnumerator::getGraphCount(size, edgeCount, allowSelfLoops, allowMultiEdges);
+    size_t chunkSize = graphCount / replicas.size() + (graphCount % replicas.size() != 0);
+
+    std::vector<detail::ExactEvidenceAccumulator> accumulators(replicas.size());
+    auto work = [&](size_t i){
+        size_t firstRank = i * chunkSize;
+        if (firstRank >= graphCount)
+            return;
+        Dynamics<GraphPriorType>& dynamics = *replicas[i];
+        const MultiGraph originalGraph = dynamics.getGraph();
+        try {
+            GraphEnumerator enumerator(size, edgeCount, allowSelfLoops, allowMultiEdges, firstRank, firstRank + chunkSize);
+            detail::accumulateExactEvidence(dynamics, enumerator, accumulators[i]);
+            dynamics.setGraph(originalGraph);
+        }
+        catch (...) {
+            accumulators[i].error = std::current_exception();
+            dynamics.setGraph(originalGraph);
+        }
+    };
+    if (replicas.size() == 1)
+        work(0);
+    else {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < replicas.size(); ++i)
+            threads.push_back(std::thread(work, i));
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    const auto edges = GraphEnumerator(size, edgeCount, allowSelfLoops, allowMultiEdges).getEdges();
+    detail::ExactEvidenceAccumulator total;
+    total.edgeMultiplicities.resize(edges.size());
+    for (const auto& accumulator : accumulators){
+        if (accumulator.error)
+            std::rethrow_exception(accumulator.error);
+        total.evidence.merge(accumulator.evidence);
+        total.graphCount += accumulator.graphCount;
+        for (size_t e = 0; e < accumulator.edgeMultiplicities.size(); ++e){
+            if (total.edgeMultiplicities[e].size() < accumulator.edgeMultiplicities[e].size())
+                total.edgeMultiplicities[e].resize(accumulator.edgeMultiplicities[e].size());
+            for (size_t m = 0; m < accumulator.edgeMultiplicities[e].size(); ++m)
+                total.edgeMultiplicities[e][m].merge(accumulator.edgeMultiplicities[e][m]);
+        }
+    }
+
+    ExactEvidence exactEvidence;
+    exactEvidence.logEvidence = total.evidence.get();
+    exactEvidence.graphCount = total.graphCount;
+    for (size_t e = 0; e < edges.size(); ++e){
+        LogSumExp edgeEvidence;
+        std::vector<double> logMarginals(total.edgeMultiplicities[e].size() + 1);
+        for (size_t m = 0; m < total.edgeMultiplicities[e].size(); ++m){
+            edgeEvidence.merge(total.edgeMultiplicities[e][m]);
+            logMarginals[m + 1] = total.edgeMultiplicities[e][m].get() - exactEvidence.logEvidence;
+        }
+        if (not (edgeEvidence.get() > -INFINITY))
+            continue;
+        logMarginals[0] = log(clipProb(1 - exp(edgeEvidence.get() - exactEvidence.logEvidence), 0));
+        exactEvidence.edgeLogMarginals.insert({edges[e], logMarginals});
+    }
+    return exactEvidence;
+}
+
+}
+
+#endif
@@ -47,6 +47,8 @@ class GlauberDynamics: public BinaryDynamics<GraphPriorType> {
                 numInitialActive),
             m_couplingConstant(couplingConstant) {}
 
+        GlauberDynamics* clone() const override { return new GlauberDynamics(*this); }
+
         const double getActivationProb(const VertexNeighborhoodState& vertexNeighborState) const override {
             return sigmoid( 2 * getCoupling() * (vertexNeighborState[0]-vertexNeighborState[1]));
         }
@@ -56,7 +58,7 @@ class GlauberDynamics: public BinaryDynamics<GraphPriorType> {
         const double getCoupling() const {
             if (not BaseClass::m_normalizeCoupling)
                 return m_couplingConstant;
-            double coupling = m_couplingConstant / (2 * BaseClass::m_graphPriorPtr->getEdgeCount() / BaseClass::m_graphPriorPtr->getSize());
+            double coupling = m_couplingConstant / (2 * BaseClass::getCouplingEdgeCount() / BaseClass::m_graphPriorPtr->getSize());
             return coupling;
         }
         void setCoupling(double couplingConstant) { m_couplingConstant = couplingConstant; }
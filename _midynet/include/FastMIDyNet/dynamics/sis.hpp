@@ -51,6 +51,8 @@ public:
         m_infectionProb(infectionProb),
         m_recoveryProb(recoveryProb){ }
 
+    SISDynamics* clone() const override { return new SISDynamics(*this); }
+
     const double getActivationProb(const VertexNeighborhoodState& vertexNeighborState) const override{
         return 1 - std::pow(1 - getInfectionProb(), vertexNeighborState[1]);
     }
@@ -61,7 +63,7 @@ public:
     const double getInfectionProb() const {
         if (not BaseClass::m_normalizeCoupling)
             return m_infectionProb;
-        double infProb = m_infectionProb / (2 * BaseClass::m_graphPriorPtr->getEdgeCount() / BaseClass::m_graphPriorPtr->getSize());
+        double infProb = m_infectionProb / (2 * BaseClass::getCouplingEdgeCount() / BaseClass::m_graphPriorPtr->getSize());
         if (infProb > 1 - EPSILON)
             return 1 - EPSILON;
         if (infProb < 0)
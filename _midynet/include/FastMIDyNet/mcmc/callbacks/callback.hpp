@@ -34,6 +34,7 @@ public:
     CallBackMap() {}
     CallBackMap(std::map<std::string, CallBack<MCMCType>*> callBacks): m_callbacksMap(callBacks) {}
     CallBackMap(const CallBackMap& callBacks): m_callbacksMap(callBacks.m_callbacksMap) {}
+    CallBackMap& operator=(const CallBackMap& callBacks) = default;
 
     void setUp(MCMCType* mcmcPtr) { for(auto c : m_callbacksMap) c.second->setUp(mcmcPtr); }
     void tearDown() { for(auto c : m_callbacksMap) c.second->tearDown(); }
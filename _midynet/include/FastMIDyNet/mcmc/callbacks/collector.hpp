@@ -2,12 +2,18 @@
 #define FAST_MIDYNET_COLLECTOR_HPP
 
 #include <vector>
+#include <string>
 #include <fstream>
 
 #include "callback.hpp"
 #include "FastMIDyNet/mcmc/community.hpp"
 #include "FastMIDyNet/mcmc/reconstruction.hpp"
 #include "FastMIDyNet/utility/distance.h"
+#include "FastMIDyNet/utility/edge_marginals.h"
+#include "FastMIDyNet/utility/graph_snapshot.h"
+#include "FastMIDyNet/utility/partition_summary.h"
+#include "FastMIDyNet/utility/ring_buffer.hpp"
+#include "FastMIDyNet/utility/shared_buffer.hpp"
 #include "BaseGraph/fileio.h"
 
 namespace FastMIDyNet{
@@ -46,98 +52,106 @@ using BlockLabeledGraphReconstructionStepCollector = StepCollector<GraphReconstr
 template<typename GraphMCMC>
 class CollectGraphOnSweep: public SweepCollector<GraphMCMC>{
 private:
-    std::vector<MultiGraph> m_collectedGraphs;
+    GraphSnapshotSequence m_collectedGraphs;
 public:
     using BaseClass = SweepCollector<GraphMCMC>;
-    void collect() override { m_collectedGraphs.push_back( BaseClass::m_mcmcPtr->getGraph() ); }
+    CollectGraphOnSweep(size_t keyframePeriod=64): m_collectedGraphs(keyframePeriod) { }
+    void collect() override { m_collectedGraphs.push( BaseClass::m_mcmcPtr->getGraph() ); }
     void clear() override { m_collectedGraphs.clear(); }
-    const std::vector<MultiGraph>& getData() const { return m_collectedGraphs; }
+    const std::vector<MultiGraph> getData() const { return m_collectedGraphs.getGraphs(); }
+    const MultiGraph getGraph(size_t index) const { return m_collectedGraphs.getGraph(index); }
+    const GraphSnapshotSequence& getSnapshots() const { return m_collectedGraphs; }
 };
 
 using CollectBlockLabeledGraphOnSweep = CollectGraphOnSweep<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>;
 
+/* Posterior marginals of the edge multiplicities, i.e. the fraction of the collected
+ * graphs in which each edge has each multiplicity. The accepted graph moves are applied
+ * to the accumulator at the end of each step, and each collection only advances its
+ * time, so that collecting costs O(moves) instead of O(E). The graph is scanned when the
+ * collector is set up, or when it changed other than by the steps of the MCMC.
+ *
+ * With `timeWeighted`, the time advances at every step instead of every collection, so
+ * that each graph visited by the chain is weighted by the number of steps it was kept. */
 template<typename GraphMCMC>
 class CollectEdgeMultiplicityOnSweep: public SweepCollector<GraphMCMC>{
 private:
-    CounterMap<BaseGraph::Edge> m_observedEdges;
-    CounterMap<std::pair<BaseGraph::Edge, size_t>> m_observedEdgesCount;
-    CounterMap<BaseGraph::Edge> m_observedEdgesMaxCount;
-    size_t m_totalCount;
+    EdgeMarginalAccumulator m_marginals;
+    const bool m_timeWeighted;
+    size_t m_totalCount = 0;
+    size_t m_appliedGraphMoveCount = 0;
+    size_t m_graphVersion = 0;
+    bool m_isSynced = false;
+
+    void update();
 public:
     using BaseClass = SweepCollector<GraphMCMC>;
+    CollectEdgeMultiplicityOnSweep(bool timeWeighted=false): m_timeWeighted(timeWeighted) { }
+
+    void setUp(GraphMCMC* mcmcPtr) override { BaseClass::setUp(mcmcPtr); m_isSynced = false; }
+    void onStepEnd() override ;
     void collect() override ;
-    void clear() override { m_observedEdges.clear(); m_observedEdgesCount.clear(); m_observedEdgesMaxCount.clear();}
-    const double getMarginalEntropy() ;
+    void clear() override { m_marginals.clear(); m_totalCount = 0; m_isSynced = false; }
+    const double getMarginalEntropy() { return m_marginals.getEntropy(); }
     const MultiGraph& getCurrentGraph() { return BaseClass::m_mcmcPtr->getGraph(); }
-    const double getLogPosteriorEstimate(const MultiGraph&) ;
+    const double getLogPosteriorEstimate(const MultiGraph& graph) { return m_marginals.getLogProb(graph); }
     const double getLogPosteriorEstimate() { return getLogPosteriorEstimate(BaseClass::m_mcmcPtr->getGraph()); }
     size_t getTotalCount() const { return m_totalCount; }
-    size_t getEdgeObservationCount(BaseGraph::Edge edge) const { return m_observedEdges[edge]; }
-    const double getEdgeCountProb(BaseGraph::Edge edge, size_t count) const ;
+    size_t getEdgeObservationCount(BaseGraph::Edge edge) const { return static_cast<size_t>(round(m_marginals.getTime() - m_marginals.getWeight(edge, 0))); }
+    const double getEdgeCountProb(BaseGraph::Edge edge, size_t count) const { return m_marginals.getProb(edge, count); }
     const std::map<BaseGraph::Edge, std::vector<double>> getEdgeProbs() ;
+    const EdgeMarginalAccumulator& getMarginals() const { return m_marginals; }
+    const bool isTimeWeighted() const { return m_timeWeighted; }
 
 };
 
 using CollectBlockLabeledEdgeMultiplicityOnSweep = CollectEdgeMultiplicityOnSweep<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>;
 
 template<typename GraphMCMC>
-void CollectEdgeMultiplicityOnSweep<GraphMCMC>::collect(){
-    ++m_totalCount;
-    const MultiGraph& graph = getCurrentGraph();
-
-    for ( auto vertex : graph){
-        for (auto neighbor : graph.getNeighboursOfIdx(vertex)){
-            if (vertex <= neighbor.vertexIndex){
-                auto edge = getOrderedPair<BaseGraph::VertexIndex>({vertex, neighbor.vertexIndex});
-                m_observedEdges.increment(edge);
-                m_observedEdgesCount.increment({edge, neighbor.label});
-                if (neighbor.label > m_observedEdgesMaxCount[edge])
-                    m_observedEdgesMaxCount.set(edge, neighbor.label);
-            }
-        }
+void CollectEdgeMultiplicityOnSweep<GraphMCMC>::update(){
+    const auto& mcmc = *BaseClass::m_mcmcPtr;
+    size_t appliedGraphMoveCount = mcmc.getAppliedGraphMoveCount();
+    if (mcmc.getGraphVersion() != m_graphVersion)
+        m_isSynced = false;
+    if (m_isSynced and appliedGraphMoveCount == m_appliedGraphMoveCount + 1){
+        const GraphMove& move = mcmc.getLastAppliedGraphMove();
+        for (const auto& edge: move.removedEdges)
+            m_marginals.addMultiplicity(getOrderedEdge(edge), -1);
+        for (const auto& edge: move.addedEdges)
+            m_marginals.addMultiplicity(getOrderedEdge(edge), 1);
     }
-}
-
-
-template<typename GraphMCMC>
-const double CollectEdgeMultiplicityOnSweep<GraphMCMC>::getEdgeCountProb(BaseGraph::Edge edge, size_t count) const {
-    if (count == 0)
-        return 1.0 - ((double)m_observedEdges.get(edge)) / ((double)m_totalCount);
-    else
-        return ((double)m_observedEdgesCount.get({edge, count})) / ((double)m_totalCount);
+    else if (not m_isSynced or appliedGraphMoveCount != m_appliedGraphMoveCount){
+        m_marginals.setGraph(mcmc.getGraph());
+        m_isSynced = true;
+    }
+    m_appliedGraphMoveCount = appliedGraphMoveCount;
+    m_graphVersion = mcmc.getGraphVersion();
 }
 
 template<typename GraphMCMC>
-const double CollectEdgeMultiplicityOnSweep<GraphMCMC>::getMarginalEntropy() {
-    double marginalEntropy = 0;
-    for (auto edge : m_observedEdges){
-        for (size_t count = 0; count <= m_observedEdgesMaxCount[edge.first]; ++count){
-            double p = getEdgeCountProb(edge.first, count);
-            if (p > 0)
-                marginalEntropy -= p * log(p);
-        }
-    }
-    return marginalEntropy;
+void CollectEdgeMultiplicityOnSweep<GraphMCMC>::onStepEnd(){
+    if (not m_timeWeighted)
+        return update();
+    update();
+    m_marginals.advance();
 }
 
 template<typename GraphMCMC>
-const double CollectEdgeMultiplicityOnSweep<GraphMCMC>::getLogPosteriorEstimate(const MultiGraph& graph) {
-    double logPosterior = 0;
-    for (auto edge : m_observedEdges)
-        logPosterior += log(getEdgeCountProb(edge.first, graph.getEdgeMultiplicityIdx(edge.first)));
-    return logPosterior;
+void CollectEdgeMultiplicityOnSweep<GraphMCMC>::collect(){
+    update();
+    ++m_totalCount;
+    if (not m_timeWeighted)
+        m_marginals.advance();
 }
 
 template<typename GraphMCMC>
 const std::map<BaseGraph::Edge, std::vector<double>> CollectEdgeMultiplicityOnSweep<GraphMCMC>::getEdgeProbs() {
     std::map<BaseGraph::Edge, std::vector<double>> edgeProbs;
-
-    for (auto edge : m_observedEdges){
-        edgeProbs.insert({edge.first, {}});
-        for (size_t count = 0; count <= m_observedEdgesMaxCount[edge.first]; ++count){
-            double p = getEdgeCountProb(edge.first, count);
-            edgeProbs[edge.first].push_back(p);
-        }
+    for (const auto& edge : m_marginals.getObservedEdges()){
+        auto& probs = edgeProbs[edge];
+        probs.resize(m_marginals.getMaxObservedMultiplicity(edge) + 1);
+        for (size_t count = 0; count < probs.size(); ++count)
+            probs[count] = m_marginals.getProb(edge, count);
     }
     return edgeProbs;
 }
@@ -156,33 +170,86 @@ public:
 using CollectPartitionOnSweepForReconstruction = CollectPartitionOnSweep<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>;
 using CollectPartitionOnSweepForCommunity = CollectPartitionOnSweep<VertexLabelMCMC<BlockIndex>>;
 
+/* Summary of the partitions of the sweeps in bounded memory, instead of their copies. */
+template<typename GraphMCMC>
+class SummarizePartitionOnSweep: public SweepCollector<GraphMCMC>{
+private:
+    PartitionSummarizer m_summarizer;
+public:
+    using BaseClass = SweepCollector<GraphMCMC>;
+    SummarizePartitionOnSweep(size_t pairCount=1000, size_t reservoirCapacity=0):
+        m_summarizer(pairCount, reservoirCapacity) { }
+    void collect() override { m_summarizer.update(BaseClass::m_mcmcPtr->getGraphPrior().getLabels()); }
+    void clear() override { m_summarizer.clear(); }
+    const PartitionSummarizer& getSummary() const { return m_summarizer; }
+};
+
+using SummarizePartitionOnSweepForReconstruction = SummarizePartitionOnSweep<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>;
+using SummarizePartitionOnSweepForCommunity = SummarizePartitionOnSweep<VertexLabelMCMC<BlockIndex>>;
+
 class CollectLikelihoodOnSweep: public SweepCollector<MCMC>{
 private:
-    std::vector<double> m_collectedLikelihoods;
+    SharedBuffer<double> m_collectedLikelihoods;
 public:
-    void collect() override { m_collectedLikelihoods.push_back( m_mcmcPtr->getLogLikelihood() ); }
+    void collect() override { m_collectedLikelihoods.push( m_mcmcPtr->getLogLikelihood() ); }
     void clear() override { m_collectedLikelihoods.clear(); }
-    const std::vector<double>& getData() const { return m_collectedLikelihoods; }
+    const std::vector<double>& getData() const { return m_collectedLikelihoods.getData(); }
+    std::shared_ptr<const std::vector<double>> shareData() const { return m_collectedLikelihoods.share(); }
 };
 
 class CollectPriorOnSweep: public SweepCollector<MCMC>{
 private:
-    std::vector<double> m_collectedPriors;
+    SharedBuffer<double> m_collectedPriors;
 public:
-    void collect() override { m_collectedPriors.push_back( m_mcmcPtr->getLogPrior() ); }
+    void collect() override { m_collectedPriors.push( m_mcmcPtr->getLogPrior() ); }
     void clear() override { m_collectedPriors.clear(); }
-    const std::vector<double>& getData() const { return m_collectedPriors; }
+    const std::vector<double>& getData() const { return m_collectedPriors.getData(); }
+    std::shared_ptr<const std::vector<double>> shareData() const { return m_collectedPriors.share(); }
 };
 
 class CollectJointOnSweep: public SweepCollector<MCMC>{
 private:
-    std::vector<double> m_collectedJoints;
+    SharedBuffer<double> m_collectedJoints;
 public:
-    void collect() override { m_collectedJoints.push_back( m_mcmcPtr->getLogJoint() ); }
+    void collect() override { m_collectedJoints.push( m_mcmcPtr->getLogJoint() ); }
     void clear() override { m_collectedJoints.clear(); }
-    const std::vector<double>& getData() const { return m_collectedJoints; }
+    const std::vector<double>& getData() const { return m_collectedJoints.getData(); }
+    std::shared_ptr<const std::vector<double>> shareData() const { return m_collectedJoints.share(); }
 };
 
+/* Collector configured once by the names of the statistics to record, in
+ * `STATISTIC_NAMES`. Every `stride` sweeps, or steps if `onStep` is true, each
+ * statistic is pushed into its own ring buffer holding the last `capacity` values.
+ * The acceptance rate is the fraction of steps accepted since the previous record. */
+class CollectStatistics: public Collector<MCMC>{
+public:
+    enum Statistic { LOG_LIKELIHOOD, LOG_PRIOR, LOG_JOINT, LOG_JOINT_RATIO, LOG_ACCEPTANCE, ACCEPTANCE_RATE };
+    static const std::vector<std::string> STATISTIC_NAMES;
+private:
+    std::vector<Statistic> m_statistics;
+    std::vector<RingBuffer<double>> m_buffers;
+    const size_t m_stride;
+    const bool m_onStep;
+    size_t m_callCount = 0;
+    size_t m_stepCount = 0;
+    size_t m_acceptedCount = 0;
+
+    const double getStatistic(Statistic statistic) const;
+    const size_t getStatisticIndex(const std::string& name) const;
+public:
+    CollectStatistics(const std::vector<std::string>& statistics, size_t stride=1, size_t capacity=1000, bool onStep=false);
+
+    void onStepEnd() override;
+    void onSweepEnd() override;
+    void collect() override;
+    void clear() override;
+
+    const std::vector<std::string> getStatisticNames() const;
+    const RingBuffer<double>& getBuffer(const std::string& name) const { return m_buffers[getStatisticIndex(name)]; }
+    const std::vector<double> getData(const std::string& name) const { return getBuffer(name).getData(); }
+    const size_t getStride() const { return m_stride; }
+    const bool isOnStep() const { return m_onStep; }
+};
 
 }
 
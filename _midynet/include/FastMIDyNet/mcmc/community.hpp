@@ -154,14 +154,23 @@ double VertexLabelMCMC<Label>::_getLogAcceptanceProbFromLabelMove(const LabelMov
 template<typename Label>
 bool VertexLabelMCMC<Label>::doMetropolisHastingsStep() {
     LabelMove<Label> move = m_labelProposerPtr->proposeMove();
-    if (move.prevLabel == move.nextLabel and move.addedLabels == 0)
+    ProposalRecord record = m_labelProposerPtr->startProposalRecord(move);
+    m_isLastIdentity = move.prevLabel == move.nextLabel and move.addedLabels == 0;
+    if (m_isLastIdentity){
+        m_labelProposerPtr->stopProposalRecord(record, true);
+        if (m_labelProposerPtr->isAdaptingMoveTypes())
+            m_labelProposerPtr->recordMoveOutcome(false, readCycleCounter() - record.startCycle);
         return m_isLastAccepted = true;
+    }
     m_lastLogAcceptance = getLogAcceptanceProbFromLabelMove(move);
     m_isLastAccepted = false;
-    if (m_uniform(rng) < exp(m_lastLogAcceptance)){
+    if (m_uniform(rng) < exp(m_lastLogAcceptance))
         m_isLastAccepted = true;
+    m_labelProposerPtr->stopProposalRecord(record, m_isLastAccepted);
+    if (m_labelProposerPtr->isAdaptingMoveTypes())
+        m_labelProposerPtr->recordMoveOutcome(m_isLastAccepted, readCycleCounter() - record.startCycle);
+    if (m_isLastAccepted)
         applyLabelMove(move);
-    }
     return m_isLastAccepted;
 }
 
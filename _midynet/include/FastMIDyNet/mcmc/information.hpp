@@ -0,0 +1,206 @@
+#ifndef FAST_MIDYNET_INFORMATION_HPP
+#define FAST_MIDYNET_INFORMATION_HPP
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "FastMIDyNet/rng.h"
+#include "FastMIDyNet/clone.hpp"
+#include "FastMIDyNet/dynamics/exact_evidence.hpp"
+#include "FastMIDyNet/mcmc/reconstruction.hpp"
+#include "FastMIDyNet/mcmc/callbacks/collector.hpp"
+#include "FastMIDyNet/utility/scheduler.h"
+
+
+namespace FastMIDyNet{
+
+/* Monte Carlo estimator of the mutual information between the graph G and the states X
+ * of a reconstruction model. Each sample draws (G, X) from the model and computes, in nats,
+ *      hg = -log P(G), hxg = -log P(X|G), hgx = -log P(G|X),
+ *      hx = hg + hxg - hgx, mi = hg - hgx.
+ * The posterior is estimated by the product of the edge marginals collected on the sweeps
+ * of the MCMC ("meanfield"), or computed by enumerating every graph ("exact").
+ *
+ * The samples run in parallel on one thread per model, and a model is only used by one
+ * thread at a time. Each sample is drawn with its own seed, whichever thread runs it, so
+ * the estimates do not depend on the number of models. The models are either given, or
+ * cloned from a single model that is left untouched, sharing its observed time series. */
+template<typename GraphPriorType=RandomGraph>
+class InformationEstimator{
+public:
+    typedef GraphReconstructionMCMC<GraphPriorType> MCMCType;
+private:
+    std::vector<MCMCType*> m_mcmcs;
+    std::vector<std::unique_ptr<CloneMap>> m_cloneMaps;
+    std::vector<MCMCType*> m_freeMCMCs;
+    std::mutex m_freeMCMCsMutex;
+    const std::string m_method;
+    const size_t m_numSweeps;
+    const size_t m_burnPerVertex;
+    const size_t m_initialBurn;
+    std::map<std::string, std::vector<double>> m_samples;
+
+    MCMCType& acquireMCMC(){
+        std::lock_guard<std::mutex> lock(m_freeMCMCsMutex);
+        MCMCType* mcmcPtr = m_freeMCMCs.back();
+        m_freeMCMCs.pop_back();
+        return *mcmcPtr;
+    }
+    void releaseMCMC(MCMCType& mcmc){
+        std::lock_guard<std::mutex> lock(m_freeMCMCsMutex);
+        m_freeMCMCs.push_back(&mcmc);
+    }
+    void checkMethod() const {
+        if (m_method != "meanfield" and m_method != "exact")
+            throw std::logic_error("InformationEstimator: invalid method `" + m_method
+                + "`, valid methods are `meanfield` and `exact`.");
+    }
+    const double getLogPosterior(MCMCType& mcmc) const;
+    void estimate(MCMCType& mcmc, size_t sampleIndex);
+public:
+    static const std::vector<std::string> getQuantityNames() { return {"hx", "hg", "hxg", "hgx", "mi"}; }
+
+    InformationEstimator(
+        const std::vector<MCMCType*>& mcmcs,
+        std::string method="meanfield",
+        size_t numSweeps=1000,
+        size_t burnPerVertex=5,
+        size_t initialBurn=2000
+    ): m_mcmcs(mcmcs), m_method(method), m_numSweeps(numSweeps), m_burnPerVertex(burnPerVertex), m_initialBurn(initialBurn){
+        if (mcmcs.size() == 0)
+            throw std::logic_error("InformationEstimator: at least one model is required.");
+        for (auto mcmcPtr: mcmcs)
+            if (mcmcPtr == nullptr)
+                throw std::logic_error("InformationEstimator: models must not be null.");
+        checkMethod();
+    }
+    InformationEstimator(
+        const MCMCType& mcmc,
+        size_t numModels,
+        std::string method="meanfield",
+        size_t numSweeps=1000,
+        size_t burnPerVertex=5,
+        size_t initialBurn=2000
+    ): m_method(method), m_numSweeps(numSweeps), m_burnPerVertex(burnPerVertex), m_initialBurn(initialBurn){
+        if (numModels == 0)
+            throw std::logic_error("InformationEstimator: at least one model is required.");
+        checkMethod();
+        for (size_t i = 0; i < numModels; ++i){
+            m_cloneMaps.emplace_back(new CloneMap());
+            m_mcmcs.push_back(&m_cloneMaps.back()->get(mcmc));
+        }
+    }
+
+    const std::map<std::string, std::vector<double>>& compute(const std::vector<size_t>& seeds);
+    const std::map<std::string, std::vector<double>>& compute(size_t numSamples, size_t seed){
+        std::vector<size_t> seeds;
+        for (size_t i = 0; i < numSamples; ++i)
+            seeds.push_back(seed + i);
+        return compute(seeds);
+    }
+
+    const std::map<std::string, std::vector<double>>& getSamples() const { return m_samples; }
+    const double getMean(const std::string& quantity) const ;
+    const double getStandardError(const std::string& quantity) const ;
+    const size_t getModelCount() const { return m_mcmcs.size(); }
+    const std::string& getMethod() const { return m_method; }
+};
+
+/* Mirrors the estimator of the Python metrics: the original graph is collected once, the
+ * chain is burned for `initialBurn` steps and `numSweeps` sweeps of `burnPerVertex * N`
+ * steps follow, each collected at its end. */
+template<typename GraphPriorType>
+const double InformationEstimator<GraphPriorType>::getLogPosterior(MCMCType& mcmc) const {
+    const MultiGraph originalGraph = mcmc.getGraph();
+    if (m_method == "exact"){
+        const auto& edgeProposer = mcmc.getEdgeProposer();
+        auto evidence = getExactEvidence<GraphPriorType>(
+            {&mcmc.getDynamicsRef()}, edgeProposer.allowSelfLoops(), edgeProposer.allowMultiEdges()
+        );
+        mcmc.setGraph(originalGraph);
+        return mcmc.getLogJoint() - evidence.logEvidence;
+    }
+
+    CollectEdgeMultiplicityOnSweep<MCMCType> collector;
+    mcmc.insertCallBack("information_estimator", collector);
+    mcmc.setUp();
+    collector.collect();
+    mcmc.doMHSweep(m_initialBurn);
+    size_t burn = m_burnPerVertex * mcmc.getDynamics().getSize();
+    for (size_t i = 0; i < m_numSweeps; ++i)
+        mcmc.doMHSweep(burn);
+    mcmc.setGraph(originalGraph);
+    double logPosterior = collector.getLogPosteriorEstimate(originalGraph);
+    mcmc.tearDown();
+    mcmc.removeCallBack("information_estimator");
+    return logPosterior;
+}
+
+template<typename GraphPriorType>
+void InformationEstimator<GraphPriorType>::estimate(MCMCType& mcmc, size_t sampleIndex){
+    mcmc.sample();
+    double hg = -mcmc.getLogPrior();
+    double hxg = -mcmc.getLogLikelihood();
+    double hgx = -getLogPosterior(mcmc);
+    /* `at` does not modify the map, so that the threads only write to their own elements */
+    m_samples.at("hg")[sampleIndex] = hg;
+    m_samples.at("hxg")[sampleIndex] = hxg;
+    m_samples.at("hgx")[sampleIndex] = hgx;
+    m_samples.at("hx")[sampleIndex] = hg + hxg - hgx;
+    m_samples.at("mi")[sampleIndex] = hg - hgx;
+}
+
+template<typename GraphPriorType>
+const std::map<std::string, std::vector<double>>& InformationEstimator<GraphPriorType>::compute(const std::vector<size_t>& seeds){
+    m_samples.clear();
+    for (const auto& quantity: getQuantityNames())
+        m_samples[quantity].assign(seeds.size(), 0);
+    m_freeMCMCs = m_mcmcs;
+
+    TaskScheduler scheduler(m_mcmcs.size());
+    scheduler.run(seeds.size(), [&](size_t sampleIndex){
+        MCMCType& mcmc = acquireMCMC();
+        try {
+            seed(seeds[sampleIndex]);
+            estimate(mcmc, sampleIndex);
+        }
+        catch (...) {
+            releaseMCMC(mcmc);
+            throw;
+        }
+        releaseMCMC(mcmc);
+    });
+    return m_samples;
+}
+
+template<typename GraphPriorType>
+const double InformationEstimator<GraphPriorType>::getMean(const std::string& quantity) const {
+    const auto& samples = m_samples.at(quantity);
+    if (samples.size() == 0)
+        throw std::logic_error("InformationEstimator: no sample has been computed.");
+    double mean = 0;
+    for (auto sample: samples)
+        mean += sample;
+    return mean / samples.size();
+}
+
+template<typename GraphPriorType>
+const double InformationEstimator<GraphPriorType>::getStandardError(const std::string& quantity) const {
+    const auto& samples = m_samples.at(quantity);
+    if (samples.size() < 2)
+        return 0;
+    double mean = getMean(quantity), variance = 0;
+    for (auto sample: samples)
+        variance += (sample - mean) * (sample - mean);
+    variance /= samples.size() - 1;
+    return sqrt(variance / samples.size());
+}
+
+}
+
+#endif
@@ -18,6 +18,7 @@ protected:
     mutable double m_lastLogJointRatio;
     mutable double m_lastLogAcceptance;
     mutable bool m_isLastAccepted;
+    mutable bool m_isLastIdentity = false;
     double m_betaLikelihood, m_betaPrior;
     mutable std::uniform_real_distribution<double> m_uniform;
 public:
@@ -33,6 +34,9 @@ public:
     const double getLastLogJointRatio() const { return m_lastLogJointRatio; }
     const double getLastLogAcceptance() const { return m_lastLogAcceptance; }
     const bool isLastAccepted() const { return m_isLastAccepted; }
+    /* Identity moves are accepted, but they are reported as rejected to the adaptive
+     * move type weights, which would otherwise favor the types yielding cheap no-ops. */
+    const bool isLastIdentity() const { return m_isLastIdentity; }
     const size_t getNumSteps() const { return m_numSteps; }
     const size_t getNumSweeps() const { return m_numSweeps; }
 
@@ -61,6 +65,8 @@ public:
             throw std::logic_error("MCMC: callback of key `" + key + "` cannot be removed.");
     }
     const CallBack<MCMC>& getMCMCCallBack(std::string key){ return m_mcmcCallBacks.get(key); }
+    /* The callbacks are bound to the original: a clone starts without any. */
+    void remapDependencies(CloneMap& cloneMap) override { m_mcmcCallBacks = CallBackMap<MCMC>(); }
 
     virtual void setUp() { m_mcmcCallBacks.setUp(this); m_numSteps = m_numSweeps = 0; }
     virtual void tearDown() { m_mcmcCallBacks.tearDown(); m_numSteps = m_numSweeps = 0; }
@@ -11,23 +11,53 @@
 
 namespace FastMIDyNet{
 
-/* CallBack  base class */
+/* CallBack  base class. The step and sweep methods are called at every step of the
+ * chain, so whether a Python subclass overrides them is looked up once in `setUp`
+ * and the Python dispatch is skipped for those that are not overridden. */
 template<typename MCMCType, typename BaseClass = CallBack<MCMCType>>
 class PyCallBack: public BaseClass{
+private:
+    bool m_overridesOnStepBegin = true;
+    bool m_overridesOnStepEnd = true;
+    bool m_overridesOnSweepBegin = true;
+    bool m_overridesOnSweepEnd = true;
+
+    bool hasOverride(const char* name) const {
+        pybind11::gil_scoped_acquire gil;
+        return static_cast<bool>(pybind11::get_override(static_cast<const BaseClass*>(this), name));
+    }
 public:
     using BaseClass::BaseClass;
     /* Pure abstract methods */
 
     /* Abstract methods */
-    void setUp(MCMCType* mcmcPtr) override { PYBIND11_OVERRIDE(void, BaseClass, setUp, mcmcPtr); }
-    void tearDown() override { PYBIND11_OVERRIDE(void, BaseClass, tearDown, ); }
-    void onBegin() override { PYBIND11_OVERRIDE(void, BaseClass, onBegin, ); }
-    void onEnd() override { PYBIND11_OVERRIDE(void, BaseClass, onEnd, ); }
-    void onStepBegin() override { PYBIND11_OVERRIDE(void, BaseClass, onStepBegin, ); }
-    void onStepEnd() override { PYBIND11_OVERRIDE(void, BaseClass, onStepEnd, ); }
-    void onSweepBegin() override { PYBIND11_OVERRIDE(void, BaseClass, onSweepBegin, ); }
-    void onSweepEnd() override { PYBIND11_OVERRIDE(void, BaseClass, onSweepEnd, ); }
-    void clear() override { PYBIND11_OVERRIDE(void, BaseClass, clear, ); }
+    void setUp(MCMCType* mcmcPtr) override {
+        m_overridesOnStepBegin = hasOverride("on_step_begin");
+        m_overridesOnStepEnd = hasOverride("on_step_end");
+        m_overridesOnSweepBegin = hasOverride("on_sweep_begin");
+        m_overridesOnSweepEnd = hasOverride("on_sweep_end");
+        PYBIND11_OVERRIDE_NAME(void, BaseClass, "set_up", setUp, mcmcPtr);
+    }
+    void tearDown() override { PYBIND11_OVERRIDE_NAME(void, BaseClass, "tear_down", tearDown, ); }
+    void onBegin() override { PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_begin", onBegin, ); }
+    void onEnd() override { PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_end", onEnd, ); }
+    void onStepBegin() override {
+        if (not m_overridesOnStepBegin) return BaseClass::onStepBegin();
+        PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_step_begin", onStepBegin, );
+    }
+    void onStepEnd() override {
+        if (not m_overridesOnStepEnd) return BaseClass::onStepEnd();
+        PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_step_end", onStepEnd, );
+    }
+    void onSweepBegin() override {
+        if (not m_overridesOnSweepBegin) return BaseClass::onSweepBegin();
+        PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_sweep_begin", onSweepBegin, );
+    }
+    void onSweepEnd() override {
+        if (not m_overridesOnSweepEnd) return BaseClass::onSweepEnd();
+        PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_sweep_end", onSweepEnd, );
+    }
+    void clear() override { PYBIND11_OVERRIDE_NAME(void, BaseClass, "clear", clear, ); }
 };
 
 /* Verbose classes */
@@ -36,7 +66,7 @@ class PyVerbose: public PyCallBack<MCMC, BaseClass>{
 public:
     using PyCallBack<MCMC, BaseClass>::PyCallBack;
     /* Pure abstract methods */
-    std::string getMessage() const override { PYBIND11_OVERRIDE_PURE(std::string, BaseClass, getMessage, ); }
+    std::string getMessage() const override { PYBIND11_OVERRIDE_PURE_NAME(std::string, BaseClass, "get_message", getMessage, ); }
 
     /* Abstract methods */
 
@@ -47,11 +77,11 @@ class PyVerboseDisplay: public PyCallBack<MCMC, BaseClass>{
 public:
     using PyCallBack<MCMC, BaseClass>::PyCallBack;
     /* Pure abstract methods */
-    void writeMessage(std::string message) override {PYBIND11_OVERRIDE_PURE(void, BaseClass, writeMessage, message); }
+    void writeMessage(std::string message) override {PYBIND11_OVERRIDE_PURE_NAME(void, BaseClass, "write_message", writeMessage, message); }
 
     /* Abstract methods */
-    void onBegin() override {PYBIND11_OVERRIDE(void, BaseClass, onBegin, ); }
-    void onEnd() override {PYBIND11_OVERRIDE(void, BaseClass, onEnd, ); }
+    void onBegin() override {PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_begin", onBegin, ); }
+    void onEnd() override {PYBIND11_OVERRIDE_NAME(void, BaseClass, "on_end", onEnd, ); }
 
 };
 
@@ -60,10 +90,10 @@ class PyLogJointRatioVerbose: public PyVerbose<BaseClass>{
 public:
     using PyVerbose<BaseClass>::PyVerbose;
     /* Pure abstract methods */
-    double updateSaved() const override { PYBIND11_OVERRIDE_PURE(double, BaseClass, updateSaved, ); }
+    double updateSaved() const override { PYBIND11_OVERRIDE_PURE_NAME(double, BaseClass, "update_saved", updateSaved, ); }
 
     /* Abstract methods */
-    std::string getMessage() const override { PYBIND11_OVERRIDE(std::string, BaseClass, getMessage, ); }
+    std::string getMessage() const override { PYBIND11_OVERRIDE_NAME(std::string, BaseClass, "get_message", getMessage, ); }
 
 };
 
@@ -73,8 +103,8 @@ class PyCollector: public PyCallBack<MCMCType, BaseClass>{
 public:
     using PyCallBack<MCMCType, BaseClass>::PyCallBack;
     /* Pure abstract methods */
-    void collect() override { PYBIND11_OVERRIDE_PURE(void, BaseClass, collect, ); }
-    void clear() override { PYBIND11_OVERRIDE_PURE(void, BaseClass, clear, ); }
+    void collect() override { PYBIND11_OVERRIDE_PURE_NAME(void, BaseClass, "collect", collect, ); }
+    void clear() override { PYBIND11_OVERRIDE_PURE_NAME(void, BaseClass, "clear", clear, ); }
 
     /* Abstract methods */
 
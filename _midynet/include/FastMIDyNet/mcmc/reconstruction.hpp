@@ -7,6 +7,7 @@
 #include "FastMIDyNet/mcmc/callbacks/callback.hpp"
 #include "FastMIDyNet/proposer/edge/edge_proposer.h"
 #include "FastMIDyNet/proposer/label/label_proposer.hpp"
+#include "FastMIDyNet/proposer/adaptive_mixture.hpp"
 #include "FastMIDyNet/utility/maps.hpp"
 
 namespace FastMIDyNet{
@@ -18,6 +19,9 @@ protected:
     GraphPriorType* m_graphPriorPtr = nullptr;
     EdgeProposer* m_edgeProposerPtr = nullptr;
     CallBackMap<GraphReconstructionMCMC<GraphPriorType>> m_graphCallBacks;
+    GraphMove m_lastAppliedGraphMove;
+    size_t m_appliedGraphMoveCount = 0;
+    size_t m_graphVersion = 0;
 
     double _getLogAcceptanceProbFromGraphMove(const GraphMove& move) const;
 public:
@@ -35,6 +39,20 @@ public:
         double betaPrior=1):
     MCMC(betaLikelihood, betaPrior){ }
 
+    GraphReconstructionMCMC* clone() const override { return new GraphReconstructionMCMC(*this); }
+    /* The proposers of the clone are set up on its own graph if those of the original were. */
+    void remapDependencies(CloneMap& cloneMap) override {
+        bool isSetUp = m_edgeProposerPtr != nullptr and m_edgeProposerPtr->isSafe();
+        MCMC::remapDependencies(cloneMap);
+        m_graphCallBacks = CallBackMap<GraphReconstructionMCMC<GraphPriorType>>();
+        cloneMap.remap(m_dynamicsPtr);
+        cloneMap.remap(m_edgeProposerPtr);
+        if (m_dynamicsPtr != nullptr)
+            m_graphPriorPtr = &m_dynamicsPtr->getGraphPriorRef();
+        if (isSetUp)
+            setUp();
+    }
+
     // Accessors and mutators
     const Dynamics<GraphPriorType>& getDynamics() const { return *m_dynamicsPtr; }
     Dynamics<GraphPriorType>& getDynamicsRef() const { return *m_dynamicsPtr; }
@@ -53,7 +71,11 @@ public:
     }
 
     const MultiGraph& getGraph() const { return m_dynamicsPtr->getGraph(); }
-    void setGraph(const MultiGraph& graph) { m_dynamicsPtr->setGraph(graph); m_edgeProposerPtr->setUp(graph); }
+    void setGraph(const MultiGraph& graph) {
+        m_dynamicsPtr->setGraph(graph);
+        m_edgeProposerPtr->setUp(getGraph());
+        ++m_graphVersion;
+    }
 
     void sample() override {
         m_dynamicsPtr->sample();
@@ -71,8 +93,10 @@ public:
 
     // Callbacks related
     virtual void setUp() override {
+        ++m_graphVersion;
         MCMC::setUp();
         m_graphCallBacks.setUp(this);
+        m_edgeProposerPtr->setUpStates(m_dynamicsPtr->getPastStates(), m_dynamicsPtr->getFutureStates());
         m_edgeProposerPtr->setUp(getGraph());
     }
     virtual void tearDown() override {
@@ -108,8 +132,14 @@ public:
         }, 0);
     }
     virtual bool doMetropolisHastingsStep() override ;
-
-    void applyGraphMove(const GraphMove& move){
+    /* Graph moves applied by the Metropolis-Hastings steps, so that the callbacks can
+     * follow the graph from one step to the next without scanning it. The graph version
+     * changes whenever the graph is replaced otherwise, by `setGraph` or `setUp`. */
+    const GraphMove& getLastAppliedGraphMove() const { return m_lastAppliedGraphMove; }
+    const size_t getAppliedGraphMoveCount() const { return m_appliedGraphMoveCount; }
+    const size_t getGraphVersion() const { return m_graphVersion; }
+
+    virtual void applyGraphMove(const GraphMove& move){
         processRecursiveFunction([&](){
             m_dynamicsPtr->applyGraphMove(move);
             m_edgeProposerPtr->applyGraphMove(move);
@@ -168,13 +198,25 @@ double GraphReconstructionMCMC<GraphPriorType>::_getLogAcceptanceProbFromGraphMo
 template<typename GraphPriorType>
 bool GraphReconstructionMCMC<GraphPriorType>::doMetropolisHastingsStep() {
     GraphMove move = m_edgeProposerPtr->proposeMove();
-    if (move.addedEdges == move.removedEdges)
+    ProposalRecord record = m_edgeProposerPtr->startProposalRecord(move);
+    m_isLastIdentity = move.addedEdges == move.removedEdges;
+    if (m_isLastIdentity){
+        m_edgeProposerPtr->stopProposalRecord(record, true);
+        if (m_edgeProposerPtr->isAdaptingMoveTypes())
+            m_edgeProposerPtr->recordMoveOutcome(false, readCycleCounter() - record.startCycle);
         return m_isLastAccepted = true;
+    }
     m_lastLogAcceptance = getLogAcceptanceProbFromGraphMove(move);
     m_isLastAccepted = false;
-    if (m_uniform(rng) < exp(m_lastLogAcceptance)){
+    if (m_uniform(rng) < exp(m_lastLogAcceptance))
         m_isLastAccepted = true;
+    m_edgeProposerPtr->stopProposalRecord(record, m_isLastAccepted);
+    if (m_edgeProposerPtr->isAdaptingMoveTypes())
+        m_edgeProposerPtr->recordMoveOutcome(m_isLastAccepted, readCycleCounter() - record.startCycle);
+    if (m_isLastAccepted){
         applyGraphMove(move);
+        m_lastAppliedGraphMove = std::move(move);
+        ++m_appliedGraphMoveCount;
     }
     return m_isLastAccepted;
 }
@@ -184,8 +226,9 @@ template<typename Label>
 class VertexLabeledGraphReconstructionMCMC: public GraphReconstructionMCMC<VertexLabeledRandomGraph<Label>>{
 protected:
     LabelProposer<Label>* m_labelProposerPtr = nullptr;
-    double m_sampleLabelProb;
+    AdaptiveMixture m_moveTypeMixture;
     bool m_lastMoveWasLabelMove;
+    bool doLabelMetropolisHastingsStep();
 
 public:
     using GraphPriorType = VertexLabeledRandomGraph<Label>;
@@ -199,7 +242,7 @@ public:
         double betaLikelihood=1,
         double betaPrior=1):
     BaseClass(dynamics, edgeProposer, betaLikelihood, betaPrior),
-    m_sampleLabelProb(sampleLabelProb){
+    m_moveTypeMixture({1 - sampleLabelProb, sampleLabelProb}){
             setLabelProposer(labelProposer);
         }
     VertexLabeledGraphReconstructionMCMC(
@@ -207,7 +250,13 @@ public:
         double betaLikelihood=1,
         double betaPrior=1):
     BaseClass(betaLikelihood, betaPrior),
-    m_sampleLabelProb(sampleLabelProb){ }
+    m_moveTypeMixture({1 - sampleLabelProb, sampleLabelProb}){ }
+
+    VertexLabeledGraphReconstructionMCMC* clone() const override { return new VertexLabeledGraphReconstructionMCMC(*this); }
+    void remapDependencies(CloneMap& cloneMap) override {
+        cloneMap.remap(m_labelProposerPtr);
+        BaseClass::remapDependencies(cloneMap);
+    }
 
     const LabelProposer<Label>& getLabelProposer() const { return *m_labelProposerPtr; }
     LabelProposer<Label>& getLabelProposerRef() const { return *m_labelProposerPtr; }
@@ -216,6 +265,16 @@ public:
         m_labelProposerPtr->isRoot(false);
     }
 
+    const double getSampleLabelProb() const { return m_moveTypeMixture.getWeight(1); }
+    void setSampleLabelProb(double sampleLabelProb) { m_moveTypeMixture.setWeights({1 - sampleLabelProb, sampleLabelProb}); }
+    /* Tunes the probability of label moves, from the acceptance rate and cost of the
+     * graph and label moves, until the weights are frozen. */
+    void startMoveTypeAdaptation(size_t adaptationPeriod=1000, double minWeight=0.05) {
+        m_moveTypeMixture.startAdaptation(adaptationPeriod, minWeight);
+    }
+    void freezeMoveTypeWeights() { m_moveTypeMixture.freeze(); }
+    const bool isAdaptingMoveTypes() const { return m_moveTypeMixture.isAdapting(); }
+
     const std::vector<Label>& getLabels() const {
         return BaseClass::m_dynamicsPtr->getGraphPrior().getLabels();
     }
@@ -225,6 +284,7 @@ public:
     }
 
     void setUp() override {
+        BaseClass::m_edgeProposerPtr->setUpLabels(BaseClass::m_dynamicsPtr->getGraphPrior());
         BaseClass::setUp();
         m_labelProposerPtr->setUp(BaseClass::m_dynamicsPtr->getGraphPrior());
     }
@@ -235,6 +295,14 @@ public:
         BaseClass::processRecursiveFunction([&](){
             BaseClass::m_dynamicsPtr->getGraphPriorRef().applyLabelMove(move);
             m_labelProposerPtr->applyLabelMove(move);
+            BaseClass::m_edgeProposerPtr->applyLabelMove(move);
+        });
+    }
+    void applyGraphMove(const GraphMove& move) override {
+        BaseClass::processRecursiveFunction([&](){
+            BaseClass::m_dynamicsPtr->applyGraphMove(move);
+            BaseClass::m_edgeProposerPtr->applyGraphMove(move);
+            m_labelProposerPtr->applyGraphMove(move);
         });
     }
     bool doMetropolisHastingsStep() override ;
@@ -279,18 +347,36 @@ const double VertexLabeledGraphReconstructionMCMC<Label>::getLogAcceptanceProbFr
 
 template<typename Label>
 bool VertexLabeledGraphReconstructionMCMC<Label>::doMetropolisHastingsStep() {
-    m_lastMoveWasLabelMove = BaseClass::m_uniform(rng) < m_sampleLabelProb;
-    if ( not m_lastMoveWasLabelMove)
-        return BaseClass::doMetropolisHastingsStep();
+    m_lastMoveWasLabelMove = BaseClass::m_uniform(rng) < m_moveTypeMixture.getWeight(1);
+    if (not m_moveTypeMixture.isAdapting())
+        return (m_lastMoveWasLabelMove) ? doLabelMetropolisHastingsStep() : BaseClass::doMetropolisHastingsStep();
+
+    uint64_t startCycle = readCycleCounter();
+    bool isAccepted = (m_lastMoveWasLabelMove) ? doLabelMetropolisHastingsStep() : BaseClass::doMetropolisHastingsStep();
+    m_moveTypeMixture.record(m_lastMoveWasLabelMove, isAccepted and not BaseClass::m_isLastIdentity, readCycleCounter() - startCycle);
+    return isAccepted;
+}
+
+template<typename Label>
+bool VertexLabeledGraphReconstructionMCMC<Label>::doLabelMetropolisHastingsStep() {
     LabelMove<Label> move = m_labelProposerPtr->proposeMove();
-    if (move.prevLabel == move.nextLabel and move.addedLabels == 0)
+    ProposalRecord record = m_labelProposerPtr->startProposalRecord(move);
+    BaseClass::m_isLastIdentity = move.prevLabel == move.nextLabel and move.addedLabels == 0;
+    if (BaseClass::m_isLastIdentity){
+        m_labelProposerPtr->stopProposalRecord(record, true);
+        if (m_labelProposerPtr->isAdaptingMoveTypes())
+            m_labelProposerPtr->recordMoveOutcome(false, readCycleCounter() - record.startCycle);
         return BaseClass::m_isLastAccepted = true;
+    }
     BaseClass::m_lastLogAcceptance = getLogAcceptanceProbFromLabelMove(move);
     BaseClass::m_isLastAccepted = false;
-    if (BaseClass::m_uniform(rng) < exp(BaseClass::m_lastLogAcceptance)){
+    if (BaseClass::m_uniform(rng) < exp(BaseClass::m_lastLogAcceptance))
         BaseClass::m_isLastAccepted = true;
+    m_labelProposerPtr->stopProposalRecord(record, BaseClass::m_isLastAccepted);
+    if (m_labelProposerPtr->isAdaptingMoveTypes())
+        m_labelProposerPtr->recordMoveOutcome(BaseClass::m_isLastAccepted, readCycleCounter() - record.startCycle);
+    if (BaseClass::m_isLastAccepted)
         applyLabelMove(move);
-    }
     return BaseClass::m_isLastAccepted;
 }
 
@@ -5,7 +5,9 @@
 #include <functional>
 #include "FastMIDyNet/types.h"
 #include "FastMIDyNet/rv.hpp"
+#include "FastMIDyNet/clone.hpp"
 #include "FastMIDyNet/proposer/movetypes.h"
+#include "FastMIDyNet/utility/cache.hpp"
 
 
 namespace FastMIDyNet{
@@ -16,6 +18,24 @@ protected:
     virtual void _applyGraphMove(const GraphMove&) = 0;
     virtual const double _getLogJointRatioFromGraphMove(const GraphMove&) const = 0;
     StateType m_state;
+
+    mutable LogProbabilityCache m_logLikelihoodCache;
+    mutable MoveLogRatioRecord<GraphMove> m_graphMoveLogLikelihoodRatio;
+    size_t m_appliedMoveCount = 0;
+
+    const double recordLogLikelihoodRatio(const GraphMove& move, double logLikelihoodRatio) const {
+        m_graphMoveLogLikelihoodRatio.record(move, logLikelihoodRatio, m_appliedMoveCount, this->getCacheEpoch());
+        return logLikelihoodRatio;
+    }
+    template<typename MoveType>
+    void updateLogLikelihoodCache(const MoveLogRatioRecord<MoveType>& record, const MoveType& move) {
+        double logLikelihoodRatio;
+        if (record.find(move, m_appliedMoveCount, this->getCacheEpoch(), logLikelihoodRatio))
+            m_logLikelihoodCache.update(logLikelihoodRatio, this->getCacheEpoch());
+        else
+            m_logLikelihoodCache.invalidate();
+        ++m_appliedMoveCount;
+    }
 public:
     Prior<StateType>(){}
     Prior<StateType>(const Prior<StateType>& other):
@@ -23,12 +43,13 @@ public:
     virtual ~Prior<StateType>(){}
     const Prior<StateType>& operator=(const Prior<StateType>& other){
         this->m_state = other.m_state;
+        this->invalidateCaches();
         return *this;
     }
 
     const StateType& getState() const { return m_state; }
     StateType& getStateRef() const { return m_state; }
-    virtual void setState(const StateType& state) { m_state = state; }
+    virtual void setState(const StateType& state) { m_state = state; this->invalidateCaches(); }
 
     virtual void sampleState() = 0;
     virtual void samplePriors() = 0;
@@ -37,13 +58,23 @@ public:
             samplePriors();
             sampleState();
         });
+        this->invalidateCaches();
         return getState();
     }
     virtual const double getLogLikelihood() const = 0;
     virtual const double getLogPrior() const = 0;
+    const double getCachedLogLikelihood() const {
+        size_t epoch = this->getCacheEpoch();
+        if (not m_logLikelihoodCache.isValid(epoch))
+            m_logLikelihoodCache.set(getLogLikelihood(), epoch);
+        return m_logLikelihoodCache.get();
+    }
 
     void applyGraphMove(const GraphMove& move) {
-        NestedRandomVariable::processRecursiveFunction([&](){_applyGraphMove(move);});
+        NestedRandomVariable::processRecursiveFunction([&](){
+            _applyGraphMove(move);
+            updateLogLikelihoodCache(m_graphMoveLogLikelihoodRatio, move);
+        });
         #if DEBUG
         checkConsistency();
         #endif
@@ -53,7 +84,7 @@ public:
     }
 
     const double getLogJoint() const {
-        auto _func = [&]() { return getLogPrior() + getLogLikelihood(); };
+        auto _func = [&]() { return getLogPrior() + getCachedLogLikelihood(); };
         double logJoint = processRecursiveConstFunction<double>(_func , 0);
         return logJoint;
     }
@@ -64,11 +95,22 @@ class VertexLabeledPrior: public Prior<StateType>{
 protected:
     virtual void _applyLabelMove(const LabelMove<Label>&) = 0;
     virtual const double _getLogJointRatioFromLabelMove(const LabelMove<Label>&) const = 0;
+
+    mutable MoveLogRatioRecord<LabelMove<Label>> m_labelMoveLogLikelihoodRatio;
+
+    using Prior<StateType>::recordLogLikelihoodRatio;
+    const double recordLogLikelihoodRatio(const LabelMove<Label>& move, double logLikelihoodRatio) const {
+        m_labelMoveLogLikelihoodRatio.record(move, logLikelihoodRatio, this->m_appliedMoveCount, this->getCacheEpoch());
+        return logLikelihoodRatio;
+    }
 public:
     using Prior<StateType>::Prior;
 
     void applyLabelMove(const LabelMove<Label>& move) {
-        NestedRandomVariable::processRecursiveFunction([&](){_applyLabelMove(move);});
+        NestedRandomVariable::processRecursiveFunction([&](){
+            _applyLabelMove(move);
+            this->updateLogLikelihoodCache(m_labelMoveLogLikelihoodRatio, move);
+        });
         #if DEBUG
         checkConsistency();
         #endif
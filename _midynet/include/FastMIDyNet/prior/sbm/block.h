@@ -25,17 +25,18 @@ protected:
 
     void _applyGraphMove(const GraphMove&) override { };
     void _applyLabelMove(const BlockMove& move) override {
-        m_blockCountPriorPtr->setState(m_blockCountPriorPtr->getState() + move.addedLabels);
+        if (move.addedLabels != 0)
+            m_blockCountPriorPtr->setState(m_blockCountPriorPtr->getState() + move.addedLabels);
         m_vertexCounts.decrement(move.prevLabel);
         m_vertexCounts.increment(move.nextLabel);
         m_state[move.vertexIndex] = move.nextLabel;
     }
 
-    const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override { return 0; };
+    const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override { return recordLogLikelihoodRatio(move, 0); };
     const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override {
         if (m_vertexCounts.size() + getAddedBlocks(move) > m_blockCountPriorPtr->getState() + move.addedLabels)
             return -INFINITY;
-        return getLogLikelihoodRatioFromLabelMove(move) + getLogPriorRatioFromLabelMove(move);
+        return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromLabelMove(move)) + getLogPriorRatioFromLabelMove(move);
     };
 
     void remapBlockIndex(const std::map<size_t, size_t> indexMap){
@@ -53,10 +54,7 @@ public:
     BlockPrior(size_t size, BlockCountPrior& blockCountPrior):
         m_size(size) {  setBlockCountPrior(blockCountPrior); }
     BlockPrior(): m_size(0){}
-    BlockPrior(const BlockPrior& other) {
-        setState(other.m_state);
-        this->setBlockCountPrior(*other.m_blockCountPriorPtr);
-    }
+    BlockPrior(const BlockPrior& other) = default;
     virtual ~BlockPrior(){}
     const BlockPrior& operator=(const BlockPrior& other){
         setState(other.m_state);
@@ -69,20 +67,24 @@ public:
         m_vertexCounts = computeVertexCounts(blocks);
         m_blockCountPriorPtr->setStateFromPartition(blocks);
         m_state = blocks;
+        invalidateCaches();
     }
 
     /* Accessors & mutators of attributes */
     const size_t getSize() const { return m_size; }
-    void setSize(size_t size) { m_size = size; }
+    void setSize(size_t size) { m_size = size; invalidateCaches(); }
 
     /* Accessors & mutators of accessory states */
     const BlockCountPrior& getBlockCountPrior() const { return *m_blockCountPriorPtr; }
     BlockCountPrior& getBlockCountPriorRef() const { return *m_blockCountPriorPtr; }
     void setBlockCountPrior(BlockCountPrior& blockCountPrior) {
+        invalidateCaches();
         m_blockCountPriorPtr = &blockCountPrior;
         m_blockCountPriorPtr->isRoot(false);
     }
 
+    void remapDependencies(CloneMap& cloneMap) override { cloneMap.remap(m_blockCountPriorPtr); }
+
     const size_t getBlockCount() const { return m_blockCountPriorPtr->getState(); }
     const size_t getMaxBlockCount() const { return getMaxBlockCountFromPartition(m_state); }
     const size_t getMaxBlockCountFromPartition(const BlockSequence& blocks) const { return *max_element(blocks.begin(), blocks.end()) + 1; }
@@ -122,6 +124,9 @@ public:
         m_isProcessed=false;
         m_blockCountPriorPtr->computationFinished();
     }
+    size_t getCacheEpoch() const override {
+        return m_cacheEpoch + (m_blockCountPriorPtr ? m_blockCountPriorPtr->getCacheEpoch() : 0);
+    }
 
     void checkSelfConsistency() const override {
         m_blockCountPriorPtr->checkConsistency();
@@ -159,6 +164,18 @@ public:
             setBlockCountPrior(m_blockCountDeltaPrior);
             setState(m_blocks);
         }
+    BlockDeltaPrior(const BlockDeltaPrior& other):
+        BlockPrior(other),
+        m_blocks(other.m_blocks),
+        m_blockCountDeltaPrior(other.m_blockCountDeltaPrior) {
+            if (other.m_blockCountPriorPtr == &other.m_blockCountDeltaPrior)
+                m_blockCountPriorPtr = &m_blockCountDeltaPrior;
+        }
+    BlockDeltaPrior* clone() const override { return new BlockDeltaPrior(*this); }
+    void remapDependencies(CloneMap& cloneMap) override {
+        cloneMap.insert(cloneMap.getOriginal(*this).m_blockCountDeltaPrior, m_blockCountDeltaPrior);
+        BlockPrior::remapDependencies(cloneMap);
+    }
 
     void sampleState() override { }
     const double getLogLikelihood() const override { return 0; }
@@ -171,6 +188,7 @@ public:
 class BlockUniformPrior: public BlockPrior{
 public:
     using BlockPrior::BlockPrior;
+    BlockUniformPrior* clone() const override { return new BlockUniformPrior(*this); }
     void sampleState() override ;
     const double getLogLikelihood() const override ;
     const double getLogLikelihoodRatioFromLabelMove(const BlockMove& move) const ;
@@ -181,6 +199,7 @@ protected:
     void setBlockCountFromPartition(const BlockSequence& blocks){ m_blockCountPriorPtr->setState(getEffectiveBlockCountFromPartition(blocks)); }
 public:
     using BlockPrior::BlockPrior;
+    BlockUniformHyperPrior* clone() const override { return new BlockUniformHyperPrior(*this); }
     void sampleState() override ;
     const double getLogLikelihood() const override ;
     const double getLogLikelihoodRatioFromLabelMove(const BlockMove& move) const ;
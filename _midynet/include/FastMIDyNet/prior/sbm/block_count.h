@@ -22,7 +22,7 @@ public:
 protected:
     void _applyGraphMove(const GraphMove& move) override { }
     void _applyLabelMove(const BlockMove& move) override { throw std::logic_error("BlockCount: this method should not be used."); }
-    const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override { return 0; }
+    const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override { return recordLogLikelihoodRatio(move, 0); }
     const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override { return getLogLikelihoodRatioFromLabelMove(move); }
 };
 
@@ -36,6 +36,7 @@ public:
         setState(other.m_state);
         return *this;
     }
+    BlockCountDeltaPrior* clone() const override { return new BlockCountDeltaPrior(*this); }
 
     void sampleState() override { }
 
@@ -65,11 +66,13 @@ class BlockCountPoissonPrior: public BlockCountPrior{
             setState(other.m_state);
             return *this;
         }
+        BlockCountPoissonPrior* clone() const override { return new BlockCountPoissonPrior(*this); }
 
         const double getMean() const { return m_mean; }
         void setMean(double mean){
             m_mean = mean;
             m_poissonDistribution = std::poisson_distribution<size_t>(mean);
+            invalidateCaches();
         }
         void sampleState() override;
         const double getLogLikelihoodFromState(const size_t& state) const override;
@@ -92,6 +95,7 @@ class BlockCountUniformPrior: public BlockCountPrior{
             setState(other.m_state);
             return *this;
         }
+        BlockCountUniformPrior* clone() const override { return new BlockCountUniformPrior(*this); }
 
         const double getMin() const { return m_min; }
         const double getMax() const { return m_max; }
@@ -99,11 +103,13 @@ class BlockCountUniformPrior: public BlockCountPrior{
             m_min = min;
             checkMin();
             m_uniformDistribution = std::uniform_int_distribution<size_t>(m_min, m_max);
+            invalidateCaches();
         }
         void setMax(size_t max){
             m_max = max;
             checkMax();
             m_uniformDistribution = std::uniform_int_distribution<size_t>(m_min, m_max);
+            invalidateCaches();
         }
         void setMinMax(size_t min, size_t max){
             setMin(min);
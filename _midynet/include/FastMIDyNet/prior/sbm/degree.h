@@ -18,14 +18,19 @@ protected:
     DegreeCountsMap m_degreeCounts;
     // const MultiGraph* m_graphPtr;
 
+    /* Scratch diffs reused from one move to the next. */
+    mutable FlatIntMap<BaseGraph::VertexIndex> m_diffDegreeMap;
+    mutable FlatIntMap<BlockIndex> m_diffEdgeCountsMap;
+    mutable FlatIntMap<std::pair<BlockIndex, size_t>> m_diffDegreeCountsMap;
+
     void _applyGraphMove(const GraphMove& move) override;
     void _applyLabelMove(const BlockMove& move) override;
 
     const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override{
-        return getLogLikelihoodRatioFromGraphMove(move) + getLogPriorRatioFromGraphMove(move);
+        return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromGraphMove(move)) + getLogPriorRatioFromGraphMove(move);
     }
     const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override {
-        return getLogLikelihoodRatioFromLabelMove(move) + getLogPriorRatioFromLabelMove(move);
+        return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromLabelMove(move)) + getLogPriorRatioFromLabelMove(move);
     }
 
     // void onBlockCreation(const BlockMove&) override;
@@ -42,10 +47,7 @@ public:
             setBlockPrior(blockPrior);
             setEdgeMatrixPrior(edgeMatrixPrior);
         }
-    DegreePrior(const DegreePrior& other){
-        setBlockPrior(*other.m_blockPriorPtr);
-        setEdgeMatrixPrior(*other.m_edgeMatrixPriorPtr);
-    }
+    DegreePrior(const DegreePrior& other) = default;
     virtual ~DegreePrior(){}
     const DegreePrior& operator=(const DegreePrior& other){
         setBlockPrior(*other.m_blockPriorPtr);
@@ -61,13 +63,22 @@ public:
 
     const BlockPrior& getBlockPrior() const { return *m_blockPriorPtr; }
     BlockPrior& getBlockPriorRef() const { return *m_blockPriorPtr; }
-    void setBlockPrior(BlockPrior& blockPrior) { m_blockPriorPtr = &blockPrior; m_blockPriorPtr->isRoot(false);}
+    void setBlockPrior(BlockPrior& blockPrior) {
+        invalidateCaches();
+        m_blockPriorPtr = &blockPrior;
+        m_blockPriorPtr->isRoot(false);
+    }
 
     const EdgeMatrixPrior& getEdgeMatrixPrior() const { return *m_edgeMatrixPriorPtr; }
     EdgeMatrixPrior& getEdgeMatrixPriorRef() const { return *m_edgeMatrixPriorPtr; }
     void setEdgeMatrixPrior(EdgeMatrixPrior& edgeMatrixPrior) {
+        invalidateCaches();
         m_edgeMatrixPriorPtr = &edgeMatrixPrior; m_edgeMatrixPriorPtr->isRoot(false);
     }
+    void remapDependencies(CloneMap& cloneMap) override {
+        cloneMap.remap(m_blockPriorPtr);
+        cloneMap.remap(m_edgeMatrixPriorPtr);
+    }
 
     const BlockIndex& getDegreeOfIdx(BaseGraph::VertexIndex idx) const { return m_state[idx]; }
     virtual const DegreeCountsMap& getDegreeCounts() const { return m_degreeCounts; }
@@ -86,6 +97,10 @@ public:
         m_blockPriorPtr->computationFinished();
         m_edgeMatrixPriorPtr->computationFinished();
     }
+    size_t getCacheEpoch() const override {
+        return m_cacheEpoch + (m_blockPriorPtr ? m_blockPriorPtr->getCacheEpoch() : 0)
+            + (m_edgeMatrixPriorPtr ? m_edgeMatrixPriorPtr->getCacheEpoch() : 0);
+    }
     static void checkDegreeSequenceConsistencyWithEdgeCount(const DegreeSequence&, size_t);
     static void checkDegreeSequenceConsistencyWithDegreeCounts(const DegreeSequence&, const BlockSequence&, const DegreeCountsMap&);
 
@@ -117,9 +132,10 @@ public:
         DegreePrior(){ setState(degreeSeq); }
 
     DegreeDeltaPrior(const DegreeDeltaPrior& degreeDeltaPrior):
-        DegreePrior() {
+        DegreePrior(degreeDeltaPrior) {
             setState(degreeDeltaPrior.getState());
         }
+    DegreeDeltaPrior* clone() const override { return new DegreeDeltaPrior(*this); }
     virtual ~DegreeDeltaPrior(){}
     const DegreeDeltaPrior& operator=(const DegreeDeltaPrior& other){
         this->setState(other.getState());
@@ -130,6 +146,7 @@ public:
     void setState(const DegreeSequence& degrees){
         m_degreeSeq = degrees;
         m_state = degrees;
+        invalidateCaches();
     }
     void sampleState() override { };
     void samplePriors() override { };
@@ -157,6 +174,7 @@ public:
 class DegreeUniformPrior: public DegreePrior{
 public:
     using DegreePrior::DegreePrior;
+    DegreeUniformPrior* clone() const override { return new DegreeUniformPrior(*this); }
     void sampleState() override;
 
     const double getLogLikelihood() const override;
@@ -168,6 +186,7 @@ class DegreeUniformHyperPrior: public DegreePrior{
 public:
 
     using DegreePrior::DegreePrior;
+    DegreeUniformHyperPrior* clone() const override { return new DegreeUniformHyperPrior(*this); }
     void sampleState() override;
 
     const double getLogLikelihood() const override;
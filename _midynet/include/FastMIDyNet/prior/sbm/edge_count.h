@@ -12,14 +12,14 @@ namespace FastMIDyNet{
 class EdgeCountPrior: public BlockLabeledPrior<size_t> {
 protected:
     void _applyGraphMove(const GraphMove& move) override {
-        setState(getStateAfterGraphMove(move));
+        m_state = getStateAfterGraphMove(move);
     }
     void _applyLabelMove(const BlockMove& move) override { }
 
     const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override {
-        return getLogLikelihoodRatioFromGraphMove(move);
+        return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromGraphMove(move));
     }
-    const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override { return 0; }
+    const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override { return recordLogLikelihoodRatio(move, 0); }
 
 public:
     using BlockLabeledPrior<size_t>::BlockLabeledPrior;
@@ -54,6 +54,7 @@ public:
         setState(m_edgeCount);
         return *this;
     }
+    EdgeCountDeltaPrior* clone() const override { return new EdgeCountDeltaPrior(*this); }
 
     void sampleState() override { };
     const double getLogLikelihoodFromState(const size_t& state) const override { if (state == m_state) return 0.; else return -INFINITY; };
@@ -77,11 +78,13 @@ public:
         setState(other.m_state);
         return *this;
     }
+    EdgeCountPoissonPrior* clone() const override { return new EdgeCountPoissonPrior(*this); }
 
     double getMean() const { return m_mean; }
     void setMean(double mean){
         m_mean = mean;
         m_poissonDistribution = std::poisson_distribution<size_t>(mean);
+        invalidateCaches();
     }
     void sampleState() override;
     const double getLogLikelihoodFromState(const size_t& state) const override;
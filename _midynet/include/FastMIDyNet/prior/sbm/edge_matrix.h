@@ -18,7 +18,7 @@ class EdgeMatrixPrior: public BlockLabeledPrior< MultiGraph >{
         EdgeCountPrior* m_edgeCountPriorPtr = nullptr;
         BlockPrior* m_blockPriorPtr = nullptr;
         CounterMap<size_t> m_edgeCounts;
-        const MultiGraph* m_graphPtr;
+        const MultiGraph* m_graphPtr = nullptr;
 
         void _applyGraphMove(const GraphMove& move) override {
             m_edgeCountPriorPtr->applyGraphMove(move);
@@ -32,11 +32,11 @@ class EdgeMatrixPrior: public BlockLabeledPrior< MultiGraph >{
         }
 
         const double _getLogJointRatioFromGraphMove(const GraphMove& move) const override {
-            return getLogLikelihoodRatioFromGraphMove(move) + getLogPriorRatioFromGraphMove(move);
+            return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromGraphMove(move)) + getLogPriorRatioFromGraphMove(move);
         }
 
         const double _getLogJointRatioFromLabelMove(const BlockMove& move) const override{
-            return getLogLikelihoodRatioFromLabelMove(move) + getLogPriorRatioFromLabelMove(move);
+            return recordLogLikelihoodRatio(move, getLogLikelihoodRatioFromLabelMove(move)) + getLogPriorRatioFromLabelMove(move);
         }
 
         void applyGraphMoveToState(const GraphMove&);
@@ -49,10 +49,7 @@ class EdgeMatrixPrior: public BlockLabeledPrior< MultiGraph >{
                 setEdgeCountPrior(edgeCountPrior);
                 setBlockPrior(blockPrior);
             }
-        EdgeMatrixPrior(const EdgeMatrixPrior& other){
-            setEdgeCountPrior(*other.m_edgeCountPriorPtr);
-            setBlockPrior(*other.m_blockPriorPtr);
-        }
+        EdgeMatrixPrior(const EdgeMatrixPrior& other) = default;
         const EdgeMatrixPrior& operator=(const EdgeMatrixPrior& other){
             setEdgeCountPrior(*other.m_edgeCountPriorPtr);
             setBlockPrior(*other.m_blockPriorPtr);
@@ -61,16 +58,28 @@ class EdgeMatrixPrior: public BlockLabeledPrior< MultiGraph >{
 
         const EdgeCountPrior& getEdgeCountPrior() const{ return *m_edgeCountPriorPtr; }
         EdgeCountPrior& getEdgeCountPriorRef() const{ return *m_edgeCountPriorPtr; }
-        void setEdgeCountPrior(EdgeCountPrior& edgeCountPrior) { m_edgeCountPriorPtr = &edgeCountPrior; m_edgeCountPriorPtr->isRoot(false);}
+        void setEdgeCountPrior(EdgeCountPrior& edgeCountPrior) {
+            invalidateCaches();
+            m_edgeCountPriorPtr = &edgeCountPrior;
+            m_edgeCountPriorPtr->isRoot(false);
+        }
         const BlockPrior& getBlockPrior() const{ return *m_blockPriorPtr; }
         BlockPrior& getBlockPriorRef() const{ return *m_blockPriorPtr; }
         void setBlockPrior(BlockPrior& blockPrior) {
+            invalidateCaches();
             m_blockPriorPtr = &blockPrior;
             m_blockPriorPtr->isRoot(false);
         }
+        void remapDependencies(CloneMap& cloneMap) override {
+            cloneMap.remap(m_edgeCountPriorPtr);
+            cloneMap.remap(m_blockPriorPtr);
+        }
 
         void setGraph(const MultiGraph& graph);
         const MultiGraph& getGraph() { return *m_graphPtr; }
+        /* Points the prior to a copy of its graph, such as the graph of a cloned random
+         * graph, without recomputing its state. */
+        void rebindGraph(const MultiGraph& graph) { m_graphPtr = &graph; }
         void setState(const MultiGraph&) override;
         void setPartition(const std::vector<BlockIndex>&) ;
 
@@ -98,6 +107,10 @@ class EdgeMatrixPrior: public BlockLabeledPrior< MultiGraph >{
             m_blockPriorPtr->computationFinished();
             m_edgeCountPriorPtr->computationFinished();
         }
+        size_t getCacheEpoch() const override {
+            return m_cacheEpoch + (m_blockPriorPtr ? m_blockPriorPtr->getCacheEpoch() : 0)
+                + (m_edgeCountPriorPtr ? m_edgeCountPriorPtr->getCacheEpoch() : 0);
+        }
         void checkSelfConsistencywithGraph() const;
         void checkSelfConsistency() const override;
 
@@ -126,9 +139,11 @@ public:
         EdgeMatrixPrior(edgeCountPrior, blockPrior){ setState(edgeMatrix); }
 
     EdgeMatrixDeltaPrior(const EdgeMatrixDeltaPrior& edgeMatrixDeltaPrior):
-        EdgeMatrixPrior(edgeMatrixDeltaPrior) {
+        EdgeMatrixPrior(edgeMatrixDeltaPrior),
+        m_edgeCountDeltaPrior(edgeMatrixDeltaPrior.m_edgeCountDeltaPrior) {
             setState(edgeMatrixDeltaPrior.getState());
         }
+    EdgeMatrixDeltaPrior* clone() const override { return new EdgeMatrixDeltaPrior(*this); }
     virtual ~EdgeMatrixDeltaPrior(){}
     const EdgeMatrixDeltaPrior& operator=(const EdgeMatrixDeltaPrior& other){
         this->setState(other.getState());
@@ -141,6 +156,7 @@ public:
         m_edgeCounts.clear();
         for (const auto r : m_edgeMatrix)
             m_edgeCounts.set(r, m_edgeMatrix.getDegreeOfIdx(r));
+        invalidateCaches();
         // recomputeState();
     }
     void sampleState() override { };
@@ -166,6 +182,7 @@ public:
 class EdgeMatrixUniformPrior: public EdgeMatrixPrior {
 public:
     using EdgeMatrixPrior::EdgeMatrixPrior;
+    EdgeMatrixUniformPrior* clone() const override { return new EdgeMatrixUniformPrior(*this); }
     void sampleState() override;
     const double getLogLikelihood() const override {
         return getLogLikelihood(m_blockPriorPtr->getEffectiveBlockCount(), m_edgeCountPriorPtr->getState());
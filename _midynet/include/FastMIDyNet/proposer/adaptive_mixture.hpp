@@ -0,0 +1,112 @@
+#ifndef FAST_MIDYNET_ADAPTIVE_MIXTURE_HPP
+#define FAST_MIDYNET_ADAPTIVE_MIXTURE_HPP
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "FastMIDyNet/rng.h"
+#include "FastMIDyNet/proposer/statistics.hpp"
+
+
+namespace FastMIDyNet{
+
+/* Mixing weights between move types, tuned online to maximize the number of accepted
+ * moves per unit of CPU time. While adapting, the weights are updated every
+ * `adaptationPeriod` recorded moves: each type gets a weight proportional to its
+ * acceptance rate divided by its mean cost, with a floor of `minWeight / K` so that
+ * no type is abandoned. A type that is never accepted, such as one that only yields
+ * identity moves, is left at the floor however cheap it is, and a type not yet
+ * proposed is given the acceptance rate and cost of all the moves. The weights must be frozen after the burn-in, since
+ * the chain only has the right stationary distribution for fixed weights. */
+class AdaptiveMixture{
+    std::vector<double> m_weights;
+    std::vector<ProposalCounts> m_counts;
+    double m_minWeight = 0.05;
+    size_t m_adaptationPeriod = 1000;
+    size_t m_recordCount = 0;
+    bool m_isAdapting = false;
+    mutable std::discrete_distribution<size_t> m_distribution;
+
+    void updateWeights(){
+        double meanCycles = 0;
+        size_t proposed = 0, accepted = 0;
+        for (const auto& counts: m_counts){
+            meanCycles += counts.cycles;
+            proposed += counts.proposed;
+            accepted += counts.accepted;
+        }
+        /* the weights are kept until some move is accepted */
+        if (accepted == 0)
+            return;
+        meanCycles /= proposed;
+        double meanAcceptanceRate = (double) accepted / proposed;
+
+        std::vector<double> scores(m_weights.size());
+        double totalScore = 0;
+        for (size_t type = 0; type < m_weights.size(); ++type){
+            const auto& counts = m_counts[type];
+            double acceptanceRate = (counts.proposed == 0) ? meanAcceptanceRate : counts.getAcceptanceRate();
+            double cycles = (counts.proposed == 0) ? meanCycles : counts.getMeanCycles();
+            scores[type] = acceptanceRate / std::max(cycles, 1.);
+            totalScore += scores[type];
+        }
+        for (size_t type = 0; type < m_weights.size(); ++type)
+            m_weights[type] = m_minWeight / m_weights.size() + (1 - m_minWeight) * scores[type] / totalScore;
+        m_distribution = std::discrete_distribution<size_t>(m_weights.begin(), m_weights.end());
+    }
+
+public:
+    AdaptiveMixture(const std::vector<double>& weights={1}){ setWeights(weights); }
+
+    const std::vector<double>& getWeights() const { return m_weights; }
+    const double getWeight(size_t type) const { return m_weights.at(type); }
+    void setWeights(const std::vector<double>& weights){
+        double totalWeight = 0;
+        for (auto weight: weights){
+            if (weight < 0)
+                throw std::invalid_argument("AdaptiveMixture: weights must be non-negative.");
+            totalWeight += weight;
+        }
+        if (weights.size() == 0 or totalWeight == 0)
+            throw std::invalid_argument("AdaptiveMixture: weights must have a positive sum.");
+        m_weights = weights;
+        for (auto& weight: m_weights)
+            weight /= totalWeight;
+        m_counts.assign(m_weights.size(), ProposalCounts());
+        m_recordCount = 0;
+        m_distribution = std::discrete_distribution<size_t>(m_weights.begin(), m_weights.end());
+    }
+    const size_t sample() const { return m_distribution(rng); }
+
+    void startAdaptation(size_t adaptationPeriod=1000, double minWeight=0.05){
+        if (adaptationPeriod == 0)
+            throw std::invalid_argument("AdaptiveMixture: `adaptationPeriod` must be positive.");
+        if (minWeight < 0 or minWeight > 1)
+            throw std::invalid_argument("AdaptiveMixture: `minWeight` must be between 0 and 1.");
+        m_adaptationPeriod = adaptationPeriod;
+        m_minWeight = minWeight;
+        m_counts.assign(m_weights.size(), ProposalCounts());
+        m_recordCount = 0;
+        m_isAdapting = true;
+    }
+    void freeze() { m_isAdapting = false; }
+    const bool isAdapting() const { return m_isAdapting; }
+
+    void record(size_t type, bool accepted, uint64_t cycles){
+        if (not m_isAdapting)
+            return;
+        auto& counts = m_counts.at(type);
+        ++counts.proposed;
+        counts.accepted += accepted;
+        counts.cycles += cycles;
+        if (++m_recordCount % m_adaptationPeriod == 0)
+            updateWeights();
+    }
+    const ProposalCounts& getCounts(size_t type) const { return m_counts.at(type); }
+};
+
+}
+
+#endif
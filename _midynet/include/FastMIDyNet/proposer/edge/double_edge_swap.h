@@ -3,31 +3,47 @@
 
 #include "edge_proposer.h"
 #include "FastMIDyNet/proposer/sampler/edge_sampler.h"
-#include "SamplableSet.hpp"
 #include "hash_specialization.hpp"
 
 
 namespace FastMIDyNet {
 
 class DoubleEdgeSwapProposer: public EdgeProposer {
+public:
+    enum MoveCategory { TRIVIAL, DOUBLE_LOOPY, SINGLE_LOOPY, HINGE, DOUBLE_EDGE, NORMAL };
+    /* Swap with its category and the multiplicities of its edges before the swap. */
+    struct SwapMove {
+        GraphMove move;
+        MoveCategory category;
+        double removedEdgeWeights[2];
+        double addedEdgeWeights[2];
+    };
 private:
     mutable std::bernoulli_distribution m_swapOrientationDistribution = std::bernoulli_distribution(.5);
-    bool isTrivialMove(const GraphMove&) const;
-    bool isHingeMove(const GraphMove&) const;
-    const double getLogPropForNormalMove(const GraphMove& move) const ;
-    const double getLogPropForDoubleLoopyMove(const GraphMove& move) const ;
-    const double getLogPropForDoubleEdgeMove(const GraphMove& move) const ;
+    /* Last proposed swap, whose ratio is computed without looking up its edges again
+     * as long as no move was applied since. */
+    mutable SwapMove m_lastSwapMove;
+    mutable bool m_hasLastSwapMove = false;
+    const SwapMove& getSwapMove(const GraphMove& move, SwapMove& swapMove) const;
 
 protected:
-    mutable EdgeSampler m_edgeSampler;
+    EdgeSampler m_edgeSampler;
 public:
     using EdgeProposer::EdgeProposer;
+    DoubleEdgeSwapProposer* clone() const override { return new DoubleEdgeSwapProposer(*this); }
     const GraphMove proposeRawMove() const override;
+    const SwapMove proposeSwapMove() const;
+    const SwapMove describeMove(const GraphMove& move) const;
     void setUp(const MultiGraph&) override;
     const double getLogProposalProbRatio(const GraphMove& move) const override ;
+    const double getLogProposalProbRatio(const SwapMove& swapMove) const ;
+    const size_t getMoveCategory(const GraphMove& move) const override ;
+    const std::vector<std::string> getMoveCategoryNames() const override {
+        return {"trivial", "double_loopy", "single_loopy", "hinge", "double_edge", "normal"};
+    }
 
     void applyGraphMove(const GraphMove&) override;
-    void clear() override { m_edgeSampler.clear(); }
+    void clear() override { m_edgeSampler.clear(); m_hasLastSwapMove = false; }
 };
 
 
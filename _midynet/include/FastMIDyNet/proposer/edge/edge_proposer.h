@@ -9,6 +9,7 @@
 #include "FastMIDyNet/types.h"
 #include "FastMIDyNet/exceptions.h"
 #include "FastMIDyNet/random_graph/random_graph.hpp"
+#include "FastMIDyNet/dynamics/types.h"
 
 
 namespace FastMIDyNet{
@@ -35,12 +36,22 @@ public:
     }
     // virtual void setUp( const RandomGraph& randomGraph ) { clear(); setUpFromGraph(randomGraph.getGraph()); }
     virtual void setUp( const MultiGraph& graph ) { clear(); m_graphPtr = &graph; }
+    /* Called before `setUp` with the time series of the dynamics, for proposers that use it. */
+    virtual void setUpStates(const StateSequence& pastStates, const StateSequence& futureStates) { }
+    /* Called before `setUp` with the labeled graph prior, for proposers that follow its labels. */
+    virtual void setUpLabels(const VertexLabeledRandomGraph<BlockIndex>& graphPrior) { }
     virtual void applyGraphMove(const GraphMove& move) {};
-    // virtual void applyBlockMove(const BlockMove& move) {};
+    virtual void applyLabelMove(const BlockMove& move) {};
     const bool& allowSelfLoops() const { return m_allowSelfLoops; }
     const bool& allowMultiEdges() const { return m_allowMultiEdges; }
 
     virtual void clear() override { m_graphPtr = nullptr; }
+    /* A clone is not set up: it is set up again on the graph of its own random graph. */
+    void remapDependencies(CloneMap& cloneMap) override {
+        clear();
+        m_graphPtr = nullptr;
+        clearProposalStatistics();
+    }
     bool isSafe() const override {
         return (m_graphPtr != nullptr);
     }
@@ -13,6 +13,8 @@
 namespace FastMIDyNet {
 
 class HingeFlipProposer: public EdgeProposer {
+public:
+    enum MoveCategory { TRIVIAL, LOOPY, SELFIE, NORMAL };
 private:
     mutable std::bernoulli_distribution m_flipOrientationDistribution = std::bernoulli_distribution(.5);
     bool isTrivialMove(const GraphMove&) const;
@@ -23,8 +25,6 @@ private:
 protected:
     EdgeSampler m_edgeSampler;
     VertexSampler* m_vertexSamplerPtr = nullptr;
-    mutable std::map<BaseGraph::Edge, size_t> m_edgeProposalCounter;
-    mutable std::map<BaseGraph::VertexIndex, size_t> m_vertexProposalCounter;
 public:
     using EdgeProposer::EdgeProposer;
     const GraphMove proposeRawMove() const override;
@@ -35,11 +35,9 @@ public:
     const double getLogProposalProbRatio(const GraphMove& move) const override ;
     virtual const double getLogVertexWeightRatio(const GraphMove& move) const = 0;
 
-    const std::map<BaseGraph::Edge, size_t>& getEdgeProposalCounts() const {
-        return m_edgeProposalCounter;
-    }
-    const std::map<BaseGraph::VertexIndex, size_t>& getVertexProposalCounts() const {
-        return m_vertexProposalCounter;
+    const size_t getMoveCategory(const GraphMove& move) const override ;
+    const std::vector<std::string> getMoveCategoryNames() const override {
+        return {"trivial", "loopy", "selfie", "normal"};
     }
     void checkSelfSafety() const override {
         EdgeProposer::checkSelfSafety();
@@ -68,6 +66,10 @@ private:
 public:
     HingeFlipUniformProposer(bool allowSelfLoops=true, bool allowMultiEdges=true):
         HingeFlipProposer(allowSelfLoops, allowMultiEdges){ m_vertexSamplerPtr = &m_vertexUniformSampler; }
+    HingeFlipUniformProposer(const HingeFlipUniformProposer& other):
+        HingeFlipProposer(other),
+        m_vertexUniformSampler(other.m_vertexUniformSampler){ m_vertexSamplerPtr = &m_vertexUniformSampler; }
+    HingeFlipUniformProposer* clone() const override { return new HingeFlipUniformProposer(*this); }
     virtual ~HingeFlipUniformProposer(){}
     const double getLogVertexWeightRatio(const GraphMove& move) const override { return 0; }
 
@@ -82,6 +84,10 @@ public:
     HingeFlipDegreeProposer(bool allowSelfLoops=true, bool allowMultiEdges=true, double shift=1):
         HingeFlipProposer(allowSelfLoops, allowMultiEdges),
         m_vertexDegreeSampler(shift){ m_vertexSamplerPtr = &m_vertexDegreeSampler; }
+    HingeFlipDegreeProposer(const HingeFlipDegreeProposer& other):
+        HingeFlipProposer(other),
+        m_vertexDegreeSampler(other.m_vertexDegreeSampler){ m_vertexSamplerPtr = &m_vertexDegreeSampler; }
+    HingeFlipDegreeProposer* clone() const override { return new HingeFlipDegreeProposer(*this); }
     virtual ~HingeFlipDegreeProposer(){}
     const double getLogVertexWeightRatio(const GraphMove& move) const override {
         BaseGraph::VertexIndex gainingVertex = move.addedEdges[0].second;
@@ -0,0 +1,78 @@
+#ifndef FAST_MIDYNET_INFORMED_EDGE_H
+#define FAST_MIDYNET_INFORMED_EDGE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "edge_proposer.h"
+#include "util.h"
+#include "FastMIDyNet/dynamics/types.h"
+#include "FastMIDyNet/proposer/sampler/edge_sampler.h"
+
+
+namespace FastMIDyNet {
+
+typedef std::vector<std::vector<std::pair<BaseGraph::VertexIndex, double>>> CandidateNeighborList;
+
+/* Single edge proposer that adds edges preferentially between vertices whose states
+ * are correlated in the time series. The co-activation score of a pair (i, j) counts
+ * the steps where one of them is active (state > 0) while the other changes state.
+ * The `candidateCount` best scored neighbors of each vertex are kept as candidate
+ * edges, weighted by their score.
+ *
+ * Additions and removals are proposed with probability 1/2. An addition picks a
+ * candidate edge, or with probability `uniformProb` a uniformly random pair of
+ * vertices; a removal picks an existing edge proportionally to its multiplicity.
+ * Additions that would create a forbidden self-loop or multiedge, and removals in
+ * an empty graph, are proposed as identity moves. */
+class InformedEdgeProposer: public EdgeProposer {
+public:
+    enum MoveCategory { ADDITION, REMOVAL, IDENTITY };
+private:
+    const size_t m_candidateCount;
+    const double m_uniformProb;
+    const size_t m_numThreads;
+    mutable std::bernoulli_distribution m_addOrRemoveDistribution = std::bernoulli_distribution(.5);
+    std::vector<uint64_t> m_activeStates, m_changedStates;
+
+    const double getLogAdditionProb(const BaseGraph::Edge& edge) const;
+    const double getUniformProb() const { return (m_candidateSampler.getTotalWeight() == 0) ? 1 : m_uniformProb; }
+protected:
+    EdgeSampler m_edgeSampler;
+    EdgeSampler m_candidateSampler;
+public:
+    InformedEdgeProposer(bool allowSelfLoops=true, bool allowMultiEdges=true, size_t candidateCount=10, double uniformProb=0.1, size_t numThreads=0);
+    InformedEdgeProposer* clone() const override { return new InformedEdgeProposer(*this); }
+    const GraphMove proposeMove() const override { return proposeRawMove(); }
+    const GraphMove proposeRawMove() const override;
+    const double getLogProposalProbRatio(const GraphMove& move) const override;
+    void setUp(const MultiGraph& graph) override;
+    void setUpStates(const StateSequence& pastStates, const StateSequence& futureStates) override;
+    void applyGraphMove(const GraphMove& move) override;
+
+    const size_t getMoveCategory(const GraphMove& move) const override {
+        if (move.addedEdges.size() != 0)
+            return ADDITION;
+        return (move.removedEdges.size() != 0) ? REMOVAL : IDENTITY;
+    }
+    const std::vector<std::string> getMoveCategoryNames() const override { return {"addition", "removal", "identity"}; }
+
+    const size_t getCandidateCount() const { return m_candidateCount; }
+    const double getUniformProposalProb() const { return m_uniformProb; }
+    const EdgeSampler& getCandidateSampler() const { return m_candidateSampler; }
+
+    static CandidateNeighborList computeCandidateNeighbors(
+        const StateSequence& pastStates, const StateSequence& futureStates,
+        size_t candidateCount, size_t numThreads=0
+    );
+
+    void checkSelfConsistency() const override {
+        checkEdgeSamplerConsistencyWithGraph("InformedEdgeProposer", *m_graphPtr, m_edgeSampler);
+    }
+    void clear() override { m_edgeSampler.clear(); }
+};
+
+} // namespace FastMIDyNet
+
+
+#endif
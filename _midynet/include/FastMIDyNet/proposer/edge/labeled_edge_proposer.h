@@ -1,11 +1,10 @@
 #ifndef FAST_MIDYNET_LABELED_EDGE_PROPOSER_H
 #define FAST_MIDYNET_LABELED_EDGE_PROPOSER_H
 
-#include <map>
+#include <vector>
 #include "edge_proposer.h"
 #include "FastMIDyNet/proposer/sampler/edge_sampler.h"
 #include "FastMIDyNet/proposer/sampler/vertex_sampler.h"
-#include "FastMIDyNet/proposer/sampler/label_sampler.h"
 #include "FastMIDyNet/utility/functions.h"
 #include "FastMIDyNet/utility/maps.hpp"
 
@@ -13,33 +12,48 @@ namespace FastMIDyNet{
 
 using LabelPair = std::pair<BlockIndex, BlockIndex>;
 
+/* Base class of the edge proposers that follow the labels of a vertex-labeled graph
+ * prior. The vertices of each label are kept in dense arrays, updated by
+ * `applyLabelMove`, so that a vertex of a given label is sampled in constant time. */
 class LabeledEdgeProposer: public EdgeProposer{
-// protected:
-//     LabelPairSampler m_labelSampler;
-// public:
-//     LabeledEdgeProposer(
-//         bool allowSelfLoops=true,
-//         bool allowMultiEdges=true,
-//         double labelPairShift=1):
-//             EdgeProposer(allowSelfLoops, allowMultiEdges),
-//             m_labelSampler(labelPairShift){ }
-//     virtual ~LabeledEdgeProposer(){ }
-//     virtual void setUp( const RandomGraph& randomGraph ) {
-//         clear();
-//         m_labelSampler.setUp(randomGraph);
-//         setUpFromGraph(randomGraph.getGraph());
-//     }
-//     virtual void setUpFromGraph(const MultiGraph& graph){
-//         EdgeProposer::setUpFromGraph(graph);
-//     }
-//     virtual void onLabelCreation(const BlockMove& move) { };
-//     virtual void onLabelDeletion(const BlockMove& move) { };
-//     virtual void clear() { m_labelSampler.clear(); }
-
+protected:
+    const VertexLabeledRandomGraph<BlockIndex>* m_graphPriorPtr = nullptr;
+    std::vector<std::vector<BaseGraph::VertexIndex>> m_labelVertices;
+    std::vector<size_t> m_vertexPositions;
+
+    void insertVertex(BaseGraph::VertexIndex vertex, BlockIndex label);
+    void eraseVertex(BaseGraph::VertexIndex vertex, BlockIndex label);
+public:
+    using EdgeProposer::EdgeProposer;
+    virtual ~LabeledEdgeProposer(){ }
+
+    void setUpLabels(const VertexLabeledRandomGraph<BlockIndex>& graphPrior) override;
+    void applyLabelMove(const BlockMove& move) override;
+    void remapDependencies(CloneMap& cloneMap) override {
+        EdgeProposer::remapDependencies(cloneMap);
+        m_graphPriorPtr = nullptr;
+        m_labelVertices.clear();
+        m_vertexPositions.clear();
+    }
+
+    const BlockIndex& getLabelOfIdx(BaseGraph::VertexIndex vertex) const { return m_graphPriorPtr->getLabelOfIdx(vertex); }
+    const size_t getLabelSize(BlockIndex label) const {
+        return (label < m_labelVertices.size()) ? m_labelVertices[label].size() : 0;
+    }
+    const std::vector<BaseGraph::VertexIndex>& getVerticesWithLabel(BlockIndex label) const { return m_labelVertices.at(label); }
+    BaseGraph::VertexIndex sampleVertexWithLabel(BlockIndex label) const;
+
+    bool isSafe() const override {
+        return EdgeProposer::isSafe() and (m_graphPriorPtr != nullptr);
+    }
+    void checkSelfSafety() const override {
+        EdgeProposer::checkSelfSafety();
+        if (m_graphPriorPtr == nullptr)
+            throw SafetyError("LabeledEdgeProposer: unsafe usage since `m_graphPriorPtr` is NULL");
+    }
+    void checkSelfConsistency() const override;
 };
 
-
-
 }
 
 #endif
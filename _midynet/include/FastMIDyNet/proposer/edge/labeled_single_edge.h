@@ -0,0 +1,67 @@
+#ifndef FAST_MIDYNET_LABELED_SINGLE_EDGE_H
+#define FAST_MIDYNET_LABELED_SINGLE_EDGE_H
+
+#include "labeled_edge_proposer.h"
+#include "util.h"
+#include "FastMIDyNet/proposer/sampler/edge_sampler.h"
+
+
+namespace FastMIDyNet {
+
+/* Single edge proposer that adds edges between the label pairs where the edge matrix
+ * of the graph prior puts its mass. An addition picks the label pair (r, s) with
+ * weight e_rs + shift * v_rs, where v_rs is the number of ordered pairs of vertices
+ * with labels {r, s}, and then a uniform vertex of each label. This is done by taking
+ * the labels of an existing edge, or those of two uniform vertices with probability
+ * shift * N^2 / (E + shift * N^2).
+ *
+ * Additions and removals are proposed with probability 1/2, and removals pick an
+ * existing edge proportionally to its multiplicity. Additions that would create a
+ * forbidden self-loop or multiedge, and removals in an empty graph, are proposed as
+ * identity moves. */
+class LabeledSingleEdgeProposer: public LabeledEdgeProposer {
+public:
+    enum MoveCategory { ADDITION, REMOVAL, IDENTITY };
+private:
+    const double m_labelPairShift;
+    mutable std::bernoulli_distribution m_addOrRemoveDistribution = std::bernoulli_distribution(.5);
+
+    const double getLogAdditionProb(const BaseGraph::Edge& edge, int edgeCountOffset=0) const;
+protected:
+    EdgeSampler m_edgeSampler;
+public:
+    LabeledSingleEdgeProposer(bool allowSelfLoops=true, bool allowMultiEdges=true, double labelPairShift=1);
+    LabeledSingleEdgeProposer* clone() const override { return new LabeledSingleEdgeProposer(*this); }
+    const GraphMove proposeMove() const override { return proposeRawMove(); }
+    const GraphMove proposeRawMove() const override;
+    const double getLogProposalProbRatio(const GraphMove& move) const override;
+    /* Throws if the labels were not set up first, since the proposer cannot be used
+     * without a labeled graph prior. */
+    void setUp(const MultiGraph& graph) override;
+    void applyGraphMove(const GraphMove& move) override;
+
+    const size_t getMoveCategory(const GraphMove& move) const override {
+        if (move.addedEdges.size() != 0)
+            return ADDITION;
+        return (move.removedEdges.size() != 0) ? REMOVAL : IDENTITY;
+    }
+    const std::vector<std::string> getMoveCategoryNames() const override { return {"addition", "removal", "identity"}; }
+
+    const double getLabelPairShift() const { return m_labelPairShift; }
+    const double getLabelPairWeight(BlockIndex r, BlockIndex s) const;
+    const double getTotalLabelPairWeight() const {
+        double size = m_graphPtr->getSize();
+        return m_edgeSampler.getTotalWeight() + m_labelPairShift * size * size;
+    }
+
+    void checkSelfConsistency() const override {
+        LabeledEdgeProposer::checkSelfConsistency();
+        checkEdgeSamplerConsistencyWithGraph("LabeledSingleEdgeProposer", *m_graphPtr, m_edgeSampler);
+    }
+    void clear() override { m_edgeSampler.clear(); }
+};
+
+} // namespace FastMIDyNet
+
+
+#endif
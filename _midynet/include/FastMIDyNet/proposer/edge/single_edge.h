@@ -12,6 +12,8 @@
 namespace FastMIDyNet {
 
 class SingleEdgeProposer: public EdgeProposer {
+public:
+    enum MoveCategory { ADDITION, REMOVAL };
 private:
     mutable std::bernoulli_distribution m_addOrRemoveDistribution = std::bernoulli_distribution(.5);
 protected:
@@ -22,6 +24,10 @@ public:
     void setUp(const MultiGraph&) override;
     void setVertexSampler(VertexSampler& vertexSampler){ m_vertexSamplerPtr = &vertexSampler; }
     virtual void applyGraphMove(const GraphMove& move) override { };
+    const size_t getMoveCategory(const GraphMove& move) const override {
+        return (move.removedEdges.size() == 0) ? ADDITION : REMOVAL;
+    }
+    const std::vector<std::string> getMoveCategoryNames() const override { return {"addition", "removal"}; }
     // void applyBlockMove(const BlockMove& move) override { };
 
     void checkSelfSafety() const override {
@@ -40,6 +46,10 @@ private:
 public:
     SingleEdgeUniformProposer(bool allowSelfLoops=true, bool allowMultiEdges=true):
         SingleEdgeProposer(allowSelfLoops, allowMultiEdges){ m_vertexSamplerPtr = &m_vertexUniformSampler; }
+    SingleEdgeUniformProposer(const SingleEdgeUniformProposer& other):
+        SingleEdgeProposer(other),
+        m_vertexUniformSampler(other.m_vertexUniformSampler){ m_vertexSamplerPtr = &m_vertexUniformSampler; }
+    SingleEdgeUniformProposer* clone() const override { return new SingleEdgeUniformProposer(*this); }
     virtual ~SingleEdgeUniformProposer(){}
 
     const double getLogProposalProbRatio(const GraphMove&move) const override;
@@ -52,6 +62,10 @@ public:
     SingleEdgeDegreeProposer(bool allowSelfLoops=true, bool allowMultiEdges=true, double shift=1):
         SingleEdgeProposer(allowSelfLoops, allowMultiEdges),
         m_vertexDegreeSampler(shift){ m_vertexSamplerPtr = &m_vertexDegreeSampler; }
+    SingleEdgeDegreeProposer(const SingleEdgeDegreeProposer& other):
+        SingleEdgeProposer(other),
+        m_vertexDegreeSampler(other.m_vertexDegreeSampler){ m_vertexSamplerPtr = &m_vertexDegreeSampler; }
+    SingleEdgeDegreeProposer* clone() const override { return new SingleEdgeDegreeProposer(*this); }
 
     virtual ~SingleEdgeDegreeProposer(){}
 
@@ -61,6 +75,53 @@ public:
     const double getGammaRatio(BaseGraph::Edge edge, const double difference=1) const ;
 };
 
+/* Single edge proposer restricted to simple graphs, for small dense graphs. Every pair
+ * of vertices (including self-loops if allowed) is stored in one of two dense arrays,
+ * the existing edges and the non-edges, with a bitset marking the edges. Additions and
+ * removals are proposed with probability 1/2, each drawing uniformly from its array,
+ * so that no proposal is ever rejected or retried. The memory is linear in the number
+ * of pairs of vertices. */
+class SingleEdgeSimpleProposer: public EdgeProposer{
+public:
+    enum MoveCategory { ADDITION, REMOVAL, IDENTITY };
+private:
+    mutable std::bernoulli_distribution m_addOrRemoveDistribution = std::bernoulli_distribution(.5);
+    std::vector<size_t> m_edges, m_nonEdges, m_positions;
+    std::vector<bool> m_isEdge;
+
+    void insertPair(size_t pairIndex, bool isEdge);
+    void erasePair(size_t pairIndex);
+    const double getAdditionProb(double edgeCount, double nonEdgeCount) const {
+        return (nonEdgeCount == 0) ? 0 : ((edgeCount == 0) ? 1 : .5);
+    }
+    const double getRemovalProb(double edgeCount, double nonEdgeCount) const {
+        return (edgeCount == 0) ? 0 : ((nonEdgeCount == 0) ? 1 : .5);
+    }
+public:
+    SingleEdgeSimpleProposer(bool allowSelfLoops=false): EdgeProposer(allowSelfLoops, false){ }
+    SingleEdgeSimpleProposer* clone() const override { return new SingleEdgeSimpleProposer(*this); }
+    const GraphMove proposeMove() const override { return proposeRawMove(); }
+    const GraphMove proposeRawMove() const override;
+    const double getLogProposalProbRatio(const GraphMove& move) const override;
+    void setUp(const MultiGraph& graph) override;
+    void applyGraphMove(const GraphMove& move) override;
+
+    const size_t getMoveCategory(const GraphMove& move) const override {
+        if (move.addedEdges.size() != 0)
+            return ADDITION;
+        return (move.removedEdges.size() != 0) ? REMOVAL : IDENTITY;
+    }
+    const std::vector<std::string> getMoveCategoryNames() const override { return {"addition", "removal", "identity"}; }
+
+    const size_t getPairIndex(BaseGraph::Edge edge) const;
+    const BaseGraph::Edge getPair(size_t pairIndex) const;
+    const size_t getPairCount() const { return m_isEdge.size(); }
+    const size_t getEdgeCount() const { return m_edges.size(); }
+    bool isEdge(const BaseGraph::Edge& edge) const { return m_isEdge[getPairIndex(edge)]; }
+
+    void checkSelfConsistency() const override;
+    void clear() override { m_edges.clear(); m_nonEdges.clear(); m_positions.clear(); m_isEdge.clear(); }
+};
 
 } // namespace FastMIDyNet
 
@@ -13,6 +13,8 @@ namespace FastMIDyNet {
 
 template<typename Label>
 class LabelProposer: public Proposer<LabelMove<Label>> {
+public:
+    enum MoveCategory { NORMAL, CREATION, DESTRUCTION };
 protected:
     const VertexLabeledRandomGraph<Label>* m_graphPriorPtr = nullptr;
     mutable std::uniform_int_distribution<BaseGraph::VertexIndex> m_vertexDistribution;
@@ -31,8 +33,18 @@ public:
     }
     virtual const double getLogProposalProb(const LabelMove<Label>& move, bool reverse=false) const = 0;
     const double getSampleLabelCountProb() const { return m_sampleLabelCountProb; }
+    /* A clone is not set up: it is set up again on the clone of the graph prior. */
+    void remapDependencies(CloneMap& cloneMap) override {
+        m_graphPriorPtr = nullptr;
+        this->clearProposalStatistics();
+    }
     virtual void applyLabelMove(const LabelMove<Label>& move) { };
-
+    /* Called by the reconstruction MCMC on every accepted graph move. */
+    virtual void applyGraphMove(const GraphMove& move) { };
+    const size_t getMoveCategory(const LabelMove<Label>& move) const override {
+        return (move.addedLabels > 0) ? CREATION : ((move.addedLabels < 0) ? DESTRUCTION : NORMAL);
+    }
+    const std::vector<std::string> getMoveCategoryNames() const override { return {"normal", "creation", "destruction"}; }
 
     const LabelMove<Label> proposeMove() const {
         BaseGraph::VertexIndex vertex = m_vertexDistribution(rng);
@@ -100,6 +112,10 @@ protected:
 
 public:
     using LabelProposer<Label>::LabelProposer;
+    const size_t getMoveCategory(const LabelMove<Label>& move) const override {
+        int addedLabels = getAddedLabels(move);
+        return (addedLabels > 0) ? BaseClass::CREATION : ((addedLabels < 0) ? BaseClass::DESTRUCTION : BaseClass::NORMAL);
+    }
     const LabelMove<Label> proposeNewLabelMove(const BaseGraph::VertexIndex& vertex) const override {
         Label prevLabel = m_graphPriorPtr->getLabelOfIdx(vertex);
         Label nextLabel = *sampleUniformlyFrom(m_emptyLabels.begin(), m_emptyLabels.end());
@@ -8,26 +8,46 @@
 #include "FastMIDyNet/exceptions.h"
 #include "FastMIDyNet/proposer/movetypes.h"
 #include "FastMIDyNet/proposer/label/label_proposer.hpp"
+#include "FastMIDyNet/proposer/sampler/edge_sampler.h"
+#include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/maps.hpp"
 #include "FastMIDyNet/random_graph/random_graph.hpp"
 
 namespace FastMIDyNet {
 
+/* Label sampler that picks the label of a random neighbor t, and then a label s with
+ * probability proportional to E_ts + shift. The labels of the neighbors of each vertex
+ * are cached, as well as a sampler of the label graph neighbors of each label, so that
+ * proposals do not walk the adjacency of the vertex. The caches are updated
+ * incrementally by `applyLabelMoveToSampler` and `applyGraphMoveToSampler`. */
 template<typename Label>
 class MixedSampler{
 protected:
     double m_shift;
     const VertexLabeledRandomGraph<Label>** m_graphPriorPtrPtr = nullptr;
     mutable std::uniform_real_distribution<double> m_uniform01 = std::uniform_real_distribution<double>(0, 1);
+    std::vector<CounterMap<Label>> m_neighborLabelCounts;
+    std::vector<size_t> m_neighborCounts, m_selfLoopCounts;
+    std::vector<EdgeSampler> m_labelGraphSamplers;
 
     Label sampleNeighborLabel(BaseGraph::VertexIndex vertex) const {
-        size_t degree = (*m_graphPriorPtrPtr)->getGraph().getDegreeOfIdx(vertex);
-        size_t counter = std::uniform_int_distribution<size_t>(0, degree-1)(rng);
-        for (const auto& neighbor : (*m_graphPriorPtrPtr)->getGraph().getNeighboursOfIdx(vertex)){
-            counter -= neighbor.label;
-            if (counter < 0)
-                return (*m_graphPriorPtrPtr)->getLabelOfIdx(neighbor.vertexIndex);
+        size_t counter = std::uniform_int_distribution<size_t>(0, m_neighborCounts[vertex] - 1)(rng);
+        for (const auto& neighborLabelCount : m_neighborLabelCounts[vertex]){
+            if (counter < neighborLabelCount.second)
+                return neighborLabelCount.first;
+            counter -= neighborLabelCount.second;
         }
-        return  (*m_graphPriorPtrPtr)->getLabelOfIdx(vertex);
+        throw std::logic_error("MixedSampler: neighbor label counts of vertex "
+            + std::to_string(vertex) + " do not sum to its degree.");
+    }
+    /* Number of edges between labels r and s, counted twice when r == s. */
+    const double getLabelPairWeight(Label r, Label s) const {
+        return (r < m_labelGraphSamplers.size()) ? m_labelGraphSamplers[r].getEdgeWeight(getOrderedEdge({r, s})) : 0;
+    }
+    void addToLabelPair(Label r, Label s, int edgeCount);
+    void addToNeighborLabel(BaseGraph::VertexIndex vertex, Label label, int edgeCount){
+        m_neighborLabelCounts[vertex].increment(label, edgeCount);
+        m_neighborCounts[vertex] += edgeCount;
     }
 
     virtual const Label sampleLabelUniformly() const = 0;
@@ -36,10 +56,13 @@ protected:
     const double _getLogProposalProbForMove(const LabelMove<Label>& move) const ;
     const double _getLogProposalProbForReverseMove(const LabelMove<Label>& move) const ;
     const LabelMove<Label> _proposeLabelMove(const BaseGraph::VertexIndex&) const ;
-    IntMap<std::pair<Label, Label>> getEdgeMatrixDiff(const LabelMove<Label>& move) const ;
-    IntMap<Label> getEdgeCountsDiff(const LabelMove<Label>& move) const ;
     virtual const size_t getAvailableLabelCount() const = 0;
 
+    void setUpSampler();
+    void applyLabelMoveToSampler(const LabelMove<Label>& move);
+    void applyGraphMoveToSampler(const GraphMove& move);
+    void checkSamplerConsistency() const;
+
     bool creatingNewLabel(const LabelMove<Label>& move) const {
         return (*m_graphPriorPtrPtr)->getLabelCounts().get(move.nextLabel) == 0;
     };
@@ -52,46 +75,149 @@ protected:
     const double getShift() const { return m_shift; }
 };
 
+template<typename Label>
+void MixedSampler<Label>::addToLabelPair(Label r, Label s, int edgeCount){
+    if (edgeCount == 0)
+        return;
+    auto edge = getOrderedEdge({r, s});
+    for (Label label : {r, s}){
+        if (label >= m_labelGraphSamplers.size())
+            m_labelGraphSamplers.resize(label + 1);
+        double weight = m_labelGraphSamplers[label].getEdgeWeight(edge) + edgeCount * ((r == s) ? 2 : 1);
+        if (weight > 0)
+            m_labelGraphSamplers[label].onEdgeInsertion(edge, weight);
+        else if (m_labelGraphSamplers[label].contains(edge))
+            m_labelGraphSamplers[label].onEdgeErasure(edge);
+        if (r == s)
+            break;
+    }
+}
+
+template<typename Label>
+void MixedSampler<Label>::setUpSampler(){
+    const auto& graph = (*m_graphPriorPtrPtr)->getGraph();
+    const auto& labels = (*m_graphPriorPtrPtr)->getLabels();
+    m_neighborLabelCounts.assign(graph.getSize(), CounterMap<Label>());
+    m_neighborCounts.assign(graph.getSize(), 0);
+    m_selfLoopCounts.assign(graph.getSize(), 0);
+    m_labelGraphSamplers.clear();
+    for (auto vertex : graph){
+        for (auto neighbor : graph.getNeighboursOfIdx(vertex)){
+            if (vertex == neighbor.vertexIndex){
+                m_selfLoopCounts[vertex] += neighbor.label;
+                addToLabelPair(labels[vertex], labels[vertex], neighbor.label);
+                continue;
+            }
+            addToNeighborLabel(vertex, labels[neighbor.vertexIndex], neighbor.label);
+            if (vertex < neighbor.vertexIndex)
+                addToLabelPair(labels[vertex], labels[neighbor.vertexIndex], neighbor.label);
+        }
+    }
+}
+
+template<typename Label>
+void MixedSampler<Label>::applyLabelMoveToSampler(const LabelMove<Label>& move){
+    if (move.prevLabel == move.nextLabel)
+        return;
+    for (const auto& neighborLabelCount : m_neighborLabelCounts[move.vertexIndex]){
+        addToLabelPair(move.prevLabel, neighborLabelCount.first, -neighborLabelCount.second);
+        addToLabelPair(move.nextLabel, neighborLabelCount.first, neighborLabelCount.second);
+    }
+    addToLabelPair(move.prevLabel, move.prevLabel, -m_selfLoopCounts[move.vertexIndex]);
+    addToLabelPair(move.nextLabel, move.nextLabel, m_selfLoopCounts[move.vertexIndex]);
+
+    for (auto neighbor : (*m_graphPriorPtrPtr)->getGraph().getNeighboursOfIdx(move.vertexIndex)){
+        if (neighbor.vertexIndex == move.vertexIndex)
+            continue;
+        addToNeighborLabel(neighbor.vertexIndex, move.prevLabel, -neighbor.label);
+        addToNeighborLabel(neighbor.vertexIndex, move.nextLabel, neighbor.label);
+    }
+}
+
+template<typename Label>
+void MixedSampler<Label>::applyGraphMoveToSampler(const GraphMove& move){
+    const auto& labels = (*m_graphPriorPtrPtr)->getLabels();
+    for (int edgeCount : {-1, 1}){
+        for (auto edge : (edgeCount < 0) ? move.removedEdges : move.addedEdges){
+            addToLabelPair(labels[edge.first], labels[edge.second], edgeCount);
+            if (edge.first == edge.second){
+                m_selfLoopCounts[edge.first] += edgeCount;
+                continue;
+            }
+            addToNeighborLabel(edge.first, labels[edge.second], edgeCount);
+            addToNeighborLabel(edge.second, labels[edge.first], edgeCount);
+        }
+    }
+}
+
+template<typename Label>
+void MixedSampler<Label>::checkSamplerConsistency() const {
+    if (*m_graphPriorPtrPtr == nullptr)
+        return;
+    const auto& graph = (*m_graphPriorPtrPtr)->getGraph();
+    const auto& labels = (*m_graphPriorPtrPtr)->getLabels();
+    const auto& labelGraph = (*m_graphPriorPtrPtr)->getLabelGraph();
+    for (auto vertex : graph){
+        CounterMap<Label> neighborLabelCounts;
+        size_t selfLoopCount = 0;
+        for (auto neighbor : graph.getNeighboursOfIdx(vertex)){
+            if (vertex == neighbor.vertexIndex)
+                selfLoopCount += neighbor.label;
+            else
+                neighborLabelCounts.increment(labels[neighbor.vertexIndex], neighbor.label);
+        }
+        if (selfLoopCount != m_selfLoopCounts[vertex] or neighborLabelCounts.getSum() != m_neighborCounts[vertex])
+            throw ConsistencyError("MixedSampler: cached degree of vertex " + std::to_string(vertex) + " is inconsistent with the graph.");
+        for (const auto& neighborLabelCount : neighborLabelCounts)
+            if (m_neighborLabelCounts[vertex].get(neighborLabelCount.first) != neighborLabelCount.second)
+                throw ConsistencyError("MixedSampler: cached count of neighbors of vertex " + std::to_string(vertex)
+                    + " with label " + std::to_string(neighborLabelCount.first) + " is inconsistent with the graph.");
+    }
+    for (Label r = 0; r < std::max(labelGraph.getSize(), m_labelGraphSamplers.size()); ++r){
+        double totalWeight = 0;
+        for (Label s = 0; s < labelGraph.getSize(); ++s){
+            double weight = ((r == s) ? 2 : 1) * ((r < labelGraph.getSize()) ? labelGraph.getEdgeMultiplicityIdx(r, s) : 0);
+            if (weight != getLabelPairWeight(r, s))
+                throw ConsistencyError("MixedSampler: cached edge count between labels " + std::to_string(r)
+                    + " and " + std::to_string(s) + " is inconsistent with the label graph.");
+            totalWeight += weight;
+        }
+        if (r < m_labelGraphSamplers.size() and totalWeight != m_labelGraphSamplers[r].getTotalWeight())
+            throw ConsistencyError("MixedSampler: cached edge count of label " + std::to_string(r) + " is inconsistent with the label graph.");
+    }
+}
+
 template<typename Label>
 const Label MixedSampler<Label>::sampleLabelPreferentially(const Label neighborLabel) const {
-    std::uniform_int_distribution<int> dist(0, (*m_graphPriorPtrPtr)->getEdgeLabelCounts().get(neighborLabel) - 1);
-    int mult = dist(rng);
-    for (auto s : (*m_graphPriorPtrPtr)->getLabelGraph().getNeighboursOfIdx(neighborLabel)){
-        mult -= ((neighborLabel == s.vertexIndex) ? 2 : 1) * s.label;
-        if (mult < 0)
-            return s.vertexIndex;
-    }
-    return sampleLabelUniformly();
+    if (neighborLabel >= m_labelGraphSamplers.size() or m_labelGraphSamplers[neighborLabel].getTotalWeight() == 0)
+        return sampleLabelUniformly();
+    auto labelEdge = m_labelGraphSamplers[neighborLabel].sample();
+    return (labelEdge.first == neighborLabel) ? labelEdge.second : labelEdge.first;
 }
 
 template<typename Label>
 const LabelMove<Label> MixedSampler<Label>::_proposeLabelMove(const BaseGraph::VertexIndex&vertex) const {
+    Label prevLabel = (*m_graphPriorPtrPtr)->getLabelOfIdx(vertex);
+    if (m_neighborCounts[vertex] == 0)
+        return {vertex, prevLabel, sampleLabelUniformly()};
     const auto& edgeCounts = (*m_graphPriorPtrPtr)->getEdgeLabelCounts();
     const auto& B = getAvailableLabelCount();
     Label neighborLabel = MixedSampler<Label>::sampleNeighborLabel(vertex);
     double probUniformSampling = m_shift * B / (edgeCounts.get(neighborLabel) + m_shift * B);
     Label nextLabel = (m_uniform01(rng) < probUniformSampling) ? sampleLabelUniformly() : sampleLabelPreferentially(neighborLabel);
-    return {vertex, (*m_graphPriorPtrPtr)->getLabelOfIdx(vertex), nextLabel};
+    return {vertex, prevLabel, nextLabel};
 }
 
 template<typename Label>
 const double MixedSampler<Label>::_getLogProposalProbForMove(const LabelMove<Label>& move) const {
-    const auto & labels = (*m_graphPriorPtrPtr)->getLabels();
     const auto & edgeCounts = (*m_graphPriorPtrPtr)->getEdgeLabelCounts();
-    const auto & graph = (*m_graphPriorPtrPtr)->getGraph();
-    const auto &labelGraph = (*m_graphPriorPtrPtr)->getLabelGraph();
 
-    double weight = 0, degree = 0;
-    for (auto neighbor : graph.getNeighboursOfIdx(move.vertexIndex)){
-        if (move.vertexIndex == neighbor.vertexIndex)
-            continue;
-        auto t = labels[ neighbor.vertexIndex ];
-        size_t m = (move.nextLabel < labelGraph.getSize()) ? labelGraph.getEdgeMultiplicityIdx(t, move.nextLabel) : 0;
-        size_t Est = ((t == move.nextLabel) ? 2 : 1) * m;
+    double weight = 0, degree = m_neighborCounts[move.vertexIndex];
+    for (const auto& neighborLabelCount : m_neighborLabelCounts[move.vertexIndex]){
+        auto t = neighborLabelCount.first;
+        double Est = getLabelPairWeight(t, move.nextLabel);
         size_t Et = edgeCounts.get(t);
-
-        degree += neighbor.label;
-        weight += neighbor.label * ( Est + m_shift ) / (Et + m_shift * getAvailableLabelCount()) ;
+        weight += neighborLabelCount.second * ( Est + m_shift ) / (Et + m_shift * getAvailableLabelCount()) ;
     }
 
     if (degree == 0)
@@ -102,24 +228,18 @@ const double MixedSampler<Label>::_getLogProposalProbForMove(const LabelMove<Lab
 
 template<typename Label>
 const double MixedSampler<Label>::_getLogProposalProbForReverseMove(const LabelMove<Label>& move) const {
-    const auto & labels = (*m_graphPriorPtrPtr)->getLabels();
     const auto & edgeCounts = (*m_graphPriorPtrPtr)->getEdgeLabelCounts();
-    const auto & graph = (*m_graphPriorPtrPtr)->getGraph();
-    const auto &labelGraph = (*m_graphPriorPtrPtr)->getLabelGraph();
 
-    auto edgeMatDiff = getEdgeMatrixDiff(move);
-    auto edgeCountsDiff = getEdgeCountsDiff(move);
+    const auto& moveDiff = (*m_graphPriorPtrPtr)->getMoveDiff(move);
+    const auto& edgeMatDiff = moveDiff.edgeMatrix;
+    const auto& edgeCountsDiff = moveDiff.edgeCounts;
 
-    double weight = 0, degree = 0;
-    for (auto neighbor : graph.getNeighboursOfIdx(move.vertexIndex)){
-        if (move.vertexIndex == neighbor.vertexIndex)
-            continue;
-        auto t = labels[ neighbor.vertexIndex ];
-        size_t m = (move.prevLabel < labelGraph.getSize()) ? labelGraph.getEdgeMultiplicityIdx(t, move.prevLabel) : 0;
-        size_t Ert = ((t == move.prevLabel) ? 2 : 1) * ((m + edgeMatDiff.get(getOrderedEdge({t, move.prevLabel}))));
+    double weight = 0, degree = m_neighborCounts[move.vertexIndex];
+    for (const auto& neighborLabelCount : m_neighborLabelCounts[move.vertexIndex]){
+        auto t = neighborLabelCount.first;
+        double Ert = getLabelPairWeight(t, move.prevLabel) + ((t == move.prevLabel) ? 2 : 1) * edgeMatDiff.get(getOrderedEdge({t, move.prevLabel}));
         size_t Et = edgeCounts.get(t) + edgeCountsDiff.get(t);
-        degree += neighbor.label;
-        weight += neighbor.label * ( Ert + m_shift ) / (Et + m_shift * getAvailableLabelCount()) ;
+        weight += neighborLabelCount.second * ( Ert + m_shift ) / (Et + m_shift * getAvailableLabelCount()) ;
     }
 
     if (degree == 0)
@@ -128,35 +248,6 @@ const double MixedSampler<Label>::_getLogProposalProbForReverseMove(const LabelM
     return logProposal;
 }
 
-template<typename Label>
-IntMap<std::pair<Label, Label>> MixedSampler<Label>::getEdgeMatrixDiff(const LabelMove<Label>& move) const {
-
-    const auto & labels = (*m_graphPriorPtrPtr)->getLabels();
-    const auto & graph = (*m_graphPriorPtrPtr)->getGraph();
-
-    IntMap<std::pair<Label, Label>> edgeMatDiff;
-    Label r = move.prevLabel, s = move.nextLabel;
-    for (auto neighbor : graph.getNeighboursOfIdx(move.vertexIndex)){
-        Label t = labels[neighbor.vertexIndex];
-        if (move.vertexIndex == neighbor.vertexIndex)
-            t = move.prevLabel;
-        edgeMatDiff.decrement(getOrderedEdge({r, t}), neighbor.label);
-        if (move.vertexIndex == neighbor.vertexIndex)
-            t = move.nextLabel;
-        edgeMatDiff.increment(getOrderedEdge({s, t}), neighbor.label);
-    }
-     return edgeMatDiff;
-}
-
-template<typename Label>
-IntMap<Label> MixedSampler<Label>::getEdgeCountsDiff(const LabelMove<Label>& move) const {
-    IntMap<Label> edgeCountsDiff;
-    size_t degree = (*m_graphPriorPtrPtr)->getGraph().getDegreeOfIdx(move.vertexIndex);
-    edgeCountsDiff.decrement(move.prevLabel, degree);
-    edgeCountsDiff.increment(move.nextLabel, degree);
-     return edgeCountsDiff;
-}
-
 template<typename Label>
 class GibbsMixedLabelProposer: public GibbsLabelProposer<Label>, public MixedSampler<Label>{
 protected:
@@ -174,10 +265,24 @@ public:
     GibbsMixedLabelProposer(double sampleLabelCountProb=0.5, double labelCreationProb=0.1, double shift=1):
         GibbsLabelProposer<Label>(sampleLabelCountProb, labelCreationProb),
         MixedSampler<Label>(shift) { this->m_graphPriorPtrPtr = &this->m_graphPriorPtr; }
+    GibbsMixedLabelProposer(const GibbsMixedLabelProposer& other):
+        GibbsLabelProposer<Label>(other),
+        MixedSampler<Label>(other) { this->m_graphPriorPtrPtr = &this->m_graphPriorPtr; }
+    GibbsMixedLabelProposer* clone() const override { return new GibbsMixedLabelProposer(*this); }
 
     const LabelMove<Label> proposeLabelMove(const BaseGraph::VertexIndex&vertex) const override {
         return MixedSampler<Label>::_proposeLabelMove(vertex);
     }
+    void setUp(const VertexLabeledRandomGraph<Label>& graphPrior) override {
+        GibbsLabelProposer<Label>::setUp(graphPrior);
+        MixedSampler<Label>::setUpSampler();
+    }
+    void applyLabelMove(const LabelMove<Label>& move) override {
+        GibbsLabelProposer<Label>::applyLabelMove(move);
+        MixedSampler<Label>::applyLabelMoveToSampler(move);
+    }
+    void applyGraphMove(const GraphMove& move) override { MixedSampler<Label>::applyGraphMoveToSampler(move); }
+    void checkSelfConsistency() const override { MixedSampler<Label>::checkSamplerConsistency(); }
 };
 
 using GibbsMixedBlockProposer = GibbsMixedLabelProposer<BlockIndex>;
@@ -200,10 +305,24 @@ public:
     RestrictedMixedLabelProposer(double sampleLabelCountProb=0.5, double shift=1):
         RestrictedLabelProposer<Label>(sampleLabelCountProb),
         MixedSampler<Label>(shift) { this->m_graphPriorPtrPtr = &this->m_graphPriorPtr; }
+    RestrictedMixedLabelProposer(const RestrictedMixedLabelProposer& other):
+        RestrictedLabelProposer<Label>(other),
+        MixedSampler<Label>(other) { this->m_graphPriorPtrPtr = &this->m_graphPriorPtr; }
+    RestrictedMixedLabelProposer* clone() const override { return new RestrictedMixedLabelProposer(*this); }
 
     const LabelMove<Label> proposeLabelMove(const BaseGraph::VertexIndex&vertex) const override {
         return MixedSampler<Label>::_proposeLabelMove(vertex);
     }
+    void setUp(const VertexLabeledRandomGraph<Label>& graphPrior) override {
+        RestrictedLabelProposer<Label>::setUp(graphPrior);
+        MixedSampler<Label>::setUpSampler();
+    }
+    void applyLabelMove(const LabelMove<Label>& move) override {
+        RestrictedLabelProposer<Label>::applyLabelMove(move);
+        MixedSampler<Label>::applyLabelMoveToSampler(move);
+    }
+    void applyGraphMove(const GraphMove& move) override { MixedSampler<Label>::applyGraphMoveToSampler(move); }
+    void checkSelfConsistency() const override { MixedSampler<Label>::checkSamplerConsistency(); }
 };
 using RestrictedMixedBlockProposer = RestrictedMixedLabelProposer<BlockIndex>;
 
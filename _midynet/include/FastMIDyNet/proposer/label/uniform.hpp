@@ -19,6 +19,7 @@ protected:
     using GibbsLabelProposer<Label>::m_sampleLabelCountProb;
 public:
     using GibbsLabelProposer<Label>::GibbsLabelProposer;
+    GibbsUniformLabelProposer* clone() const override { return new GibbsUniformLabelProposer(*this); }
     const double getLogProposalProbForMove(const LabelMove<Label>& move) const override { return -log(m_graphPriorPtr->getLabelCount()); }
     const double getLogProposalProbForReverseMove(const LabelMove<Label>& move) const override { return -log(m_graphPriorPtr->getLabelCount() + move.addedLabels); }
     const LabelMove<Label> proposeLabelMove(const BaseGraph::VertexIndex& vertex) const override {
@@ -38,6 +39,7 @@ protected:
     using RestrictedLabelProposer<Label>::m_availableLabels;
 public:
     using RestrictedLabelProposer<Label>::RestrictedLabelProposer;
+    RestrictedUniformLabelProposer* clone() const override { return new RestrictedUniformLabelProposer(*this); }
     const double getLogProposalProbForMove(const LabelMove<Label>& move) const override { return -log(m_availableLabels.size()); }
     const double getLogProposalProbForReverseMove(const LabelMove<Label>& move) const override { return -log(m_availableLabels.size() + move.addedLabels); }
     const LabelMove<Label> proposeLabelMove(const BaseGraph::VertexIndex& vertex) const override {
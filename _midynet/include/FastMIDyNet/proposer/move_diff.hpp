@@ -0,0 +1,102 @@
+#ifndef FAST_MIDYNET_MOVE_DIFF_HPP
+#define FAST_MIDYNET_MOVE_DIFF_HPP
+
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+#include "FastMIDyNet/proposer/movetypes.h"
+#include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/maps.hpp"
+#include "FastMIDyNet/utility/cache.hpp"
+
+
+namespace FastMIDyNet{
+
+/* Changes induced by a move on the label graph (`edgeMatrix`, keyed by ordered
+ * label pairs, and `edgeCounts`) and, for graph moves, on the graph itself
+ * (`adjacency`, keyed by ordered edges, and `degrees`). The diff is computed
+ * once per proposed move and shared by the proposers and the likelihood ratios
+ * until the state changes. */
+template<typename Label>
+class MoveDiff{
+public:
+    FlatIntMap<std::pair<Label, Label>> edgeMatrix;
+    FlatIntMap<Label> edgeCounts;
+    FlatIntMap<BaseGraph::Edge> adjacency;
+    FlatIntMap<BaseGraph::VertexIndex> degrees;
+
+    void clear(){
+        edgeMatrix.clear();
+        edgeCounts.clear();
+        adjacency.clear();
+        degrees.clear();
+        m_moveType = NO_MOVE;
+    }
+
+    bool isComputedFor(const GraphMove& move, size_t stamp, size_t epoch) const {
+        return isUpToDate(GRAPH_MOVE, stamp, epoch) and m_graphMove == move;
+    }
+    bool isComputedFor(const LabelMove<Label>& move, size_t stamp, size_t epoch) const {
+        return isUpToDate(LABEL_MOVE, stamp, epoch) and m_labelMove == move;
+    }
+
+    void computeFromGraphMove(const std::vector<Label>& labels, const GraphMove& move, size_t stamp, size_t epoch){
+        clear();
+        for (const auto& edge : move.addedEdges)
+            addEdge(labels, edge, 1);
+        for (const auto& edge : move.removedEdges)
+            addEdge(labels, edge, -1);
+        m_graphMove.removedEdges = move.removedEdges;
+        m_graphMove.addedEdges = move.addedEdges;
+        setComputed(GRAPH_MOVE, stamp, epoch);
+    }
+
+    void computeFromLabelMove(const MultiGraph& graph, const std::vector<Label>& labels, const LabelMove<Label>& move, size_t stamp, size_t epoch){
+        clear();
+        for (const auto& neighbor : graph.getNeighboursOfIdx(move.vertexIndex)){
+            Label t = labels[neighbor.vertexIndex];
+            if (move.vertexIndex == neighbor.vertexIndex) // handling self-loops
+                t = move.prevLabel;
+            edgeMatrix.decrement(getOrderedPair<Label>({move.prevLabel, t}), neighbor.label);
+            if (move.vertexIndex == neighbor.vertexIndex)
+                t = move.nextLabel;
+            edgeMatrix.increment(getOrderedPair<Label>({move.nextLabel, t}), neighbor.label);
+        }
+        size_t degree = graph.getDegreeOfIdx(move.vertexIndex);
+        edgeCounts.decrement(move.prevLabel, degree);
+        edgeCounts.increment(move.nextLabel, degree);
+        m_labelMove = move;
+        setComputed(LABEL_MOVE, stamp, epoch);
+    }
+
+private:
+    enum MoveType { NO_MOVE, GRAPH_MOVE, LABEL_MOVE };
+    MoveType m_moveType = NO_MOVE;
+    GraphMove m_graphMove;
+    LabelMove<Label> m_labelMove;
+    size_t m_stamp = 0;
+    size_t m_epoch = LogProbabilityCache::INVALID_EPOCH;
+
+    void addEdge(const std::vector<Label>& labels, const BaseGraph::Edge& edge, int counter){
+        edgeMatrix.increment(getOrderedPair<Label>({labels[edge.first], labels[edge.second]}), counter);
+        edgeCounts.increment(labels[edge.first], counter);
+        edgeCounts.increment(labels[edge.second], counter);
+        adjacency.increment(getOrderedEdge(edge), counter);
+        degrees.increment(edge.first, counter);
+        degrees.increment(edge.second, counter);
+    }
+    bool isUpToDate(MoveType moveType, size_t stamp, size_t epoch) const {
+        return m_moveType == moveType and m_stamp == stamp and m_epoch == epoch;
+    }
+    void setComputed(MoveType moveType, size_t stamp, size_t epoch){
+        m_moveType = moveType;
+        m_stamp = stamp;
+        m_epoch = epoch;
+    }
+};
+
+}
+
+#endif
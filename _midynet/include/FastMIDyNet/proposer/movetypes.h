@@ -18,6 +18,10 @@ struct GraphMove{
     std::vector<BaseGraph::Edge> removedEdges;
     std::vector<BaseGraph::Edge> addedEdges;
 
+    bool operator==(const GraphMove& other) const {
+        return removedEdges == other.removedEdges and addedEdges == other.addedEdges;
+    }
+
     void display() const{
         std::cout << "edges removed : { ";
         for (auto e : removedEdges){
@@ -36,11 +40,17 @@ template <typename Label>
 struct LabelMove{
     LabelMove(BaseGraph::VertexIndex vertexIndex, Label prevLabel, Label nextLabel, int addedLabels=0):
         vertexIndex(vertexIndex), prevLabel(prevLabel), nextLabel(nextLabel), addedLabels(addedLabels){ }
+    LabelMove(): vertexIndex(0), prevLabel(), nextLabel(), addedLabels(0){ }
     BaseGraph::VertexIndex vertexIndex;
     Label prevLabel;
     Label nextLabel;
     int addedLabels;
 
+    bool operator==(const LabelMove<Label>& other) const {
+        return vertexIndex == other.vertexIndex and prevLabel == other.prevLabel
+            and nextLabel == other.nextLabel and addedLabels == other.addedLabels;
+    }
+
     std::string display()const{
         std::stringstream ss;
         ss << "vertex " << vertexIndex << ": " << prevLabel << " -> " << nextLabel;
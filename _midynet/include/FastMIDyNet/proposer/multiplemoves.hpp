@@ -2,6 +2,7 @@
 #define FAST_MIDYNET_MULTIPLEMOVE_PROPOSER_H
 
 #include "proposer.hpp"
+#include "adaptive_mixture.hpp"
 #include "FastMIDyNet/types.h"
 #include "FastMIDyNet/rng.h"
 
@@ -12,34 +13,54 @@ namespace FastMIDyNet {
 template<typename MoveType>
 class MultipleMovesProposer: public Proposer<MoveType> {
     std::vector<Proposer<MoveType>*>& m_proposers;
-    std::vector<double> m_moveWeights;
-    mutable unsigned int m_proposedMoveType;
-    mutable std::discrete_distribution<unsigned int> m_moveTypeDistribution;
+    AdaptiveMixture m_moveTypeMixture;
+    mutable size_t m_proposedMoveType;
 
     public:
         MultipleMovesProposer(std::vector<Proposer<MoveType>*>& proposers, std::vector<double> moveWeights);
         const MoveType proposeMove() const;
+        /* Moves are categorized by the proposer that proposed the last move. */
+        const size_t getMoveCategory(const MoveType&) const override { return m_proposedMoveType; }
+        const std::vector<std::string> getMoveCategoryNames() const override {
+            std::vector<std::string> names;
+            for (size_t i = 0; i < m_proposers.size(); ++i)
+                names.push_back("proposer" + std::to_string(i));
+            return names;
+        }
         double getLogProposalProbRatio(const MoveType&) const;
         void updateProbabilities(const MoveType&);
+
+        /* Tunes the move type weights from the outcome of the moves, reported by the
+         * MCMC with the cycles spent on them, until the weights are frozen. */
+        void startMoveTypeAdaptation(size_t adaptationPeriod=1000, double minWeight=0.05) {
+            m_moveTypeMixture.startAdaptation(adaptationPeriod, minWeight);
+        }
+        void freezeMoveTypeWeights() { m_moveTypeMixture.freeze(); }
+        const bool isAdaptingMoveTypes() const override { return m_moveTypeMixture.isAdapting(); }
+        void recordMoveOutcome(bool accepted, uint64_t cycles) override {
+            m_moveTypeMixture.record(m_proposedMoveType, accepted, cycles);
+        }
+        const std::vector<double>& getMoveWeights() const { return m_moveTypeMixture.getWeights(); }
+        AdaptiveMixture& getMoveTypeMixture() { return m_moveTypeMixture; }
 };
 
 template<typename MoveType>
 MultipleMovesProposer<MoveType>::MultipleMovesProposer(std::vector<Proposer<MoveType>*>& proposers,
     std::vector<double> moveWeights):
-            m_proposers(proposers), m_moveWeights(moveWeights), m_proposedMoveType(0) {
+            m_proposers(proposers), m_proposedMoveType(0) {
 
-    if (m_moveWeights.size() != m_proposers.size())
+    if (moveWeights.size() != m_proposers.size())
         throw std::invalid_argument("MultipleMovesProposer: Number of "
                 "proposers isn't equal to the number of moveWeights.");
     if (m_proposers.size() == 0)
         throw std::invalid_argument("MultipleMovesProposer: No proposers given.");
 
-    m_moveTypeDistribution = std::discrete_distribution<unsigned int>(moveWeights.begin(), moveWeights.end());
+    m_moveTypeMixture.setWeights(moveWeights);
 }
 
 template<typename MoveType>
 const MoveType MultipleMovesProposer<MoveType>::proposeMove() const {
-    m_proposedMoveType = m_moveTypeDistribution(rng);
+    m_proposedMoveType = m_moveTypeMixture.sample();
     return m_proposers[m_proposedMoveType]->proposeMove();
 }
 
@@ -1,18 +1,55 @@
 #ifndef FAST_MIDYNET_PROPOSER_HPP
 #define FAST_MIDYNET_PROPOSER_HPP
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "FastMIDyNet/types.h"
 #include "FastMIDyNet/rv.hpp"
+#include "FastMIDyNet/proposer/statistics.hpp"
 
 namespace FastMIDyNet{
 
 
 template<typename MoveType>
 class Proposer: public NestedRandomVariable{
+    protected:
+        mutable ProposalStatistics m_proposalStatistics;
     public:
         virtual ~Proposer(){}
         virtual const MoveType proposeMove() const = 0;
         virtual void clear() {};
+
+        /* Categories of moves for which the proposal statistics are recorded separately. */
+        virtual const std::vector<std::string> getMoveCategoryNames() const { return {"normal"}; }
+        virtual const size_t getMoveCategory(const MoveType& move) const { return 0; }
+
+        const ProposalRecord startProposalRecord(const MoveType& move) const {
+#if PROPOSAL_STATS
+            return {getMoveCategory(move), readCycleCounter()};
+#else
+            return {0, isAdaptingMoveTypes() ? readCycleCounter() : 0};
+#endif
+        }
+        void stopProposalRecord(const ProposalRecord& record, bool accepted) const {
+#if PROPOSAL_STATS
+            m_proposalStatistics.record(record.category, accepted, readCycleCounter() - record.startCycle);
+#endif
+        }
+        const std::map<std::string, ProposalCounts> getProposalStatistics() const {
+            std::map<std::string, ProposalCounts> statistics;
+            const auto& names = getMoveCategoryNames();
+            for (size_t category = 0; category < names.size(); ++category)
+                statistics[names[category]] = m_proposalStatistics.getCounts(category);
+            return statistics;
+        }
+        void clearProposalStatistics() { m_proposalStatistics.clear(); }
+
+        /* Proposers mixing several types of moves with adaptive weights are told the
+         * outcome and the cost of each of their moves while they adapt. */
+        virtual const bool isAdaptingMoveTypes() const { return false; }
+        virtual void recordMoveOutcome(bool accepted, uint64_t cycles) { }
 };
 
 }
@@ -28,7 +28,14 @@ public:
 
     /* Abstract & overloaded methods */
     void setUp(const MultiGraph& graph) override { PYBIND11_OVERRIDE_PURE(void, BaseClass, setUp, graph); }
+    void setUpStates(const StateSequence& pastStates, const StateSequence& futureStates) override {
+        PYBIND11_OVERRIDE(void, BaseClass, setUpStates, pastStates, futureStates);
+    }
+    void setUpLabels(const VertexLabeledRandomGraph<BlockIndex>& graphPrior) override {
+        PYBIND11_OVERRIDE(void, BaseClass, setUpLabels, graphPrior);
+    }
     void applyGraphMove(const GraphMove& move) override { PYBIND11_OVERRIDE(void, BaseClass, applyGraphMove, move); }
+    void applyLabelMove(const BlockMove& move) override { PYBIND11_OVERRIDE(void, BaseClass, applyLabelMove, move); }
     void clear() override { PYBIND11_OVERRIDE(void, BaseClass, clear, ); }
 };
 
@@ -2,7 +2,7 @@
 #define FASTMIDYNET_EDGE_SAMPLER_H
 
 #include <unordered_set>
-#include "SamplableSet.hpp"
+#include <vector>
 #include "hash_specialization.hpp"
 #include "BaseGraph/types.h"
 #include "FastMIDyNet/rng.h"
@@ -12,18 +12,30 @@
 
 namespace FastMIDyNet{
 
+/* Weighted sampling of edges. The edges are stored in a flat array whose
+ * weights are summed by a Fenwick tree, and an open-addressing map gives the
+ * position of each edge. Erasures swap the last edge into the freed position. */
 class EdgeSampler{
 private:
-    sset::SamplableSet<BaseGraph::Edge> m_edgeSampler = sset::SamplableSet<BaseGraph::Edge>(1, 100);
+    std::vector<BaseGraph::Edge> m_edges;
+    std::vector<double> m_weights;
+    std::vector<double> m_cumulativeWeights;
+    FlatIntMap<BaseGraph::Edge> m_positions;
+    double m_totalWeight = 0;
+
+    void addToWeight(size_t position, double weight);
+    double getWeightBefore(size_t position) const;
+    size_t findPosition(double cumulativeWeight) const;
+    void insertEdge(const BaseGraph::Edge& orderedEdge, double weight);
+    void eraseEdge(const BaseGraph::Edge& orderedEdge);
 public:
     EdgeSampler(){}
-    EdgeSampler(const EdgeSampler& other): m_edgeSampler(other.m_edgeSampler){}
 
-    BaseGraph::Edge sample() const {
-        return m_edgeSampler.sample_ext_RNG(rng).first;
-    }
+    BaseGraph::Edge sample() const;
+    /* Samples as if one unit of weight of `excludedEdge` had been removed. */
+    BaseGraph::Edge sampleExcluding(const BaseGraph::Edge& excludedEdge) const;
     bool contains(const BaseGraph::Edge&edge) const {
-        return m_edgeSampler.count(edge) > 0;
+        return not m_positions.isEmpty(edge);
     };
 
     void onEdgeAddition(const BaseGraph::Edge& );
@@ -31,27 +43,19 @@ public:
     void onEdgeInsertion(const BaseGraph::Edge& , double);
     double onEdgeErasure(const BaseGraph::Edge& );
     const double getEdgeWeight(const BaseGraph::Edge& edge) const {
-        // auto orderedEdge = getOrderedEdge(edge);
-        return (contains(edge)) ? m_edgeSampler.get_weight(edge) : 0.;
+        return (contains(edge)) ? m_weights[m_positions.get(edge)] : 0.;
     }
 
     std::unordered_set<BaseGraph::Edge> enumerateEdges(){
-        std::unordered_set<BaseGraph::Edge> edges;
-        m_edgeSampler.init_iterator();
-        for (size_t i = 0; i < m_edgeSampler.size(); i++) {
-            edges.insert(m_edgeSampler.get_at_iterator().first);
-            m_edgeSampler.next();
-        }
-        return edges;
+        return std::unordered_set<BaseGraph::Edge>(m_edges.begin(), m_edges.end());
     }
 
-    const double getTotalWeight() const {return m_edgeSampler.total_weight(); }
-    const double getSize() const {return m_edgeSampler.size(); }
+    const double getTotalWeight() const {return m_totalWeight; }
+    const double getSize() const {return m_edges.size(); }
 
-    void clear() { m_edgeSampler.clear(); }
+    void clear() { m_edges.clear(); m_weights.clear(); m_cumulativeWeights.clear(); m_positions.clear(); m_totalWeight = 0; }
     void checkSafety() const { }
 };
-
 }
 
 #endif
@@ -3,6 +3,7 @@
 
 #include <random>
 #include <unordered_map>
+#include <vector>
 #include "SamplableSet.hpp"
 #include "hash_specialization.hpp"
 #include "BaseGraph/types.h"
@@ -31,49 +32,66 @@ public:
     virtual void clear() {}
 };
 
+/* Uniform sampling over a dense array of vertices, with the position of each
+ * vertex in the array so that erasures swap the last vertex into the gap. */
 class VertexUniformSampler: public VertexSampler{
 protected:
-    sset::SamplableSet<BaseGraph::VertexIndex> m_vertexSampler = sset::SamplableSet<BaseGraph::VertexIndex>(1, 100);
+    std::vector<BaseGraph::VertexIndex> m_vertices;
+    std::vector<size_t> m_positions;
+    static constexpr size_t NO_POSITION = -1;
 public:
     VertexUniformSampler(){}
     VertexUniformSampler(const VertexUniformSampler& other):
-        m_vertexSampler(other.m_vertexSampler){ }
+        m_vertices(other.m_vertices), m_positions(other.m_positions){ }
     virtual ~VertexUniformSampler() {}
     const VertexUniformSampler& operator=(const VertexUniformSampler& other){
-        m_vertexSampler = other.m_vertexSampler;
+        m_vertices = other.m_vertices;
+        m_positions = other.m_positions;
         return *this;
     }
 
-    BaseGraph::VertexIndex sample() const override { return m_vertexSampler.sample_ext_RNG(rng).first; }
+    BaseGraph::VertexIndex sample() const override {
+        if (m_vertices.empty())
+            throw std::logic_error("VertexUniformSampler: cannot sample from an empty set of vertices.");
+        return m_vertices[std::uniform_int_distribution<size_t>(0, m_vertices.size() - 1)(rng)];
+    }
 
     bool contains(const BaseGraph::VertexIndex& vertex) const override {
-        return m_vertexSampler.count(vertex) > 0;
+        return vertex < m_positions.size() and m_positions[vertex] != NO_POSITION;
     };
     void onVertexInsertion(const BaseGraph::VertexIndex& vertex) override {
-        if (not contains(vertex))
-            m_vertexSampler.insert(vertex, 1);
+        if (contains(vertex))
+            return;
+        if (vertex >= m_positions.size())
+            m_positions.resize(vertex + 1, NO_POSITION);
+        m_positions[vertex] = m_vertices.size();
+        m_vertices.push_back(vertex);
     };
     void onVertexErasure(const BaseGraph::VertexIndex& vertex) override {
         if (not contains(vertex))
             throw std::logic_error("Cannot remove non-exising vertex " + std::to_string(vertex) + ".");
-        m_vertexSampler.erase(vertex);
+        BaseGraph::VertexIndex lastVertex = m_vertices.back();
+        m_vertices[m_positions[vertex]] = lastVertex;
+        m_positions[lastVertex] = m_positions[vertex];
+        m_vertices.pop_back();
+        m_positions[vertex] = NO_POSITION;
     };
     void onEdgeInsertion(const BaseGraph::Edge& edge, double edgeWeight) { };
     void onEdgeErasure(const BaseGraph::Edge&) { };
     void onEdgeAddition(const BaseGraph::Edge&) { };
     void onEdgeRemoval(const BaseGraph::Edge&) { };
     const double getVertexWeight(const BaseGraph::VertexIndex& vertex) const override {
-        return (contains(vertex)) ? m_vertexSampler.get_weight(vertex) : 0.;
+        return (contains(vertex)) ? 1. : 0.;
     }
-    const double getTotalWeight() const override { return m_vertexSampler.total_weight(); }
-    const size_t getSize() const override { return m_vertexSampler.size(); }
+    const double getTotalWeight() const override { return m_vertices.size(); }
+    const size_t getSize() const override { return m_vertices.size(); }
 
 
-    void clear() override { m_vertexSampler.clear(); }
+    void clear() override { m_vertices.clear(); m_positions.clear(); }
 
     void checkSafety()const override {
-        if (m_vertexSampler.size() == 0)
-            throw SafetyError("VertexUniformSampler: unsafe vertex sampler since `m_vertexSampler` is empty.");
+        if (m_vertices.size() == 0)
+            throw SafetyError("VertexUniformSampler: unsafe vertex sampler since `m_vertices` is empty.");
     }
 
 };
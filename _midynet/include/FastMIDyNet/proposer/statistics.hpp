@@ -0,0 +1,77 @@
+#ifndef FAST_MIDYNET_PROPOSAL_STATISTICS_HPP
+#define FAST_MIDYNET_PROPOSAL_STATISTICS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+namespace FastMIDyNet{
+
+/* Proposal statistics are only recorded when compiled with PROPOSAL_STATS
+ * (cmake -DPROPOSAL_STATS=ON); otherwise every recording call is a no-op. */
+#if PROPOSAL_STATS
+static const bool PROPOSAL_STATS_ENABLED = true;
+#else
+static const bool PROPOSAL_STATS_ENABLED = false;
+#endif
+
+inline uint64_t readCycleCounter(){
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+#endif
+}
+
+struct ProposalCounts{
+    size_t proposed = 0;
+    size_t accepted = 0;
+    uint64_t cycles = 0;
+
+    const double getAcceptanceRate() const { return (proposed == 0) ? 0 : (double) accepted / proposed; }
+    const double getMeanCycles() const { return (proposed == 0) ? 0 : (double) cycles / proposed; }
+};
+
+/* Category and start of the evaluation of a proposed move, taken before the
+ * move is accepted since the category may depend on the current state. */
+struct ProposalRecord{
+    size_t category;
+    uint64_t startCycle;
+};
+
+class ProposalStatistics{
+    std::vector<ProposalCounts> m_counts;
+public:
+    void record(size_t category, bool accepted, uint64_t cycles){
+        if (category >= m_counts.size())
+            m_counts.resize(category + 1);
+        auto& counts = m_counts[category];
+        ++counts.proposed;
+        counts.accepted += accepted;
+        counts.cycles += cycles;
+    }
+    const ProposalCounts getCounts(size_t category) const {
+        return (category < m_counts.size()) ? m_counts[category] : ProposalCounts();
+    }
+    const ProposalCounts getTotalCounts() const {
+        ProposalCounts total;
+        for (const auto& counts: m_counts){
+            total.proposed += counts.proposed;
+            total.accepted += counts.accepted;
+            total.cycles += counts.cycles;
+        }
+        return total;
+    }
+    void clear() { m_counts.clear(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef FAST_MIDYNET_PYTHON_NUMPY_HPP
+#define FAST_MIDYNET_PYTHON_NUMPY_HPP
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+
+
+namespace py = pybind11;
+namespace FastMIDyNet{
+
+template<typename T>
+using NumpyArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/* Read-only NumPy view of shared contiguous values, without copy. The view keeps
+ * the values alive, which their owner never modifies once shared. */
+template<typename T>
+py::array_t<T> getSharedArrayView(const std::shared_ptr<const std::vector<T>>& values, std::vector<py::ssize_t> shape){
+    auto owner = new std::shared_ptr<const std::vector<T>>(values);
+    py::capsule base(owner, [](void* ptr){ delete static_cast<std::shared_ptr<const std::vector<T>>*>(ptr); });
+    py::array_t<T> array(shape, values->data(), base);
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
+
+template<typename T>
+py::array_t<T> getSharedArrayView(const std::shared_ptr<const std::vector<T>>& values){
+    return getSharedArrayView(values, {(py::ssize_t) values->size()});
+}
+
+/* NumPy copies of nested vectors, made in a single pass without creating Python
+ * objects for the elements. The nested vectors must not be ragged. */
+template<typename T>
+py::array_t<T> getMatrixArray(const std::vector<std::vector<T>>& matrix){
+    size_t columnCount = (matrix.size() == 0) ? 0 : matrix[0].size();
+    py::array_t<T> array(std::vector<py::ssize_t>{(py::ssize_t) matrix.size(), (py::ssize_t) columnCount});
+    T* data = array.mutable_data();
+    for (size_t i = 0; i < matrix.size(); ++i){
+        if (matrix[i].size() != columnCount)
+            throw std::logic_error("getMatrixArray: row " + std::to_string(i) + " has "
+                + std::to_string(matrix[i].size()) + " elements instead of " + std::to_string(columnCount) + ".");
+        std::copy(matrix[i].begin(), matrix[i].end(), data + i * columnCount);
+    }
+    return array;
+}
+
+template<typename T>
+py::array_t<T> getTensorArray(const std::vector<std::vector<std::vector<T>>>& tensor){
+    size_t rowCount = (tensor.size() == 0) ? 0 : tensor[0].size();
+    size_t columnCount = (rowCount == 0) ? 0 : tensor[0][0].size();
+    py::array_t<T> array(std::vector<py::ssize_t>{
+        (py::ssize_t) tensor.size(), (py::ssize_t) rowCount, (py::ssize_t) columnCount
+    });
+    T* data = array.mutable_data();
+    for (size_t i = 0; i < tensor.size(); ++i){
+        if (tensor[i].size() != rowCount)
+            throw std::logic_error("getTensorArray: matrix " + std::to_string(i) + " has "
+                + std::to_string(tensor[i].size()) + " rows instead of " + std::to_string(rowCount) + ".");
+        for (size_t j = 0; j < rowCount; ++j){
+            if (tensor[i][j].size() != columnCount)
+                throw std::logic_error("getTensorArray: row (" + std::to_string(i) + ", " + std::to_string(j)
+                    + ") has " + std::to_string(tensor[i][j].size()) + " elements instead of "
+                    + std::to_string(columnCount) + ".");
+            std::copy(tensor[i][j].begin(), tensor[i][j].end(), data + (i * rowCount + j) * columnCount);
+        }
+    }
+    return array;
+}
+
+template<typename T>
+std::vector<std::vector<T>> getMatrixFromArray(const NumpyArray<T>& array){
+    if (array.ndim() != 2)
+        throw std::logic_error("getMatrixFromArray: expected a 2-dimensional array, got "
+            + std::to_string(array.ndim()) + " dimensions.");
+    size_t rowCount = array.shape(0), columnCount = array.shape(1);
+    const T* data = array.data();
+    std::vector<std::vector<T>> matrix(rowCount);
+    for (size_t i = 0; i < rowCount; ++i)
+        matrix[i].assign(data + i * columnCount, data + (i + 1) * columnCount);
+    return matrix;
+}
+
+}
+
+#endif
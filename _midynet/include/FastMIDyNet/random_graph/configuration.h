@@ -34,6 +34,24 @@ public:
             setEdgeMatrixPrior(m_edgeMatrixUniformPrior);
             setDegreePrior(degreePrior);
         }
+    ConfigurationModelFamily(const ConfigurationModelFamily& other):
+        DegreeCorrectedStochasticBlockModelFamily(other),
+        m_blockSeq(other.m_blockSeq),
+        m_blockDeltaPrior(other.m_blockDeltaPrior),
+        m_edgeMatrixUniformPrior(other.m_edgeMatrixUniformPrior){
+            m_blockPriorPtr = &m_blockDeltaPrior;
+            m_edgeMatrixPriorPtr = &m_edgeMatrixUniformPrior;
+            m_edgeMatrixUniformPrior.setBlockPrior(m_blockDeltaPrior);
+        }
+    ConfigurationModelFamily* clone() const override { return new ConfigurationModelFamily(*this); }
+    void remapDependencies(CloneMap& cloneMap) override {
+        const auto& original = cloneMap.getOriginal(*this);
+        cloneMap.insert(original.m_blockDeltaPrior, m_blockDeltaPrior);
+        cloneMap.insert(original.m_edgeMatrixUniformPrior, m_edgeMatrixUniformPrior);
+        m_blockDeltaPrior.remapDependencies(cloneMap);
+        m_edgeMatrixUniformPrior.remapDependencies(cloneMap);
+        DegreeCorrectedStochasticBlockModelFamily::remapDependencies(cloneMap);
+    }
     const EdgeCountPrior& getEdgeCountPrior(){
         return m_edgeMatrixUniformPrior.getEdgeCountPrior();
     }
@@ -16,6 +16,22 @@
 
 namespace FastMIDyNet{
 
+class DegreeCompatibilityTracker: public EdgeMatrixCompatibilityTracker{
+    const DegreeSequence m_expectedDegrees;
+    DegreeSequence m_degrees;
+    size_t m_degreeMismatchCount = 0;
+
+    void updateDegree(BaseGraph::VertexIndex vertex, bool isAdded);
+public:
+    DegreeCompatibilityTracker(size_t size, const BlockSequence& labels, const MultiGraph& expectedEdgeMatrix, const DegreeSequence& expectedDegrees):
+        EdgeMatrixCompatibilityTracker(size, labels, expectedEdgeMatrix), m_expectedDegrees(expectedDegrees) { }
+    void setGraph(const MultiGraph& graph) override;
+    void applyGraphMove(const GraphMove& move) override;
+    const bool isCompatible() const override {
+        return EdgeMatrixCompatibilityTracker::isCompatible() and m_degreeMismatchCount == 0;
+    }
+};
+
 class DegreeCorrectedStochasticBlockModelFamily: public StochasticBlockModelFamily{
 protected:
     DegreePrior* m_degreePriorPtr = nullptr;
@@ -29,6 +45,13 @@ public:
         StochasticBlockModelFamily(graphSize, blockPrior, edgeMatrixPrior) {
             setDegreePrior(degreePrior);
         }
+    DegreeCorrectedStochasticBlockModelFamily* clone() const override {
+        return new DegreeCorrectedStochasticBlockModelFamily(*this);
+    }
+    void remapDependencies(CloneMap& cloneMap) override {
+        StochasticBlockModelFamily::remapDependencies(cloneMap);
+        cloneMap.remap(m_degreePriorPtr);
+    }
 
     void sample () override;
 
@@ -52,6 +75,7 @@ public:
         }
     }
     void setDegreePrior(DegreePrior& degreePrior) {
+        invalidateCaches();
         m_degreePriorPtr = &degreePrior;
         m_degreePriorPtr->isRoot(false);
         m_degreePriorPtr->setBlockPrior(*m_blockPriorPtr);
@@ -88,12 +112,18 @@ public:
         if (not StochasticBlockModelFamily::isCompatible(graph)) return false;
         return graph.getDegrees() == getDegrees();
     }
+    GraphCompatibilityTracker* getCompatibilityTracker() const override {
+        return new DegreeCompatibilityTracker(m_size, getLabels(), m_edgeMatrixPriorPtr->getState(), getDegrees());
+    }
     void computationFinished() const override{
         m_isProcessed = false;
         m_blockPriorPtr->computationFinished();
         m_edgeMatrixPriorPtr->computationFinished();
         m_degreePriorPtr->computationFinished();
     }
+    size_t getCacheEpoch() const override {
+        return StochasticBlockModelFamily::getCacheEpoch() + (m_degreePriorPtr ? m_degreePriorPtr->getCacheEpoch() : 0);
+    }
 
 };
 
@@ -12,6 +12,24 @@
 
 namespace FastMIDyNet{
 
+class EdgeCountCompatibilityTracker: public GraphCompatibilityTracker{
+    const size_t m_size, m_expectedEdgeCount;
+    bool m_isSizeCompatible = false;
+    size_t m_edgeCount = 0;
+public:
+    EdgeCountCompatibilityTracker(size_t size, size_t expectedEdgeCount):
+        m_size(size), m_expectedEdgeCount(expectedEdgeCount) { }
+    void setGraph(const MultiGraph& graph) override {
+        m_isSizeCompatible = graph.getSize() == m_size;
+        m_edgeCount = graph.getTotalEdgeNumber();
+    }
+    void applyGraphMove(const GraphMove& move) override {
+        m_edgeCount += move.addedEdges.size();
+        m_edgeCount -= move.removedEdges.size();
+    }
+    const bool isCompatible() const override { return m_isSizeCompatible and m_edgeCount == m_expectedEdgeCount; }
+};
+
 class ErdosRenyiFamily: public StochasticBlockModelFamily{
 protected:
     const BlockSequence m_blocks;
@@ -36,6 +54,24 @@ public:
             setEdgeMatrixPrior(m_edgeMatrixUniformPrior);
 
         }
+    ErdosRenyiFamily(const ErdosRenyiFamily& other):
+        StochasticBlockModelFamily(other),
+        m_blocks(other.m_blocks),
+        m_blockDeltaPrior(other.m_blockDeltaPrior),
+        m_edgeMatrixUniformPrior(other.m_edgeMatrixUniformPrior){
+            m_blockPriorPtr = &m_blockDeltaPrior;
+            m_edgeMatrixPriorPtr = &m_edgeMatrixUniformPrior;
+            m_edgeMatrixUniformPrior.setBlockPrior(m_blockDeltaPrior);
+        }
+    ErdosRenyiFamily* clone() const override { return new ErdosRenyiFamily(*this); }
+    void remapDependencies(CloneMap& cloneMap) override {
+        const auto& original = cloneMap.getOriginal(*this);
+        cloneMap.insert(original.m_blockDeltaPrior, m_blockDeltaPrior);
+        cloneMap.insert(original.m_edgeMatrixUniformPrior, m_edgeMatrixUniformPrior);
+        m_blockDeltaPrior.remapDependencies(cloneMap);
+        m_edgeMatrixUniformPrior.remapDependencies(cloneMap);
+        StochasticBlockModelFamily::remapDependencies(cloneMap);
+    }
 
     const EdgeCountPrior& getEdgeCountPrior(){ return m_edgeMatrixUniformPrior.getEdgeCountPrior(); }
     EdgeCountPrior& getEdgeCountPriorRef(){ return m_edgeMatrixUniformPrior.getEdgeCountPriorRef(); }
@@ -46,6 +82,9 @@ public:
     const bool isCompatible(const MultiGraph& graph) const override{
         return RandomGraph::isCompatible(graph) and graph.getTotalEdgeNumber() == getEdgeCount();
     }
+    GraphCompatibilityTracker* getCompatibilityTracker() const override {
+        return new EdgeCountCompatibilityTracker(m_size, getEdgeCount());
+    }
 };
 
 class SimpleErdosRenyiFamily: public RandomGraph{
@@ -63,6 +102,8 @@ public:
     SimpleErdosRenyiFamily(size_t graphSize, EdgeCountPrior& edgeCountPrior):
         RandomGraph(graphSize)
         { setEdgeCountPrior(edgeCountPrior); }
+    SimpleErdosRenyiFamily* clone() const override { return new SimpleErdosRenyiFamily(*this); }
+    void remapDependencies(CloneMap& cloneMap) override { cloneMap.remap(m_edgeCountPriorPtr); }
     const size_t& getEdgeCount() const override { return m_edgeCountPriorPtr->getState(); }
 
     void setGraph(const MultiGraph& graph) override{
@@ -102,15 +143,24 @@ public:
         return RandomGraph::isCompatible(graph) and graph.getTotalEdgeNumber() == getEdgeCount();
 
     }
+    GraphCompatibilityTracker* getCompatibilityTracker() const override {
+        return new EdgeCountCompatibilityTracker(m_size, getEdgeCount());
+    }
 
     const EdgeCountPrior& getEdgeCountPrior(){ return *m_edgeCountPriorPtr; }
     EdgeCountPrior& getEdgeCountPriorRef(){ return *m_edgeCountPriorPtr; }
-    void setEdgeCountPrior(EdgeCountPrior& edgeCountPrior){ m_edgeCountPriorPtr = &edgeCountPrior; }
+    void setEdgeCountPrior(EdgeCountPrior& edgeCountPrior){
+        invalidateCaches();
+        m_edgeCountPriorPtr = &edgeCountPrior;
+    }
 
     void computationFinished() const override {
         m_isProcessed = false;
         m_edgeCountPriorPtr->computationFinished();
     }
+    size_t getCacheEpoch() const override {
+        return m_cacheEpoch + (m_edgeCountPriorPtr ? m_edgeCountPriorPtr->getCacheEpoch() : 0);
+    }
 
 };
 
@@ -7,17 +7,53 @@
 #include "FastMIDyNet/types.h"
 #include "FastMIDyNet/rv.hpp"
 #include "FastMIDyNet/proposer/movetypes.h"
+#include "FastMIDyNet/proposer/move_diff.hpp"
 #include "FastMIDyNet/prior/prior.hpp"
 #include "FastMIDyNet/prior/sbm/block.h"
 #include "FastMIDyNet/utility/maps.hpp"
+#include "FastMIDyNet/utility/cache.hpp"
 
 
 namespace FastMIDyNet{
+
+/* Follows whether a graph, moved one edge move at a time, is compatible with a
+ * random graph, so that the compatibility of every move does not require a
+ * comparison of full graphs. */
+class GraphCompatibilityTracker{
+public:
+    virtual ~GraphCompatibilityTracker() { }
+    virtual void setGraph(const MultiGraph& graph) = 0;
+    virtual void applyGraphMove(const GraphMove& move) = 0;
+    virtual const bool isCompatible() const = 0;
+};
+
 class RandomGraph: public NestedRandomVariable{
 protected:
     size_t m_size;
     MultiGraph m_graph;
     virtual void _applyGraphMove(const GraphMove&);
+
+    mutable LogProbabilityCache m_logLikelihoodCache;
+    mutable MoveLogRatioRecord<GraphMove> m_graphMoveLogLikelihoodRatio;
+    size_t m_appliedMoveCount = 0;
+
+    /* The random graph is the outermost node of its priors, hence nothing has
+     * been applied yet when its own ratio is needed at application time. */
+    template<typename MoveType>
+    void updateLogLikelihoodCache(
+        const MoveLogRatioRecord<MoveType>& record,
+        const MoveType& move,
+        const std::function<double()>& getLogLikelihoodRatio
+    ) {
+        double logLikelihoodRatio;
+        size_t epoch = getCacheEpoch();
+        if (m_logLikelihoodCache.isValid(epoch)){
+            if (not record.find(move, m_appliedMoveCount, epoch, logLikelihoodRatio))
+                logLikelihoodRatio = getLogLikelihoodRatio();
+            m_logLikelihoodCache.update(logLikelihoodRatio, epoch);
+        }
+        ++m_appliedMoveCount;
+    }
 public:
     RandomGraph(size_t size=0):
         m_size(size),
@@ -27,9 +63,10 @@ public:
 
     virtual void setGraph(const MultiGraph& state) {
         m_graph = std::move(state);
+        invalidateCaches();
     }
     const size_t getSize() const { return m_size; }
-    void setSize(const size_t size) { m_size = size; }
+    void setSize(const size_t size) { m_size = size; invalidateCaches(); }
     virtual const size_t& getEdgeCount() const = 0;
     const double getAverageDegree() const {
         double avgDegree = 2 * (double) getEdgeCount();
@@ -41,30 +78,67 @@ public:
 
     virtual const double getLogLikelihood() const = 0;
     virtual const double getLogPrior() const = 0;
+    const double getCachedLogLikelihood() const {
+        size_t epoch = getCacheEpoch();
+        if (not m_logLikelihoodCache.isValid(epoch))
+            m_logLikelihoodCache.set(getLogLikelihood(), epoch);
+        return m_logLikelihoodCache.get();
+    }
     const double getLogJoint() const {
-        return processRecursiveConstFunction<double>([&](){return getLogLikelihood() + getLogPrior();}, 0);
+        return processRecursiveConstFunction<double>([&](){return getCachedLogLikelihood() + getLogPrior();}, 0);
     }
 
     virtual const double getLogLikelihoodRatioFromGraphMove (const GraphMove& move) const = 0;
     virtual const double getLogPriorRatioFromGraphMove (const GraphMove& move) const = 0;
     const double getLogJointRatioFromGraphMove (const GraphMove& move) const{
-        return processRecursiveFunction<double>([&](){ return getLogPriorRatioFromGraphMove(move) + getLogLikelihoodRatioFromGraphMove(move); }, 0);
+        return processRecursiveFunction<double>([&](){
+            double logLikelihoodRatio = getLogLikelihoodRatioFromGraphMove(move);
+            m_graphMoveLogLikelihoodRatio.record(move, logLikelihoodRatio, m_appliedMoveCount, getCacheEpoch());
+            return getLogPriorRatioFromGraphMove(move) + logLikelihoodRatio;
+        }, 0);
     }
     void applyGraphMove(const GraphMove& move){
-        processRecursiveFunction([&](){ _applyGraphMove(move); });
+        processRecursiveFunction([&](){
+            updateLogLikelihoodCache(m_graphMoveLogLikelihoodRatio, move, [&](){ return getLogLikelihoodRatioFromGraphMove(move); });
+            _applyGraphMove(move);
+        });
         #if DEBUG
         checkConsistency();
         #endif
     }
 
     virtual const bool isCompatible(const MultiGraph& graph) const { return graph.getSize() == m_size; }
+    /* The tracker is owned by the caller. */
+    virtual GraphCompatibilityTracker* getCompatibilityTracker() const;
     virtual bool isSafe() const { return true; }
 };
 
+/* Fallback tracker, which moves a copy of the graph and compares it with `isCompatible`. */
+class GenericGraphCompatibilityTracker: public GraphCompatibilityTracker{
+    const RandomGraph& m_randomGraph;
+    MultiGraph m_graph;
+public:
+    GenericGraphCompatibilityTracker(const RandomGraph& randomGraph): m_randomGraph(randomGraph) { }
+    void setGraph(const MultiGraph& graph) override { m_graph = graph; }
+    void applyGraphMove(const GraphMove& move) override {
+        for (auto edge: move.removedEdges)
+            m_graph.removeEdgeIdx(edge.first, edge.second);
+        for (auto edge: move.addedEdges)
+            m_graph.addEdgeIdx(edge.first, edge.second);
+    }
+    const bool isCompatible() const override { return m_randomGraph.isCompatible(m_graph); }
+};
+
+inline GraphCompatibilityTracker* RandomGraph::getCompatibilityTracker() const {
+    return new GenericGraphCompatibilityTracker(*this);
+}
+
 template <typename Label>
 class VertexLabeledRandomGraph: public RandomGraph{
 protected:
     virtual void _applyLabelMove(const LabelMove<Label>&) { };
+    mutable MoveLogRatioRecord<LabelMove<Label>> m_labelMoveLogLikelihoodRatio;
+    mutable MoveDiff<Label> m_moveDiff;
 public:
     using RandomGraph::RandomGraph;
     virtual const std::vector<Label>& getLabels() const = 0;
@@ -74,16 +148,34 @@ public:
     virtual const MultiGraph& getLabelGraph() const = 0;
     const Label& getLabelOfIdx(BaseGraph::VertexIndex vertexIdx) const { return getLabels()[vertexIdx]; }
 
+    const MoveDiff<Label>& getMoveDiff(const GraphMove& move) const {
+        size_t epoch = getCacheEpoch();
+        if (not m_moveDiff.isComputedFor(move, m_appliedMoveCount, epoch))
+            m_moveDiff.computeFromGraphMove(getLabels(), move, m_appliedMoveCount, epoch);
+        return m_moveDiff;
+    }
+    const MoveDiff<Label>& getMoveDiff(const LabelMove<Label>& move) const {
+        size_t epoch = getCacheEpoch();
+        if (not m_moveDiff.isComputedFor(move, m_appliedMoveCount, epoch))
+            m_moveDiff.computeFromLabelMove(m_graph, getLabels(), move, m_appliedMoveCount, epoch);
+        return m_moveDiff;
+    }
+
     virtual void setLabels(const std::vector<Label>&) = 0;
     virtual void sampleLabels() = 0;
 
     virtual const double getLogLikelihoodRatioFromLabelMove (const LabelMove<Label>& move) const = 0;
     virtual const double getLogPriorRatioFromLabelMove (const LabelMove<Label>& move) const = 0;
     const double getLogJointRatioFromLabelMove (const LabelMove<Label>& move) const{
-        return getLogPriorRatioFromLabelMove(move) + getLogLikelihoodRatioFromLabelMove(move);
+        double logLikelihoodRatio = getLogLikelihoodRatioFromLabelMove(move);
+        m_labelMoveLogLikelihoodRatio.record(move, logLikelihoodRatio, m_appliedMoveCount, getCacheEpoch());
+        return getLogPriorRatioFromLabelMove(move) + logLikelihoodRatio;
     }
     void applyLabelMove(const LabelMove<Label>& move) {
-        processRecursiveFunction([&](){ _applyLabelMove(move); });
+        processRecursiveFunction([&](){
+            updateLogLikelihoodCache(m_labelMoveLogLikelihoodRatio, move, [&](){ return getLogLikelihoodRatioFromLabelMove(move); });
+            _applyLabelMove(move);
+        });
         #if DEBUG
         checkConsistency();
         #endif
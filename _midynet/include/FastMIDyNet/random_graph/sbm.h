@@ -15,6 +15,30 @@
 
 namespace FastMIDyNet{
 
+/* Follows the edge matrix of the graph for fixed labels, so that a move only
+ * updates the entries of its edges. */
+class EdgeMatrixCompatibilityTracker: public GraphCompatibilityTracker{
+protected:
+    const size_t m_size;
+    const BlockSequence m_labels;
+    size_t m_blockCount = 0;
+    bool m_isBlockCountCompatible, m_isSizeCompatible = false;
+    std::vector<size_t> m_edgeMatrix, m_expectedEdgeMatrix;
+    size_t m_mismatchCount = 0;
+
+    size_t getEntryIdx(BlockIndex r, BlockIndex s) const {
+        return r < s ? r * m_blockCount + s : s * m_blockCount + r;
+    }
+    void updateEntry(const BaseGraph::Edge& edge, bool isAdded);
+public:
+    EdgeMatrixCompatibilityTracker(size_t size, const BlockSequence& labels, const MultiGraph& expectedEdgeMatrix);
+    void setGraph(const MultiGraph& graph) override;
+    void applyGraphMove(const GraphMove& move) override;
+    const bool isCompatible() const override {
+        return m_isSizeCompatible and m_isBlockCountCompatible and m_mismatchCount == 0;
+    }
+};
+
 class StochasticBlockModelFamily: public BlockLabeledRandomGraph{
 protected:
     BlockPrior* m_blockPriorPtr = nullptr;
@@ -24,9 +48,6 @@ protected:
     virtual void _applyLabelMove (const BlockMove&) override;
     virtual const double getLogLikelihoodRatioEdgeTerm (const GraphMove&) const;
     virtual const double getLogLikelihoodRatioAdjTerm (const GraphMove&) const;
-    void getDiffEdgeMatMapFromEdgeMove(const BaseGraph::Edge&, int, IntMap<std::pair<BlockIndex, BlockIndex>>&) const;
-    void getDiffAdjMatMapFromEdgeMove(const BaseGraph::Edge&, int, IntMap<std::pair<BaseGraph::VertexIndex, BaseGraph::VertexIndex>>&) const;
-    void getDiffEdgeMatMapFromBlockMove(const BlockMove&, IntMap<std::pair<BlockIndex, BlockIndex>>&) const;
 
 public:
     StochasticBlockModelFamily(size_t graphSize): VertexLabeledRandomGraph<BlockIndex>(graphSize) { }
@@ -36,6 +57,14 @@ public:
             m_blockPriorPtr->setSize(graphSize);
             setEdgeMatrixPrior(edgeMatrixPrior);
         }
+    StochasticBlockModelFamily* clone() const override { return new StochasticBlockModelFamily(*this); }
+    /* The edge matrix prior of the clone refers to the graph of the clone. */
+    void remapDependencies(CloneMap& cloneMap) override {
+        cloneMap.remap(m_blockPriorPtr);
+        cloneMap.remap(m_edgeMatrixPriorPtr);
+        if (m_edgeMatrixPriorPtr != nullptr)
+            m_edgeMatrixPriorPtr->rebindGraph(m_graph);
+    }
 
     void sample () override;
     void sampleLabels() override {
@@ -56,6 +85,7 @@ public:
     const BlockPrior& getBlockPrior() const { return *m_blockPriorPtr; }
     BlockPrior& getBlockPriorRef() const { return *m_blockPriorPtr; }
     virtual void setBlockPrior(BlockPrior& blockPrior) {
+        invalidateCaches();
         m_blockPriorPtr = &blockPrior;
         m_blockPriorPtr->isRoot(false);
         m_blockPriorPtr->setSize(m_size);
@@ -66,6 +96,7 @@ public:
     const EdgeMatrixPrior& getEdgeMatrixPrior() const { return *m_edgeMatrixPriorPtr; }
     EdgeMatrixPrior& getEdgeMatrixPriorRef() const { return *m_edgeMatrixPriorPtr; }
     virtual void setEdgeMatrixPrior(EdgeMatrixPrior& edgeMatrixPrior) {
+        invalidateCaches();
         m_edgeMatrixPriorPtr = &edgeMatrixPrior;
         m_edgeMatrixPriorPtr->isRoot(false);
         m_edgeMatrixPriorPtr->setBlockPrior(*m_blockPriorPtr);
@@ -99,11 +130,18 @@ public:
         auto edgeMatrix = getEdgeMatrixFromGraph(graph, getLabels());
         return edgeMatrix.getAdjacencyMatrix() == m_edgeMatrixPriorPtr->getState().getAdjacencyMatrix();
     };
+    virtual GraphCompatibilityTracker* getCompatibilityTracker() const override {
+        return new EdgeMatrixCompatibilityTracker(m_size, getLabels(), m_edgeMatrixPriorPtr->getState());
+    }
     virtual void computationFinished() const override {
         m_isProcessed = false;
         m_blockPriorPtr->computationFinished();
         m_edgeMatrixPriorPtr->computationFinished();
     }
+    size_t getCacheEpoch() const override {
+        return m_cacheEpoch + (m_blockPriorPtr ? m_blockPriorPtr->getCacheEpoch() : 0)
+            + (m_edgeMatrixPriorPtr ? m_edgeMatrixPriorPtr->getCacheEpoch() : 0);
+    }
 };
 
 }// end FastMIDyNet
@@ -8,8 +8,11 @@
 
 namespace FastMIDyNet {
 
-extern RNG rng;
-extern size_t SEED;
+/* Each thread has its own generator and seed, so that chains run in parallel threads
+ * do not share their random stream. A thread must be seeded before sampling, its
+ * generator having the default seed otherwise. */
+extern thread_local RNG rng;
+extern thread_local size_t SEED;
 
 void seed(size_t n);
 void seedWithTime();
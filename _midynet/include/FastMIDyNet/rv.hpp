@@ -1,12 +1,17 @@
 #ifndef FAST_MIDYNET_RV_HPP
 #define FAST_MIDYNET_RV_HPP
 
+#include <cstddef>
 #include <functional>
+#include <stdexcept>
 
 namespace FastMIDyNet{
 
+class CloneMap;
+
 class NestedRandomVariable{
 public:
+    virtual ~NestedRandomVariable(){}
 
     bool isRoot() const { return m_isRoot; }
     virtual bool isRoot(bool condition) const { return m_isRoot = condition; }
@@ -20,6 +25,23 @@ public:
     void checkConsistency() const { processRecursiveConstFunction([&]() { checkSelfConsistency(); }); }
     void checkSafety() const { processRecursiveConstFunction([&]() { checkSelfSafety(); }); }
 
+    /* Copy of the most derived object, made by its copy constructor. The pointers of the
+     * copy still refer to the dependencies of the original until `remapDependencies`
+     * redirects them to their clones; use `CloneMap::get` rather than calling these directly. */
+    virtual NestedRandomVariable* clone() const {
+        throw std::logic_error("NestedRandomVariable: cloning is not implemented for this class.");
+    }
+    virtual void remapDependencies(CloneMap&) { }
+
+    /* Epoch of the caches of log-probabilities of this variable, which increases whenever
+     * its state or the state of one of its dependencies is changed otherwise than through a
+     * move. The caches are only valid for the epoch at which they were set, so that changes
+     * made to a model never invalidate the caches of another one. Variables with
+     * dependencies add their epochs to their own, and invalidate their caches before
+     * replacing a dependency so that the sum never goes back to a previous value. */
+    virtual size_t getCacheEpoch() const { return m_cacheEpoch; }
+    void invalidateCaches() { m_cacheEpoch = getCacheEpoch() + 1; }
+
 protected:
     template<typename RETURN_TYPE>
     RETURN_TYPE processRecursiveConstFunction(const std::function<RETURN_TYPE()>& func, RETURN_TYPE init) const {
@@ -59,6 +81,7 @@ protected:
 
     mutable bool m_isRoot = true;
     mutable bool m_isProcessed = false;
+    size_t m_cacheEpoch = 0;
 };
 
 }
@@ -0,0 +1,73 @@
+#ifndef FAST_MIDYNET_CACHE_HPP
+#define FAST_MIDYNET_CACHE_HPP
+
+#include <cmath>
+#include <limits>
+
+
+namespace FastMIDyNet{
+
+/* Running value of a log-probability, updated incrementally with the ratios of
+ * the moves applied to its owner. The value is only valid for the cache epoch of
+ * its owner at which it was set (see `NestedRandomVariable::getCacheEpoch`), so
+ * that states changed otherwise than through a move (setState, sample, setGraph,
+ * ...) must call `invalidateCaches()`; it is also recomputed exactly every
+ * `RECOMPUTATION_PERIOD` updates to contain the floating point drift. */
+class LogProbabilityCache{
+public:
+    static constexpr size_t INVALID_EPOCH = std::numeric_limits<size_t>::max();
+    static constexpr size_t RECOMPUTATION_PERIOD = 1000;
+
+    bool isValid(size_t epoch) const { return m_epoch == epoch and m_updateCount < RECOMPUTATION_PERIOD; }
+    const double get() const { return m_value; }
+    void set(double value, size_t epoch) {
+        m_value = value;
+        m_epoch = epoch;
+        m_updateCount = 0;
+    }
+    void update(double logRatio, size_t epoch) {
+        if (m_epoch != epoch)
+            return;
+        m_value += logRatio;
+        ++m_updateCount;
+        // an impossible state cannot be left through ratios, which are infinite as well
+        if (not std::isfinite(m_value))
+            invalidate();
+    }
+    void invalidate() { m_epoch = INVALID_EPOCH; }
+
+private:
+    double m_value = 0;
+    size_t m_epoch = INVALID_EPOCH;
+    size_t m_updateCount = 0;
+};
+
+/* Last log-ratio evaluated for a move, kept so that applying the same move
+ * can update a `LogProbabilityCache` without evaluating the ratio again. */
+template<typename MoveType>
+class MoveLogRatioRecord{
+public:
+    void record(const MoveType& move, double logRatio, size_t stamp, size_t epoch) {
+        m_move = move;
+        m_logRatio = logRatio;
+        m_stamp = stamp;
+        m_epoch = epoch;
+    }
+    bool find(const MoveType& move, size_t stamp, size_t epoch, double& logRatio) const {
+        if (m_epoch != epoch or m_stamp != stamp or not (m_move == move))
+            return false;
+        logRatio = m_logRatio;
+        return true;
+    }
+    void clear() { m_epoch = LogProbabilityCache::INVALID_EPOCH; }
+
+private:
+    MoveType m_move;
+    double m_logRatio = 0;
+    size_t m_stamp = 0;
+    size_t m_epoch = LogProbabilityCache::INVALID_EPOCH;
+};
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef FAST_MIDYNET_EDGE_MARGINALS_H
+#define FAST_MIDYNET_EDGE_MARGINALS_H
+
+#include <limits>
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+
+
+namespace FastMIDyNet{
+
+/* Time-weighted histograms of the multiplicity of the edges of a graph whose edges
+ * change one at a time. The weight of a multiplicity is the time during which the edge
+ * had it, the time being advanced by `advance`. An edge is only updated when its
+ * multiplicity changes, so that the weight of its current multiplicity is credited
+ * lazily, and advancing the time costs O(1) whatever the number of edges.
+ *
+ * The histograms are stored contiguously in the order in which the edges were first
+ * seen, and located by an open-addressing table with linear probing. Each histogram
+ * holds the weights of the multiplicities 1 to `HISTOGRAM_WIDTH`, those of higher
+ * multiplicities being stored apart. The weight of multiplicity 0 is the remainder of
+ * the time. Edges are ordered pairs. */
+class EdgeMarginalAccumulator{
+public:
+    static const size_t HISTOGRAM_WIDTH = 4;
+
+    EdgeMarginalAccumulator(size_t capacity=16);
+
+    void setMultiplicity(const BaseGraph::Edge& edge, size_t multiplicity);
+    void addMultiplicity(const BaseGraph::Edge& edge, int delta);
+    /* Sets the multiplicity of every edge to its multiplicity in `graph`. */
+    void setGraph(const MultiGraph& graph);
+    void advance(double time=1) { m_time += time; }
+    void clear();
+
+    const double getTime() const { return m_time; }
+    const size_t getTotalMultiplicity() const { return m_totalMultiplicity; }
+    const size_t size() const { return m_histograms.size(); }
+    const size_t getMultiplicity(const BaseGraph::Edge& edge) const ;
+
+    const double getWeight(const BaseGraph::Edge& edge, size_t multiplicity) const ;
+    const double getProb(const BaseGraph::Edge& edge, size_t multiplicity) const { return getWeight(edge, multiplicity) / m_time; }
+    /* An edge is observed if it had a positive multiplicity for a positive time. */
+    const bool isObserved(const BaseGraph::Edge& edge) const ;
+    const size_t getMaxObservedMultiplicity(const BaseGraph::Edge& edge) const ;
+    const size_t getMaxObservedMultiplicity() const ;
+    const std::vector<BaseGraph::Edge> getObservedEdges() const ;
+    /* Writes the probabilities of the multiplicities 0 to `columnCount - 1` of the
+     * observed edges, in the order of `getObservedEdges`, as the rows of `probs`. */
+    void getProbs(double* probs, size_t columnCount) const ;
+
+    const double getEntropy() const ;
+    /* Log of the product of the marginals of the observed edges evaluated at `graph`. */
+    const double getLogProb(const MultiGraph& graph) const ;
+
+private:
+    struct EdgeHistogram{
+        BaseGraph::Edge edge;
+        size_t multiplicity = 0;
+        double since = 0;
+        double weights[HISTOGRAM_WIDTH] = {};
+        size_t overflowIdx = NO_OVERFLOW;
+    };
+    static constexpr size_t EMPTY_SLOT = std::numeric_limits<size_t>::max();
+    static constexpr size_t NO_OVERFLOW = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> m_slots;
+    std::vector<EdgeHistogram> m_histograms;
+    std::vector<std::vector<double>> m_overflowWeights;
+    double m_time = 0;
+    size_t m_totalMultiplicity = 0;
+
+    static size_t hashEdge(const BaseGraph::Edge& edge);
+    size_t findSlot(const BaseGraph::Edge& edge) const ;
+    const EdgeHistogram* find(const BaseGraph::Edge& edge) const ;
+    EdgeHistogram& findOrInsert(const BaseGraph::Edge& edge);
+    void rehash(size_t tableSize);
+
+    double& getStoredWeight(EdgeHistogram& histogram, size_t multiplicity);
+    const double getWeight(const EdgeHistogram& histogram, size_t multiplicity) const ;
+    const double getObservedWeight(const EdgeHistogram& histogram) const ;
+    const size_t getMaxObservedMultiplicity(const EdgeHistogram& histogram) const ;
+};
+
+}
+
+#endif
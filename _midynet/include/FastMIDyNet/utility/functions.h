@@ -1,6 +1,7 @@
 #ifndef FAST_MIDYNET_UTIL_FUNCTIONS_H
 #define FAST_MIDYNET_UTIL_FUNCTIONS_H
 
+#include <cmath>
 #include <list>
 #include <vector>
 #include <utility>
@@ -29,6 +30,35 @@ MultiGraph getSubGraphByBlocks(const MultiGraph& graph, const BlockSequence& blo
 double clip(double x, double min, double max);
 double clipProb(double p, double epsilon=1e-15);
 
+/* Streaming log-sum-exp, rescaled on the running maximum. */
+class LogSumExp{
+public:
+    void add(double x){
+        if (not (x > -INFINITY))
+            return;
+        if (x <= m_max)
+            m_sum += exp(x - m_max);
+        else {
+            m_sum = m_sum * exp(m_max - x) + 1;
+            m_max = x;
+        }
+    }
+    void merge(const LogSumExp& other){
+        if (other.m_sum == 0)
+            return;
+        if (other.m_max <= m_max)
+            m_sum += other.m_sum * exp(other.m_max - m_max);
+        else {
+            m_sum = m_sum * exp(m_max - other.m_max) + other.m_sum;
+            m_max = other.m_max;
+        }
+    }
+    const double get() const { return (m_sum == 0) ? -INFINITY : m_max + log(m_sum); }
+private:
+    double m_max = -INFINITY;
+    double m_sum = 0;
+};
+
 template<typename T>
 std::vector<T> listToVec(std::list<T> other){
     std::vector<T> myVec;
@@ -0,0 +1,80 @@
+#ifndef FAST_MIDYNET_GRAPH_ENUMERATION_H
+#define FAST_MIDYNET_GRAPH_ENUMERATION_H
+
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+#include "FastMIDyNet/proposer/movetypes.h"
+
+
+namespace FastMIDyNet{
+
+size_t getBinomialCoefficient(size_t n, size_t k);
+
+/* Gray codes over the multiplicities of `slotCount` slots summing to `total`.
+ * Consecutive states differ by one unit moved from one slot to another, and
+ * the enumeration can start at any rank of the sequence. */
+class MultiplicityGrayCode{
+public:
+    virtual ~MultiplicityGrayCode(){}
+    const std::vector<size_t>& getState() const { return m_state; }
+    const size_t getRank() const { return m_rank; }
+    virtual const size_t getStateCount() const = 0;
+    virtual bool next(size_t& decrementedSlot, size_t& incrementedSlot) = 0;
+protected:
+    std::vector<size_t> m_state;
+    size_t m_rank = 0;
+};
+
+/* Weak compositions, by reflection on the multiplicity of the last slot. */
+class CompositionGrayCode: public MultiplicityGrayCode{
+public:
+    CompositionGrayCode(size_t total, size_t slotCount, size_t rank=0);
+    const size_t getStateCount() const override { return getBinomialCoefficient(m_total + m_state.size() - 1, m_state.size() - 1); }
+    bool next(size_t& decrementedSlot, size_t& incrementedSlot) override;
+private:
+    size_t m_total;
+    bool step(size_t slotCount, bool forward, size_t total, size_t& decrementedSlot, size_t& incrementedSlot);
+    void unrank(size_t slotCount, bool forward, size_t total, size_t rank);
+};
+
+/* Combinations without repetition, in revolving door order (Knuth's algorithm R). */
+class CombinationGrayCode: public MultiplicityGrayCode{
+public:
+    CombinationGrayCode(size_t total, size_t slotCount, size_t rank=0);
+    const size_t getStateCount() const override { return getBinomialCoefficient(m_state.size(), m_total); }
+    bool next(size_t& decrementedSlot, size_t& incrementedSlot) override;
+private:
+    size_t m_total;
+    std::vector<size_t> m_combination;
+    void replace(size_t removed, size_t added, size_t& decrementedSlot, size_t& incrementedSlot);
+};
+
+/* Enumerates the graphs of `size` vertices and `edgeCount` edges with ranks in
+ * [firstRank, lastRank); consecutive graphs differ by a single edge move. */
+class GraphEnumerator{
+public:
+    GraphEnumerator(size_t size, size_t edgeCount, bool allowSelfLoops=true, bool allowMultiEdges=true, size_t firstRank=0, size_t lastRank=-1);
+    GraphEnumerator(const GraphEnumerator&) = delete;
+    ~GraphEnumerator() { delete m_grayCode; }
+
+    static size_t getGraphCount(size_t size, size_t edgeCount, bool allowSelfLoops=true, bool allowMultiEdges=true);
+    const size_t getGraphCount() const { return m_grayCode->getStateCount(); }
+    const size_t getRank() const { return m_grayCode->getRank(); }
+
+    const std::vector<BaseGraph::Edge>& getEdges() const { return m_edges; }
+    const std::vector<size_t>& getEdgeMultiplicities() const { return m_grayCode->getState(); }
+    MultiGraph getGraph() const;
+    bool next(GraphMove& move);
+
+private:
+    size_t m_size;
+    size_t m_lastRank;
+    std::vector<BaseGraph::Edge> m_edges;
+    MultiplicityGrayCode* m_grayCode = nullptr;
+};
+
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef FAST_MIDYNET_GRAPH_SNAPSHOT_H
+#define FAST_MIDYNET_GRAPH_SNAPSHOT_H
+
+#include <cstdint>
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+
+
+namespace FastMIDyNet{
+
+typedef std::vector<std::pair<BaseGraph::Edge, size_t>> EdgeMultiplicityList;
+
+/* Compact immutable copy of a multigraph. Each adjacency row (neighbors u >= v of
+ * vertex v) is stored sorted, as varint-encoded gaps between neighbors followed
+ * by their varint-encoded multiplicity. */
+class GraphSnapshot{
+public:
+    GraphSnapshot() {}
+    explicit GraphSnapshot(const MultiGraph& graph);
+
+    MultiGraph getGraph() const;
+    const size_t getSize() const { return m_size; }
+    const size_t getEdgeCount() const { return m_edgeCount; }
+    const size_t getByteCount() const { return m_bytes.size(); }
+
+    static EdgeMultiplicityList getEdgeMultiplicities(const MultiGraph& graph);
+    static std::vector<uint8_t> encode(size_t size, const EdgeMultiplicityList& edges);
+    static EdgeMultiplicityList decode(const std::vector<uint8_t>& bytes, size_t& size);
+
+private:
+    size_t m_size = 0;
+    size_t m_edgeCount = 0;
+    std::vector<uint8_t> m_bytes;
+};
+
+/* Append-only sequence of graphs of the same size. Every `keyframePeriod`-th graph
+ * is stored as a full snapshot and the others as the multiplicity changes from the
+ * previous graph, so a graph is decoded from its keyframe and the following diffs.
+ * A period of 1 disables the diffs. */
+class GraphSnapshotSequence{
+public:
+    explicit GraphSnapshotSequence(size_t keyframePeriod=64);
+
+    void push(const MultiGraph& graph);
+    MultiGraph getGraph(size_t index) const;
+    std::vector<MultiGraph> getGraphs() const;
+    const size_t size() const { return m_frames.size(); }
+    const size_t getKeyframePeriod() const { return m_keyframePeriod; }
+    const size_t getByteCount() const;
+    void clear() { m_frames.clear(); m_lastEdges.clear(); }
+
+private:
+    size_t m_keyframePeriod;
+    size_t m_graphSize = 0;
+    std::vector<std::vector<uint8_t>> m_frames;
+    EdgeMultiplicityList m_lastEdges;
+
+    bool isKeyframe(size_t index) const { return index % m_keyframePeriod == 0; }
+    std::vector<uint8_t> encodeDiff(const EdgeMultiplicityList& prevEdges, const EdgeMultiplicityList& nextEdges) const;
+    void applyDiff(const std::vector<uint8_t>& bytes, EdgeMultiplicityList& edges) const;
+    MultiGraph buildGraph(const EdgeMultiplicityList& edges) const;
+};
+
+}
+
+#endif
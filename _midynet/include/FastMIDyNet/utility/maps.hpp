@@ -8,6 +8,8 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <limits>
+#include <functional>
 
 namespace FastMIDyNet{
 
@@ -125,6 +127,128 @@ public:
 
 };
 
+/* Open-addressing map from keys to integer differences, with linear probing.
+ * Entries are stored contiguously in insertion order and `clear()` only resets
+ * the occupied slots, so that an instance can be reused from one move to the
+ * next without allocating. */
+template < typename KeyType >
+class FlatIntMap{
+public:
+    typedef std::pair<KeyType, int> Entry;
+
+    FlatIntMap(size_t capacity=16): m_slots(getTableSize(capacity), EMPTY_SLOT) { }
+
+    size_t size() const { return m_entries.size(); }
+    bool isEmpty(const KeyType& key) const { return m_slots[findSlot(key)] == EMPTY_SLOT; }
+    int get(const KeyType& key) const {
+        size_t entryIdx = m_slots[findSlot(key)];
+        return (entryIdx == EMPTY_SLOT) ? 0 : m_entries[entryIdx].second;
+    }
+    int operator[](const KeyType& key) const { return get(key); }
+
+    void increment(const KeyType& key, int inc=1){
+        size_t slot = findSlot(key);
+        if (m_slots[slot] != EMPTY_SLOT){
+            m_entries[m_slots[slot]].second += inc;
+            return;
+        }
+        m_slots[slot] = m_entries.size();
+        m_entries.push_back({key, inc});
+        m_occupiedSlots.push_back(slot);
+        if (2 * m_entries.size() > m_slots.size())
+            rehash(2 * m_slots.size());
+    }
+    void decrement(const KeyType& key, int dec=1){ increment(key, -dec); }
+    void set(const KeyType& key, int value){
+        size_t slot = findSlot(key);
+        if (m_slots[slot] != EMPTY_SLOT)
+            m_entries[m_slots[slot]].second = value;
+        else
+            increment(key, value);
+    }
+
+    /* The last entry takes the place of the erased one, and the following slots
+     * of the probing cluster are shifted back so that no tombstone is needed. */
+    void erase(const KeyType& key){
+        size_t hole = findSlot(key);
+        size_t entryIdx = m_slots[hole];
+        if (entryIdx == EMPTY_SLOT)
+            return;
+        if (entryIdx != m_entries.size() - 1){
+            m_entries[entryIdx] = m_entries.back();
+            m_occupiedSlots[entryIdx] = m_occupiedSlots.back();
+            m_slots[m_occupiedSlots[entryIdx]] = entryIdx;
+        }
+        m_entries.pop_back();
+        m_occupiedSlots.pop_back();
+
+        const size_t mask = m_slots.size() - 1;
+        m_slots[hole] = EMPTY_SLOT;
+        for (size_t slot = (hole + 1) & mask; m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask){
+            size_t home = hashKey(m_entries[m_slots[slot]].first) & mask;
+            if (((slot - home) & mask) < ((slot - hole) & mask))
+                continue;
+            m_slots[hole] = m_slots[slot];
+            m_occupiedSlots[m_slots[hole]] = hole;
+            m_slots[slot] = EMPTY_SLOT;
+            hole = slot;
+        }
+    }
+
+    void clear(){
+        for (auto slot : m_occupiedSlots)
+            m_slots[slot] = EMPTY_SLOT;
+        m_occupiedSlots.clear();
+        m_entries.clear();
+    }
+
+    typename std::vector<Entry>::const_iterator begin() const { return m_entries.begin(); }
+    typename std::vector<Entry>::const_iterator end() const { return m_entries.end(); }
+
+private:
+    static constexpr size_t EMPTY_SLOT = std::numeric_limits<size_t>::max();
+    std::vector<size_t> m_slots;
+    std::vector<size_t> m_occupiedSlots;
+    std::vector<Entry> m_entries;
+
+    static size_t getTableSize(size_t capacity){
+        size_t tableSize = 2;
+        while (tableSize < 2 * capacity)
+            tableSize *= 2;
+        return tableSize;
+    }
+    static size_t mix(size_t x){
+        x ^= x >> 31;
+        x *= 0x7fb5d329728ea185ULL;
+        x ^= x >> 27;
+        return x;
+    }
+    template < typename T >
+    static size_t hashKey(const T& key){ return mix(std::hash<T>()(key)); }
+    template < typename T, typename U >
+    static size_t hashKey(const std::pair<T, U>& key){ return mix(hashKey(key.first) + std::hash<U>()(key.second)); }
+
+    size_t findSlot(const KeyType& key) const {
+        const size_t mask = m_slots.size() - 1;
+        size_t slot = hashKey(key) & mask;
+        while (m_slots[slot] != EMPTY_SLOT and not (m_entries[m_slots[slot]].first == key))
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+    void rehash(size_t tableSize){
+        m_slots.assign(tableSize, EMPTY_SLOT);
+        m_occupiedSlots.clear();
+        for (size_t entryIdx = 0; entryIdx < m_entries.size(); ++entryIdx){
+            size_t slot = findSlot(m_entries[entryIdx].first);
+            m_slots[slot] = entryIdx;
+            m_occupiedSlots.push_back(slot);
+        }
+    }
+};
+
+template < typename KeyType >
+constexpr size_t FlatIntMap<KeyType>::EMPTY_SLOT;
+
 template < typename T >
 class OrderedPair: public std::pair<T, T>{
 public:
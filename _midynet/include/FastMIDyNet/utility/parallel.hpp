@@ -0,0 +1,54 @@
+#ifndef FAST_MIDYNET_PARALLEL_HPP
+#define FAST_MIDYNET_PARALLEL_HPP
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace FastMIDyNet{
+
+inline size_t getThreadCount(size_t numThreads=0){
+    if (numThreads != 0)
+        return numThreads;
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads == 0) ? 1 : hardwareThreads;
+}
+
+/* Splits [0, count) into contiguous chunks, each processed by `function(begin, end)`
+ * on its own thread; `numThreads=0` uses every hardware thread. The first exception
+ * thrown by a chunk is rethrown in the calling thread once all chunks are done. */
+template<typename Function>
+void parallelFor(size_t count, size_t numThreads, const Function& function){
+    size_t threadCount = std::min(getThreadCount(numThreads), count);
+    if (threadCount <= 1){
+        if (count > 0)
+            function(0, count);
+        return;
+    }
+    size_t chunkSize = count / threadCount + (count % threadCount != 0);
+
+    std::vector<std::exception_ptr> errors(threadCount, nullptr);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+        threads.push_back(std::thread([&, i](){
+            size_t begin = i * chunkSize, end = std::min(begin + chunkSize, count);
+            try {
+                if (begin < end)
+                    function(begin, end);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }));
+    for (auto& thread : threads)
+        thread.join();
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+}
+
+#endif
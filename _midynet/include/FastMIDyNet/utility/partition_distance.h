@@ -0,0 +1,71 @@
+#ifndef FAST_MIDYNET_PARTITION_DISTANCE_H
+#define FAST_MIDYNET_PARTITION_DISTANCE_H
+
+#include <string>
+#include <vector>
+
+#include "FastMIDyNet/types.h"
+
+
+namespace FastMIDyNet{
+
+/* Numbers of vertices of each pair of blocks of two partitions of the same vertices. The
+ * labels are renumbered from 0 in order of first appearance, so that empty blocks are
+ * ignored, and the table is built in O(N + B1 B2). */
+class ContingencyTable{
+public:
+    ContingencyTable(const BlockSequence& partition1, const BlockSequence& partition2);
+
+    const size_t getSize() const { return m_size; }
+    const size_t getRowCount() const { return m_rowSums.size(); }
+    const size_t getColumnCount() const { return m_columnSums.size(); }
+    const size_t get(BlockIndex r, BlockIndex s) const { return m_counts[r * getColumnCount() + s]; }
+    const std::vector<size_t>& getRowSums() const { return m_rowSums; }
+    const std::vector<size_t>& getColumnSums() const { return m_columnSums; }
+    /* Original labels of the rows and columns. */
+    const std::vector<BlockIndex>& getRowLabels() const { return m_rowLabels; }
+    const std::vector<BlockIndex>& getColumnLabels() const { return m_columnLabels; }
+
+    const double getMutualInformation() const ;
+    const double getRowEntropy() const { return getEntropy(m_rowSums, m_size); }
+    const double getColumnEntropy() const { return getEntropy(m_columnSums, m_size); }
+    static double getEntropy(const std::vector<size_t>& blockSizes, size_t size);
+
+private:
+    size_t m_size;
+    std::vector<size_t> m_counts;
+    std::vector<size_t> m_rowSums;
+    std::vector<size_t> m_columnSums;
+    std::vector<BlockIndex> m_rowLabels;
+    std::vector<BlockIndex> m_columnLabels;
+};
+
+/* Entropies and information are in nats. The NMI is 2 I / (H1 + H2), and 1 if both
+ * partitions have a single block. */
+double getPartitionEntropy(const BlockSequence& partition);
+double getMutualInformation(const BlockSequence& partition1, const BlockSequence& partition2);
+double getNormalizedMutualInformation(const BlockSequence& partition1, const BlockSequence& partition2);
+double getVariationOfInformation(const BlockSequence& partition1, const BlockSequence& partition2);
+
+/* One-to-one matching of rows to columns of largest total weight, by the Hungarian
+ * algorithm in O(K^3) with K = max(rows, columns). Each row is given the index of its
+ * column, or `columnCount` if there are more rows than columns. */
+std::vector<size_t> getMaximumWeightMatching(const std::vector<std::vector<double>>& weights, size_t columnCount);
+
+/* Relabels `partition` so that its blocks overlap those of `reference` the most. The
+ * blocks not matched to a block of `reference` take labels above those of `reference`. */
+BlockSequence alignPartition(const BlockSequence& partition, const BlockSequence& reference);
+/* Fraction of the vertices with the same label in `reference` and in the aligned `partition`. */
+double getAlignedAccuracy(const BlockSequence& partition, const BlockSequence& reference);
+
+/* Distance between each pair of partitions, computed in parallel on `numThreads` threads
+ * (every hardware thread for 0). The metrics are "vi" (variation of information), "nmi"
+ * (1 - NMI) and "accuracy" (1 - aligned accuracy). */
+double getPartitionDistance(const BlockSequence& partition1, const BlockSequence& partition2, const std::string& metric);
+std::vector<std::vector<double>> getPartitionDistanceMatrix(
+    const std::vector<BlockSequence>& partitions, const std::string& metric="vi", size_t numThreads=0
+);
+
+}
+
+#endif
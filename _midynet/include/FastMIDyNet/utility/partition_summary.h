@@ -0,0 +1,88 @@
+#ifndef FAST_MIDYNET_PARTITION_SUMMARY_H
+#define FAST_MIDYNET_PARTITION_SUMMARY_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/types.h"
+#include "FastMIDyNet/types.h"
+
+
+namespace FastMIDyNet{
+
+/* Partition of which the labels are renumbered in order of first appearance, so that
+ * partitions equal up to a permutation of their labels are equal, and packed in words
+ * with the least number of bits per label. */
+class CompressedPartition{
+public:
+    CompressedPartition() {}
+    explicit CompressedPartition(const BlockSequence& partition);
+
+    BlockSequence getPartition() const;
+    const size_t getSize() const { return m_size; }
+    const size_t getByteCount() const { return m_words.size() * sizeof(uint64_t); }
+
+    static BlockSequence getCanonicalPartition(const BlockSequence& partition);
+private:
+    size_t m_size = 0;
+    size_t m_bitWidth = 0;
+    std::vector<uint64_t> m_words;
+};
+
+/* Label-switching invariant summary of a stream of partitions of the same vertices, kept
+ * in memory bounded by the number of vertices times the number of blocks:
+ *  - the histogram of the number of non-empty blocks;
+ *  - the fraction of the partitions in which each of `pairCount` vertex pairs, drawn
+ *    uniformly at the first update, are in the same block;
+ *  - the counts of the labels of each vertex, the labels of each partition being aligned
+ *    to the previous ones by greedily matching the blocks of largest overlap, from
+ *    which follow a consensus partition and the entropy of the label marginals;
+ *  - the mean entropy of the block sizes of the partitions;
+ *  - a uniform sample of at most `reservoirCapacity` partitions, compressed. */
+class PartitionSummarizer{
+public:
+    PartitionSummarizer(size_t pairCount=1000, size_t reservoirCapacity=0):
+        m_pairCount(pairCount), m_reservoirCapacity(reservoirCapacity) { }
+
+    void update(const BlockSequence& partition);
+    void clear();
+
+    const size_t getCount() const { return m_count; }
+    const size_t getSize() const { return m_size; }
+    const std::vector<size_t>& getBlockCountHistogram() const { return m_blockCountHistogram; }
+
+    const std::vector<std::pair<BaseGraph::VertexIndex, BaseGraph::VertexIndex>>& getPairs() const { return m_pairs; }
+    const std::vector<double> getCoassignmentProbs() const ;
+
+    /* Labels of the last partition mapped to the aligned labels. */
+    const std::vector<BlockIndex>& getLastAlignment() const { return m_lastAlignment; }
+    const size_t getAlignedBlockCount() const { return m_labelCounts.size(); }
+    const size_t getLabelCount(BaseGraph::VertexIndex vertex, BlockIndex alignedLabel) const { return m_labelCounts[alignedLabel][vertex]; }
+    const BlockSequence getConsensus() const ;
+    const double getMarginalEntropy() const ;
+    const double getMeanPartitionEntropy() const { return (m_count == 0) ? 0 : m_partitionEntropySum / m_count; }
+
+    const std::vector<BlockSequence> getReservoir() const ;
+    const size_t getReservoirByteCount() const ;
+
+private:
+    const size_t m_pairCount;
+    const size_t m_reservoirCapacity;
+    size_t m_size = 0;
+    size_t m_count = 0;
+    std::vector<size_t> m_blockCountHistogram;
+    std::vector<std::pair<BaseGraph::VertexIndex, BaseGraph::VertexIndex>> m_pairs;
+    std::vector<size_t> m_coassignmentCounts;
+    std::vector<std::vector<size_t>> m_labelCounts;
+    std::vector<BlockIndex> m_lastAlignment;
+    double m_partitionEntropySum = 0;
+    std::vector<CompressedPartition> m_reservoir;
+
+    void setSize(size_t size);
+    void align(const BlockSequence& partition, size_t labelCount);
+};
+
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef FAST_MIDYNET_RING_BUFFER_HPP
+#define FAST_MIDYNET_RING_BUFFER_HPP
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace FastMIDyNet{
+
+/* Fixed-capacity buffer keeping the last `capacity` pushed values. The storage is
+ * allocated at construction, so that pushing never allocates. */
+template<typename T>
+class RingBuffer{
+private:
+    std::vector<T> m_data;
+    size_t m_capacity;
+    size_t m_start = 0;
+    size_t m_pushCount = 0;
+public:
+    RingBuffer(size_t capacity=1): m_capacity(capacity){
+        if (capacity == 0)
+            throw std::logic_error("RingBuffer: capacity must be positive.");
+        m_data.reserve(capacity);
+    }
+
+    void push(const T& value){
+        if (m_data.size() < m_capacity)
+            m_data.push_back(value);
+        else{
+            m_data[m_start] = value;
+            m_start = (m_start + 1) % m_capacity;
+        }
+        ++m_pushCount;
+    }
+    void clear() { m_data.clear(); m_start = 0; m_pushCount = 0; }
+
+    /* Values are indexed from the oldest to the newest. */
+    const T& operator[](size_t index) const { return m_data[(m_start + index) % m_capacity]; }
+    const T& back() const { return (*this)[size() - 1]; }
+    const std::vector<T> getData() const {
+        std::vector<T> data;
+        data.reserve(size());
+        for (size_t i = 0; i < size(); ++i)
+            data.push_back((*this)[i]);
+        return data;
+    }
+
+    size_t size() const { return m_data.size(); }
+    size_t getCapacity() const { return m_capacity; }
+    size_t getPushCount() const { return m_pushCount; }
+    bool isFull() const { return m_data.size() == m_capacity; }
+};
+
+}
+
+#endif
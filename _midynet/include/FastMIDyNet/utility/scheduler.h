@@ -0,0 +1,50 @@
+#ifndef FAST_MIDYNET_SCHEDULER_H
+#define FAST_MIDYNET_SCHEDULER_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace FastMIDyNet{
+
+/* Runs a flat list of independent tasks, identified by their index, on a fixed set of
+ * threads. Each thread starts with a contiguous block of tasks, takes its next task
+ * from the back of its own queue and, once it is empty, steals from the front of the
+ * queues of the other threads, so that long tasks do not leave threads idle.
+ *
+ * `onTaskEnd` is called after each task, by the thread that ran it, while no other
+ * thread is in `onTaskEnd`. The first exception thrown by a task or by `onTaskEnd`
+ * stops the remaining tasks and is rethrown by `run` once every thread is done. */
+class TaskScheduler{
+public:
+    typedef std::function<void(size_t)> Task;
+private:
+    struct TaskQueue{
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+    const size_t m_threadCount;
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+    std::mutex m_onTaskEndMutex;
+    std::atomic<bool> m_isStopped;
+    std::atomic<size_t> m_stolenTaskCount;
+
+    bool popTask(size_t threadIndex, size_t& task);
+    bool stealTask(size_t threadIndex, size_t& task);
+    void work(size_t threadIndex, const Task& task, const Task& onTaskEnd);
+public:
+    TaskScheduler(size_t numThreads=0);
+
+    void run(size_t taskCount, const Task& task, const Task& onTaskEnd=nullptr);
+
+    const size_t getThreadCount() const { return m_threadCount; }
+    const size_t getStolenTaskCount() const { return m_stolenTaskCount; }
+};
+
+}
+
+#endif
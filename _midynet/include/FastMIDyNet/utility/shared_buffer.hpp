@@ -0,0 +1,39 @@
+#ifndef FAST_MIDYNET_SHARED_BUFFER_HPP
+#define FAST_MIDYNET_SHARED_BUFFER_HPP
+
+#include <memory>
+#include <vector>
+
+
+namespace FastMIDyNet{
+
+/* Contiguous values that can be shared with read-only views without copy. While
+ * a view holds the storage, the next modification copies it, so that a view never
+ * sees the values change. */
+template<typename T>
+class SharedBuffer{
+private:
+    std::shared_ptr<std::vector<T>> m_data = std::make_shared<std::vector<T>>();
+
+    std::vector<T>& getMutableData(){
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<std::vector<T>>(*m_data);
+        return *m_data;
+    }
+public:
+    void push(const T& value){ getMutableData().push_back(value); }
+    void clear() {
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<std::vector<T>>();
+        else
+            m_data->clear();
+    }
+
+    const std::vector<T>& getData() const { return *m_data; }
+    std::shared_ptr<const std::vector<T>> share() const { return m_data; }
+    size_t size() const { return m_data->size(); }
+};
+
+}
+
+#endif
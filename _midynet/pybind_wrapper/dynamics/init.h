@@ -5,6 +5,7 @@
 #include <pybind11/stl.h>
 
 #include "init_dynamics.h"
+#include "FastMIDyNet/dynamics/exact_evidence.hpp"
 
 namespace py = pybind11;
 namespace FastMIDyNet{
@@ -28,8 +29,17 @@ void initDynamics(py::module& m){
     declareSISDynamicsBaseClass<RandomGraph>(m, "SISDynamics");
     declareSISDynamicsBaseClass<BlockLabeledRandomGraph>(m, "BlockLabeledSISDynamics");
 
-
-
+    py::class_<ExactEvidence>(m, "ExactEvidence")
+        .def_readonly("log_evidence", &ExactEvidence::logEvidence)
+        .def_readonly("graph_count", &ExactEvidence::graphCount)
+        .def_readonly("edge_log_marginals", &ExactEvidence::edgeLogMarginals)
+        ;
+    m.def("get_exact_evidence", &getExactEvidence<RandomGraph>,
+        py::arg("replicas"), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true,
+        py::call_guard<py::gil_scoped_release>());
+    m.def("get_exact_evidence", &getExactEvidence<BlockLabeledRandomGraph>,
+        py::arg("replicas"), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true,
+        py::call_guard<py::gil_scoped_release>());
 }
 
 }
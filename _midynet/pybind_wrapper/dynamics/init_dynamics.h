@@ -7,6 +7,7 @@
 #include "FastMIDyNet/dynamics/python/dynamics.hpp"
 
 #include "FastMIDyNet/python/rv.hpp"
+#include "FastMIDyNet/python/numpy.hpp"
 #include "FastMIDyNet/dynamics/dynamics.hpp"
 #include "FastMIDyNet/dynamics/binary_dynamics.hpp"
 #include "FastMIDyNet/dynamics/cowan.hpp"
@@ -23,14 +24,46 @@ py::class_<Dynamics<GraphPriorType>, NestedRandomVariable, PyDynamics<GraphPrior
         .def(py::init<GraphPriorType&, size_t, size_t, bool>(),
             py::arg("graph_prior"), py::arg("num_states"),
             py::arg("num_steps"), py::arg("normalize")=true)
-        .def("get_current_state", &Dynamics<GraphPriorType>::getCurrentState)
-        .def("get_current_neighbors_state", &Dynamics<GraphPriorType>::getCurrentNeighborsState)
-        .def("get_past_states", &Dynamics<GraphPriorType>::getPastStates)
-        .def("get_past_neighbors_states", &Dynamics<GraphPriorType>::getNeighborsPastStates)
-        .def("get_future_states", &Dynamics<GraphPriorType>::getFutureStates)
+        .def("get_current_state", [](const Dynamics<GraphPriorType>& self){
+                const auto& state = self.getCurrentState();
+                return NumpyArray<VertexState>((py::ssize_t) state.size(), state.data());
+            })
+        .def("get_current_neighbors_state", [](const Dynamics<GraphPriorType>& self){
+                return getMatrixArray(self.getCurrentNeighborsState());
+            })
+        .def("get_past_states", [](const Dynamics<GraphPriorType>& self){
+                const auto& states = self.getPastStates();
+                py::ssize_t columnCount = (states.size() == 0) ? 0 : states[0].size();
+                return getSharedArrayView(self.getPastStateArray(), {(py::ssize_t) states.size(), columnCount});
+            })
+        .def("get_past_neighbors_states", [](const Dynamics<GraphPriorType>& self){
+                return getTensorArray(self.getNeighborsPastStates());
+            })
+        .def("get_future_states", [](const Dynamics<GraphPriorType>& self){
+                const auto& states = self.getFutureStates();
+                py::ssize_t columnCount = (states.size() == 0) ? 0 : states[0].size();
+                return getSharedArrayView(self.getFutureStateArray(), {(py::ssize_t) states.size(), columnCount});
+            })
         .def("set_state", &Dynamics<GraphPriorType>::setState, py::arg("state"))
+        .def("set_past_states", [](Dynamics<GraphPriorType>& self, const NumpyArray<VertexState>& pastStates, py::object futureStates){
+                /* Without future states, `past_states` is the whole time series of shape (N, T + 1). */
+                StateSequence past = getMatrixFromArray(pastStates), future;
+                if (futureStates.is_none()){
+                    future.resize(past.size());
+                    for (size_t idx = 0; idx < past.size(); ++idx){
+                        if (past[idx].size() < 2)
+                            throw std::logic_error("set_past_states: time series must have at least 2 steps.");
+                        future[idx].assign(past[idx].begin() + 1, past[idx].end());
+                        past[idx].pop_back();
+                    }
+                }
+                else
+                    future = getMatrixFromArray(futureStates.cast<NumpyArray<VertexState>>());
+                py::gil_scoped_release release;
+                self.setStateSequences(past, future);
+            }, py::arg("past_states"), py::arg("future_states")=py::none())
         .def("get_graph", &Dynamics<GraphPriorType>::getGraph)
-        .def("set_graph", &Dynamics<GraphPriorType>::setGraph, py::arg("graph"))
+        .def("set_graph", &Dynamics<GraphPriorType>::setGraph, py::arg("graph"), py::call_guard<py::gil_scoped_release>())
         .def("set_graph_prior", &Dynamics<GraphPriorType>::setGraphPrior)
         .def("get_graph_prior", &Dynamics<GraphPriorType>::getGraphPrior)
         .def("get_size", &Dynamics<GraphPriorType>::getSize)
@@ -38,22 +71,25 @@ py::class_<Dynamics<GraphPriorType>, NestedRandomVariable, PyDynamics<GraphPrior
         .def("get_num_steps", &Dynamics<GraphPriorType>::getNumSteps)
         .def("set_num_steps", &Dynamics<GraphPriorType>::setNumSteps)
         .def("sample", py::overload_cast<const State&, bool>(&Dynamics<GraphPriorType>::sample),
-            py::arg("state"), py::arg("async")=false)
+            py::arg("state"), py::arg("async")=false, py::call_guard<py::gil_scoped_release>())
         .def("sample", py::overload_cast<bool>(&Dynamics<GraphPriorType>::sample),
-            py::arg("async")=false)
+            py::arg("async")=false, py::call_guard<py::gil_scoped_release>())
         .def("sample_state", py::overload_cast<const State&, bool>(&Dynamics<GraphPriorType>::sampleState),
-            py::arg("state"), py::arg("async")=false)
+            py::arg("state"), py::arg("async")=false, py::call_guard<py::gil_scoped_release>())
         .def("sample_state", py::overload_cast<bool>(&Dynamics<GraphPriorType>::sampleState),
-            py::arg("async")=false)
-        .def("sample_graph", &Dynamics<GraphPriorType>::sampleGraph)
+            py::arg("async")=false, py::call_guard<py::gil_scoped_release>())
+        .def("sample_graph", &Dynamics<GraphPriorType>::sampleGraph, py::call_guard<py::gil_scoped_release>())
         .def("get_random_state", &Dynamics<GraphPriorType>::getRandomState)
         .def("normalizeCoupling", &Dynamics<GraphPriorType>::normalizeCoupling)
-        .def("sync_update_state", &Dynamics<GraphPriorType>::syncUpdateState)
+        .def("sync_update_state", &Dynamics<GraphPriorType>::syncUpdateState, py::call_guard<py::gil_scoped_release>())
         .def("async_update_state", &Dynamics<GraphPriorType>::asyncUpdateState,
-            py::arg("num_updates")=1)
-        .def("get_log_likelihood", &Dynamics<GraphPriorType>::getLogLikelihood)
-        .def("get_log_prior", &Dynamics<GraphPriorType>::getLogPrior)
-        .def("get_log_joint", &Dynamics<GraphPriorType>::getLogJoint)
+            py::arg("num_updates")=1, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_likelihood", &Dynamics<GraphPriorType>::getLogLikelihood, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_likelihoods", &Dynamics<GraphPriorType>::getLogLikelihoods,
+            py::arg("graphs"), py::arg("num_threads")=0,
+            py::call_guard<py::gil_scoped_release>())
+        .def("get_log_prior", &Dynamics<GraphPriorType>::getLogPrior, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_joint", &Dynamics<GraphPriorType>::getLogJoint, py::call_guard<py::gil_scoped_release>())
         .def("get_transition_prob", &Dynamics<GraphPriorType>::getTransitionProb,
             py::arg("prev_vertex_state"), py::arg("next_vertex_state"),
             py::arg("neighbor_state"))
@@ -21,9 +21,12 @@ void initGenerators(py::module& m){
     m.def("sampleRandomPermutation", &sampleRandomPermutation, py::arg("nk"));
 
     /* Random graph generators */
-    m.def("generateDCSBM", &generateDCSBM, py::arg("blocks"), py::arg("edgeMatrix"), py::arg("degrees"));
-    m.def("generateSBM", &generateSBM, py::arg("blocks"), py::arg("edgeMatrix"));
-    m.def("generateCM", &generateCM, py::arg("degrees"));
+    m.def("generateDCSBM", &generateDCSBM, py::arg("blocks"), py::arg("edgeMatrix"), py::arg("degrees"),
+        py::call_guard<py::gil_scoped_release>());
+    m.def("generateSBM", &generateSBM, py::arg("blocks"), py::arg("edgeMatrix"),
+        py::call_guard<py::gil_scoped_release>());
+    m.def("generateCM", &generateCM, py::arg("degrees"),
+        py::call_guard<py::gil_scoped_release>());
 
 
 }
@@ -6,6 +6,7 @@
 
 #include "init_mcmc.h"
 #include "init_callbacks.h"
+#include "init_information.h"
 #include "FastMIDyNet/types.h"
 
 namespace py = pybind11;
@@ -21,6 +22,9 @@ void initMCMC(py::module& m){
     declareGraphReconstructionClass<RandomGraph>(m, "GraphReconstructionMCMC");
     declareGraphReconstructionClass<VertexLabeledRandomGraph<BlockIndex>>(m, "BaseBlockLabeledGraphReconstructionMCMC");
     declareVertexLabeledGraphReconstructionClass<BlockIndex>(m, "BlockLabeledGraphReconstructionMCMC");
+
+    declareInformationEstimator<RandomGraph>(m, "InformationEstimator");
+    declareInformationEstimator<VertexLabeledRandomGraph<BlockIndex>>(m, "BlockLabeledInformationEstimator");
 }
 
 }
@@ -7,7 +7,9 @@
 #include "BaseGraph/types.h"
 #include "FastMIDyNet/mcmc/callbacks/collector.hpp"
 #include "FastMIDyNet/mcmc/python/callback.hpp"
+#include "FastMIDyNet/python/numpy.hpp"
 #include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/partition_distance.h"
 // #include "FastMIDyNet/utility/distance.h"
 
 namespace py = pybind11;
@@ -28,10 +30,21 @@ py::class_<SubClass, BaseClasses...> declareCollectorSubClass(py::module& m, std
         ;
 }
 
+template<typename MCMCType>
+py::class_<CollectGraphOnSweep<MCMCType>, SweepCollector<MCMCType>> declareGraphCollector(py::module& m, std::string pyName){
+    return py::class_<CollectGraphOnSweep<MCMCType>, SweepCollector<MCMCType>>(m, pyName.c_str())
+        .def(py::init<size_t>(), py::arg("keyframe_period")=64)
+        .def("get_data", &CollectGraphOnSweep<MCMCType>::getData)
+        .def("get_graph", &CollectGraphOnSweep<MCMCType>::getGraph, py::arg("index"))
+        .def("get_size", [](const CollectGraphOnSweep<MCMCType>& self){ return self.getSnapshots().size(); })
+        .def("get_byte_count", [](const CollectGraphOnSweep<MCMCType>& self){ return self.getSnapshots().getByteCount(); })
+        ;
+}
+
 template<typename MCMCType>
 py::class_<CollectEdgeMultiplicityOnSweep<MCMCType>, SweepCollector<MCMCType>> declareEdgeMultiplicityCollector(py::module& m, std::string pyName){
     return py::class_<CollectEdgeMultiplicityOnSweep<MCMCType>, SweepCollector<MCMCType>>(m, pyName.c_str())
-        .def(py::init<>())
+        .def(py::init<bool>(), py::arg("time_weighted")=false)
         .def("get_marginal_entropy", &CollectEdgeMultiplicityOnSweep<MCMCType>::getMarginalEntropy)
         .def("get_total_count", &CollectEdgeMultiplicityOnSweep<MCMCType>::getTotalCount)
         .def("get_edge_observation_count", [](const CollectEdgeMultiplicityOnSweep<MCMCType>& self, size_t v, size_t u){
@@ -42,12 +55,105 @@ py::class_<CollectEdgeMultiplicityOnSweep<MCMCType>, SweepCollector<MCMCType>> d
                 return self.getEdgeCountProb(getOrderedPair<BaseGraph::VertexIndex>({u, v}), count);
             }, py::arg("v"), py::arg("u"), py::arg("count"))
         .def("get_edge_probs", &CollectEdgeMultiplicityOnSweep<MCMCType>::getEdgeProbs)
+        /* Observed edges as an (E, 2) array and the probabilities of their multiplicities
+         * 0 to the largest observed as an (E, max + 1) array, with rows in the same order. */
+        .def("get_marginals", [](const CollectEdgeMultiplicityOnSweep<MCMCType>& self){
+                const auto& marginals = self.getMarginals();
+                auto edges = marginals.getObservedEdges();
+                py::array_t<size_t> edgeArray(std::vector<py::ssize_t>{(py::ssize_t) edges.size(), 2});
+                size_t* edgeData = edgeArray.mutable_data();
+                for (size_t i = 0; i < edges.size(); ++i){
+                    edgeData[2 * i] = edges[i].first;
+                    edgeData[2 * i + 1] = edges[i].second;
+                }
+                size_t columnCount = marginals.getMaxObservedMultiplicity() + 1;
+                py::array_t<double> probArray(std::vector<py::ssize_t>{(py::ssize_t) edges.size(), (py::ssize_t) columnCount});
+                marginals.getProbs(probArray.mutable_data(), columnCount);
+                return py::make_tuple(edgeArray, probArray);
+            })
+        .def("get_time", [](const CollectEdgeMultiplicityOnSweep<MCMCType>& self){ return self.getMarginals().getTime(); })
+        .def("is_time_weighted", &CollectEdgeMultiplicityOnSweep<MCMCType>::isTimeWeighted)
         .def("get_log_posterior_estimate", py::overload_cast<const MultiGraph&>(&CollectEdgeMultiplicityOnSweep<MCMCType>::getLogPosteriorEstimate), py::arg("graph"))
         .def("get_log_posterior_estimate", py::overload_cast<>(&CollectEdgeMultiplicityOnSweep<MCMCType>::getLogPosteriorEstimate))
         ;
 
 }
 
+/* The distances are computed on the collected partitions, without copying them. */
+template<typename MCMCType>
+py::class_<CollectPartitionOnSweep<MCMCType>, SweepCollector<MCMCType>> declarePartitionCollector(py::module& m, std::string pyName){
+    return py::class_<CollectPartitionOnSweep<MCMCType>, SweepCollector<MCMCType>>(m, pyName.c_str())
+        .def(py::init<>())
+        .def("get_data", [](const CollectPartitionOnSweep<MCMCType>& self){ return getMatrixArray(self.getData()); })
+        .def("get_distance_matrix", [](const CollectPartitionOnSweep<MCMCType>& self, std::string metric, size_t numThreads){
+                std::vector<std::vector<double>> distances;
+                {
+                    py::gil_scoped_release release;
+                    distances = getPartitionDistanceMatrix(self.getData(), metric, numThreads);
+                }
+                return getMatrixArray(distances);
+            }, py::arg("metric")="vi", py::arg("num_threads")=0)
+        .def("get_aligned_data", [](const CollectPartitionOnSweep<MCMCType>& self, const BlockSequence& reference){
+                std::vector<BlockSequence> alignedPartitions;
+                for (const auto& partition: self.getData())
+                    alignedPartitions.push_back(alignPartition(partition, reference));
+                return getMatrixArray(alignedPartitions);
+            }, py::arg("reference"))
+        ;
+}
+
+template<typename MCMCType>
+py::class_<SummarizePartitionOnSweep<MCMCType>, SweepCollector<MCMCType>> declarePartitionSummarizer(py::module& m, std::string pyName){
+    return py::class_<SummarizePartitionOnSweep<MCMCType>, SweepCollector<MCMCType>>(m, pyName.c_str())
+        .def(py::init<size_t, size_t>(), py::arg("pair_count")=1000, py::arg("reservoir_capacity")=0)
+        .def("get_count", [](const SummarizePartitionOnSweep<MCMCType>& self){ return self.getSummary().getCount(); })
+        .def("get_block_count_histogram", [](const SummarizePartitionOnSweep<MCMCType>& self){
+                const auto& histogram = self.getSummary().getBlockCountHistogram();
+                return NumpyArray<size_t>((py::ssize_t) histogram.size(), histogram.data());
+            })
+        .def("get_pairs", [](const SummarizePartitionOnSweep<MCMCType>& self){
+                const auto& pairs = self.getSummary().getPairs();
+                py::array_t<size_t> array(std::vector<py::ssize_t>{(py::ssize_t) pairs.size(), 2});
+                size_t* data = array.mutable_data();
+                for (size_t i = 0; i < pairs.size(); ++i){
+                    data[2 * i] = pairs[i].first;
+                    data[2 * i + 1] = pairs[i].second;
+                }
+                return array;
+            })
+        .def("get_coassignment_probs", [](const SummarizePartitionOnSweep<MCMCType>& self){
+                auto probs = self.getSummary().getCoassignmentProbs();
+                return NumpyArray<double>((py::ssize_t) probs.size(), probs.data());
+            })
+        .def("get_consensus", [](const SummarizePartitionOnSweep<MCMCType>& self){
+                auto consensus = self.getSummary().getConsensus();
+                return NumpyArray<BlockIndex>((py::ssize_t) consensus.size(), consensus.data());
+            })
+        .def("get_marginal_entropy", [](const SummarizePartitionOnSweep<MCMCType>& self){ return self.getSummary().getMarginalEntropy(); })
+        .def("get_mean_partition_entropy", [](const SummarizePartitionOnSweep<MCMCType>& self){ return self.getSummary().getMeanPartitionEntropy(); })
+        .def("get_reservoir", [](const SummarizePartitionOnSweep<MCMCType>& self){ return getMatrixArray(self.getSummary().getReservoir()); })
+        .def("get_reservoir_byte_count", [](const SummarizePartitionOnSweep<MCMCType>& self){ return self.getSummary().getReservoirByteCount(); })
+        ;
+}
+
+py::class_<CollectStatistics, Collector<MCMC>> declareStatisticsCollector(py::module& m, std::string pyName){
+    return py::class_<CollectStatistics, Collector<MCMC>>(m, pyName.c_str())
+        .def(py::init<const std::vector<std::string>&, size_t, size_t, bool>(),
+            py::arg("statistics"), py::arg("stride")=1, py::arg("capacity")=1000, py::arg("on_step")=false)
+        .def("get_data", [](const CollectStatistics& self, std::string statistic){
+                auto data = self.getData(statistic);
+                return NumpyArray<double>((py::ssize_t) data.size(), data.data());
+            }, py::arg("statistic"))
+        .def("get_statistic_names", &CollectStatistics::getStatisticNames)
+        .def("get_push_count", [](const CollectStatistics& self, std::string statistic){
+                return self.getBuffer(statistic).getPushCount();
+            }, py::arg("statistic"))
+        .def("get_stride", &CollectStatistics::getStride)
+        .def("is_on_step", &CollectStatistics::isOnStep)
+        .def_readonly_static("STATISTIC_NAMES", &CollectStatistics::STATISTIC_NAMES)
+        ;
+}
+
 void initCollectors(py::module& m){
     /* Collect base classes */
     declareCollectorBaseClass<MCMC>(m, "Collector");
@@ -68,31 +174,29 @@ void initCollectors(py::module& m){
     declareCollectorSubClass<SweepCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>, Collector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>,  PyCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>, SweepCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>>>(m, "BlockLabeledGraphReconstructionSweepCollector");
 
     /* Graph collector classes */
-    declareCollectorSubClass<CollectGraphOnSweep<GraphReconstructionMCMC<>>, SweepCollector<GraphReconstructionMCMC<>>>(m, "CollectGraphOnSweep")
-        .def("get_data", &CollectGraphOnSweep<GraphReconstructionMCMC<>>::getData);
-    declareCollectorSubClass<CollectBlockLabeledGraphOnSweep, BlockLabeledGraphReconstructionSweepCollector>(m, "CollectBlockLabeledGraphOnSweep")
-        .def("get_data", &CollectBlockLabeledGraphOnSweep::getData);
+    declareGraphCollector<GraphReconstructionMCMC<>>(m, "CollectGraphOnSweep");
+    declareGraphCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>(m, "CollectBlockLabeledGraphOnSweep");
 
     /* Edge multiplicity collector classes */
     declareEdgeMultiplicityCollector<GraphReconstructionMCMC<>>(m, "CollectEdgeMultiplicityOnSweep");
     declareEdgeMultiplicityCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>(m, "CollectBlockLabeledEdgeMultiplicityOnSweep");
 
     /* Partition collector classes */
-    declareCollectorSubClass<CollectPartitionOnSweepForCommunity, BlockSweepCollector>(m, "CollectPartitionOnSweepForCommunity")
-        .def("get_data", &CollectPartitionOnSweepForCommunity::getData);
-    declareCollectorSubClass<CollectPartitionOnSweepForReconstruction, BlockLabeledGraphReconstructionSweepCollector>(m, "CollectPartitionOnSweepForReconstruction")
-        .def("get_data", &CollectPartitionOnSweepForReconstruction::getData);
+    declarePartitionCollector<VertexLabelMCMC<BlockIndex>>(m, "CollectPartitionOnSweepForCommunity");
+    declarePartitionCollector<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>(m, "CollectPartitionOnSweepForReconstruction");
+    declarePartitionSummarizer<VertexLabelMCMC<BlockIndex>>(m, "SummarizePartitionOnSweepForCommunity");
+    declarePartitionSummarizer<GraphReconstructionMCMC<VertexLabeledRandomGraph<BlockIndex>>>(m, "SummarizePartitionOnSweepForReconstruction");
 
 
     /* MCMC metrics collector classes */
     declareCollectorSubClass<CollectLikelihoodOnSweep, SweepCollector<MCMC>>(m, "CollectLikelihoodOnSweep")
-        .def("get_data", &CollectLikelihoodOnSweep::getData);
+        .def("get_data", [](const CollectLikelihoodOnSweep& self){ return getSharedArrayView(self.shareData()); });
 
     declareCollectorSubClass<CollectPriorOnSweep, SweepCollector<MCMC>>(m, "CollectPriorOnSweep")
-        .def("get_data", &CollectPriorOnSweep::getData);
+        .def("get_data", [](const CollectPriorOnSweep& self){ return getSharedArrayView(self.shareData()); });
 
     declareCollectorSubClass<CollectJointOnSweep, SweepCollector<MCMC>>(m, "CollectJointOnSweep")
-        .def("get_data", &CollectJointOnSweep::getData);
+        .def("get_data", [](const CollectJointOnSweep& self){ return getSharedArrayView(self.shareData()); });
 
     // py::class_<WriteGraphToFileOnSweep, SweepCollector>(m, "WriteGraphToFileOnSweep")
     //     .def(py::init<std::string, std::string>(), py::arg("filename"), py::arg("ext")=".b");
@@ -0,0 +1,56 @@
+#ifndef FAST_MIDYNET_PYWRAPPER_INIT_INFORMATION_H
+#define FAST_MIDYNET_PYWRAPPER_INIT_INFORMATION_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "FastMIDyNet/mcmc/information.hpp"
+#include "FastMIDyNet/python/numpy.hpp"
+
+namespace py = pybind11;
+namespace FastMIDyNet{
+
+template<typename GraphPriorType>
+py::class_<InformationEstimator<GraphPriorType>> declareInformationEstimator(py::module& m, std::string pyName){
+    typedef InformationEstimator<GraphPriorType> Estimator;
+    auto getSamples = [](const Estimator& self){
+        py::dict samples;
+        for (const auto& quantity: self.getSamples())
+            samples[py::str(quantity.first)] = NumpyArray<double>((py::ssize_t) quantity.second.size(), quantity.second.data());
+        return samples;
+    };
+    return py::class_<Estimator>(m, pyName.c_str())
+        /* The models are only referenced by the estimator, the list keeps them alive. */
+        .def(py::init<const std::vector<GraphReconstructionMCMC<GraphPriorType>*>&, std::string, size_t, size_t, size_t>(),
+            py::arg("mcmcs"), py::arg("method")="meanfield", py::arg("num_sweeps")=1000,
+            py::arg("burn_per_vertex")=5, py::arg("initial_burn")=2000, py::keep_alive<1, 2>())
+        /* The models are cloned from `mcmc` and owned by the estimator. */
+        .def(py::init<const GraphReconstructionMCMC<GraphPriorType>&, size_t, std::string, size_t, size_t, size_t>(),
+            py::arg("mcmc"), py::arg("num_models"), py::arg("method")="meanfield", py::arg("num_sweeps")=1000,
+            py::arg("burn_per_vertex")=5, py::arg("initial_burn")=2000)
+        .def("compute", [=](Estimator& self, const std::vector<size_t>& seeds){
+                {
+                    py::gil_scoped_release release;
+                    self.compute(seeds);
+                }
+                return getSamples(self);
+            }, py::arg("seeds"))
+        .def("compute", [=](Estimator& self, size_t numSamples, size_t seed){
+                {
+                    py::gil_scoped_release release;
+                    self.compute(numSamples, seed);
+                }
+                return getSamples(self);
+            }, py::arg("num_samples"), py::arg("seed"))
+        .def("get_samples", getSamples)
+        .def("get_mean", &Estimator::getMean, py::arg("quantity"))
+        .def("get_standard_error", &Estimator::getStandardError, py::arg("quantity"))
+        .def("get_model_count", &Estimator::getModelCount)
+        .def("get_method", &Estimator::getMethod)
+        .def_static("get_quantity_names", &Estimator::getQuantityNames)
+        ;
+}
+
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include <pybind11/stl.h>
 
 #include "FastMIDyNet/rv.hpp"
+#include "FastMIDyNet/clone.hpp"
 #include "FastMIDyNet/mcmc/mcmc.h"
 #include "FastMIDyNet/mcmc/community.hpp"
 #include "FastMIDyNet/mcmc/reconstruction.hpp"
@@ -28,24 +29,24 @@ py::class_<MCMC, NestedRandomVariable, PyMCMC<>> declareMCMCBaseClass(py::module
         .def("set_beta_prior", &MCMC::setBetaPrior, py::arg("beta"))
         .def("get_beta_likelihood", &MCMC::getBetaLikelihood)
         .def("set_beta_likelihood", &MCMC::setBetaLikelihood, py::arg("beta"))
-        .def("get_log_likelihood", &MCMC::getLogLikelihood)
-        .def("get_log_prior", &MCMC::getLogPrior)
-        .def("get_log_joint", &MCMC::getLogJoint)
+        .def("get_log_likelihood", &MCMC::getLogLikelihood, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_prior", &MCMC::getLogPrior, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_joint", &MCMC::getLogJoint, py::call_guard<py::gil_scoped_release>())
         .def("insert_callback", [](MCMC& self, std::string key, CallBack<MCMC>& callback){
             self.insertCallBack(key, callback);
         }, py::arg("key"), py::arg("callback"))
         .def("remove_callback", &MCMC::removeCallBack, py::arg("key"))
         .def("get_mcmc_callback", &MCMC::getMCMCCallBack, py::arg("key"))
-        .def("sample", &MCMC::sample)
-        .def("sample_prior", &MCMC::samplePrior)
-        .def("set_up", &MCMC::setUp)
+        .def("sample", &MCMC::sample, py::call_guard<py::gil_scoped_release>())
+        .def("sample_prior", &MCMC::samplePrior, py::call_guard<py::gil_scoped_release>())
+        .def("set_up", &MCMC::setUp, py::call_guard<py::gil_scoped_release>())
         .def("tear_down", &MCMC::tearDown)
         .def("on_step_begin", &MCMC::onStepBegin)
         .def("on_step_end", &MCMC::onStepEnd)
         .def("on_sweep_begin", &MCMC::onSweepBegin)
         .def("on_sweep_end", &MCMC::onSweepEnd)
-        .def("do_metropolis_hastings_step", &MCMC::doMetropolisHastingsStep)
-        .def("do_MH_sweep", &MCMC::doMHSweep, py::arg("burn")=1)
+        .def("do_metropolis_hastings_step", &MCMC::doMetropolisHastingsStep, py::call_guard<py::gil_scoped_release>())
+        .def("do_MH_sweep", &MCMC::doMHSweep, py::arg("burn")=1, py::call_guard<py::gil_scoped_release>())
         ;
 }
 
@@ -60,7 +61,7 @@ py::class_<VertexLabelMCMC<Label>, MCMC> declareVertexLabelMCMCClass(py::module&
         .def("set_label_proposer", &VertexLabelMCMC<Label>::setLabelProposer, py::arg("label_proposer"))
         .def("get_label_proposer", &VertexLabelMCMC<Label>::getLabelProposer)
         .def("get_graph", &VertexLabelMCMC<Label>::getGraph)
-        .def("set_graph", &VertexLabelMCMC<Label>::setGraph, py::arg("graph"))
+        .def("set_graph", &VertexLabelMCMC<Label>::setGraph, py::arg("graph"), py::call_guard<py::gil_scoped_release>())
         .def("get_labels", &VertexLabelMCMC<Label>::getLabels)
         .def("set_labels", &VertexLabelMCMC<Label>::setLabels, py::arg("labels"))
         .def("insert_callback", [](VertexLabelMCMC<Label>& self, std::string key, CallBack<MCMC>& callback){
@@ -85,7 +86,7 @@ py::class_<GraphReconstructionMCMC<GraphPrior>, MCMC> declareGraphReconstruction
         .def("set_edge_proposer", &GraphReconstructionMCMC<GraphPrior>::setEdgeProposer, py::arg("edge_proposer"))
         .def("get_edge_proposer", &GraphReconstructionMCMC<GraphPrior>::getEdgeProposer)
         .def("get_graph", &GraphReconstructionMCMC<GraphPrior>::getGraph)
-        .def("set_graph", &GraphReconstructionMCMC<GraphPrior>::setGraph, py::arg("graph"))
+        .def("set_graph", &GraphReconstructionMCMC<GraphPrior>::setGraph, py::arg("graph"), py::call_guard<py::gil_scoped_release>())
         .def("insert_callback", [](GraphReconstructionMCMC<GraphPrior>& self, std::string key, CallBack<MCMC>& callback){
             self.insertCallBack(key, callback);
         }, py::arg("key"), py::arg("callback"))
@@ -94,6 +95,15 @@ py::class_<GraphReconstructionMCMC<GraphPrior>, MCMC> declareGraphReconstruction
         .def("get_graph_callback", &GraphReconstructionMCMC<GraphPrior>::getGraphCallBack, py::arg("key"))
         .def("get_log_acceptance_prob_from_graph_move", &GraphReconstructionMCMC<GraphPrior>::getLogAcceptanceProbFromGraphMove, py::arg("move"))
         .def("apply_graph_move", &GraphReconstructionMCMC<GraphPrior>::applyGraphMove, py::arg("move"))
+        /* The clone and every object it refers to are owned by its clone map, which
+         * lives as long as the Python object of the clone. */
+        .def("clone", [](const GraphReconstructionMCMC<GraphPrior>& self, bool shareData){
+                CloneMap* cloneMap = new CloneMap(shareData);
+                py::capsule owner(cloneMap, [](void* ptr){ delete static_cast<CloneMap*>(ptr); });
+                py::object clone = py::cast(&cloneMap->get(self), py::return_value_policy::reference);
+                py::detail::keep_alive_impl(clone, owner);
+                return clone;
+            }, py::arg("share_data")=true)
         ;
 }
 
@@ -109,6 +119,12 @@ py::class_<VertexLabeledGraphReconstructionMCMC<Label>, GraphReconstructionMCMC<
         .def("set_labels", &VertexLabeledGraphReconstructionMCMC<Label>::setLabels, py::arg("labels"))
         .def("get_log_acceptance_prob_from_label_move", &VertexLabeledGraphReconstructionMCMC<Label>::getLogAcceptanceProbFromLabelMove, py::arg("move"))
         .def("apply_label_move", &VertexLabeledGraphReconstructionMCMC<Label>::applyLabelMove, py::arg("move"))
+        .def("get_sample_label_prob", &VertexLabeledGraphReconstructionMCMC<Label>::getSampleLabelProb)
+        .def("set_sample_label_prob", &VertexLabeledGraphReconstructionMCMC<Label>::setSampleLabelProb, py::arg("sample_label_prob"))
+        .def("start_move_type_adaptation", &VertexLabeledGraphReconstructionMCMC<Label>::startMoveTypeAdaptation,
+            py::arg("adaptation_period")=1000, py::arg("min_weight")=0.05)
+        .def("freeze_move_type_weights", &VertexLabeledGraphReconstructionMCMC<Label>::freezeMoveTypeWeights)
+        .def("is_adapting_move_types", &VertexLabeledGraphReconstructionMCMC<Label>::isAdaptingMoveTypes)
         ;
 }
 
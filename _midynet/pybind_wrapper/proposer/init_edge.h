@@ -12,7 +12,9 @@
 #include "FastMIDyNet/proposer/edge/double_edge_swap.h"
 #include "FastMIDyNet/proposer/edge/hinge_flip.h"
 #include "FastMIDyNet/proposer/edge/single_edge.h"
-// #include "FastMIDyNet/proposer/edge/labeled_edge_proposer.h"
+#include "FastMIDyNet/proposer/edge/informed_edge.h"
+#include "FastMIDyNet/proposer/edge/labeled_edge_proposer.h"
+#include "FastMIDyNet/proposer/edge/labeled_single_edge.h"
 // #include "FastMIDyNet/proposer/edge/labeled_double_edge_swap.h"
 // #include "FastMIDyNet/proposer/edge/labeled_hinge_flip.h"
 
@@ -27,7 +29,9 @@ void initEdgeProposer(py::module& m){
         .def("allow_self_loops", &EdgeProposer::allowSelfLoops)
         .def("allow_multiedges", &EdgeProposer::allowMultiEdges)
         .def("get_log_proposal_ratio", &EdgeProposer::getLogProposalProbRatio, py::arg("move"))
+        .def("set_up_labels", &EdgeProposer::setUpLabels, py::arg("graph_prior"))
         .def("apply_graph_move", &EdgeProposer::applyGraphMove, py::arg("move"))
+        .def("apply_label_move", &EdgeProposer::applyLabelMove, py::arg("move"))
         ;
 
     /* Double edge swap proposers */
@@ -38,8 +42,6 @@ void initEdgeProposer(py::module& m){
     py::class_<HingeFlipProposer, EdgeProposer, PyHingeFlipProposer<>>(m, "HingeFlipProposer")
         .def(py::init<bool, bool>(), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true)
         .def("set_vertex_sampler", &HingeFlipProposer::setVertexSampler, py::arg("vertex_sampler"))
-        .def("get_edge_proposal_counts", &HingeFlipProposer::getEdgeProposalCounts)
-        .def("get_vertex_proposal_counts", &HingeFlipProposer::getVertexProposalCounts)
         ;
 
     py::class_<HingeFlipUniformProposer, HingeFlipProposer>(m, "HingeFlipUniformProposer")
@@ -59,6 +61,37 @@ void initEdgeProposer(py::module& m){
     py::class_<SingleEdgeDegreeProposer, SingleEdgeProposer>(m, "SingleEdgeDegreeProposer")
         .def(py::init<bool, bool, double>(), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true, py::arg("shift")=1) ;
 
+    py::class_<SingleEdgeSimpleProposer, EdgeProposer>(m, "SingleEdgeSimpleProposer")
+        .def(py::init<bool>(), py::arg("allow_self_loops")=false)
+        .def("get_pair_count", &SingleEdgeSimpleProposer::getPairCount)
+        .def("get_edge_count", &SingleEdgeSimpleProposer::getEdgeCount)
+        .def("is_edge", &SingleEdgeSimpleProposer::isEdge, py::arg("edge")) ;
+
+    /* Informed edge proposers */
+    py::class_<InformedEdgeProposer, EdgeProposer>(m, "InformedEdgeProposer")
+        .def(py::init<bool, bool, size_t, double, size_t>(), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true,
+            py::arg("candidate_count")=10, py::arg("uniform_prob")=0.1, py::arg("num_threads")=0)
+        .def("set_up_states", &InformedEdgeProposer::setUpStates, py::arg("past_states"), py::arg("future_states"))
+        .def("get_candidate_count", &InformedEdgeProposer::getCandidateCount)
+        .def("get_uniform_prob", &InformedEdgeProposer::getUniformProposalProb)
+        .def("get_candidate_sampler", &InformedEdgeProposer::getCandidateSampler)
+        .def_static("compute_candidate_neighbors", &InformedEdgeProposer::computeCandidateNeighbors,
+            py::arg("past_states"), py::arg("future_states"), py::arg("candidate_count"), py::arg("num_threads")=0,
+            py::call_guard<py::gil_scoped_release>());
+
+    /* Labeled edge proposers */
+    py::class_<LabeledEdgeProposer, EdgeProposer>(m, "LabeledEdgeProposer")
+        .def("get_label_size", &LabeledEdgeProposer::getLabelSize, py::arg("label"))
+        .def("get_vertices_with_label", &LabeledEdgeProposer::getVerticesWithLabel, py::arg("label"))
+        .def("sample_vertex_with_label", &LabeledEdgeProposer::sampleVertexWithLabel, py::arg("label"));
+
+    py::class_<LabeledSingleEdgeProposer, LabeledEdgeProposer>(m, "LabeledSingleEdgeProposer")
+        .def(py::init<bool, bool, double>(), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true,
+            py::arg("label_pair_shift")=1)
+        .def("get_label_pair_shift", &LabeledSingleEdgeProposer::getLabelPairShift)
+        .def("get_label_pair_weight", &LabeledSingleEdgeProposer::getLabelPairWeight, py::arg("r"), py::arg("s"))
+        .def("get_total_label_pair_weight", &LabeledSingleEdgeProposer::getTotalLabelPairWeight);
+
     // /* Labeled edge proposers */
     // py::class_<LabeledEdgeProposer, EdgeProposer, PyLabeledEdgeProposer<>>(m, "LabeledEdgeProposer")
     //     .def(py::init<bool, bool, double>(), py::arg("allow_self_loops")=true, py::arg("allow_multiedges")=true,
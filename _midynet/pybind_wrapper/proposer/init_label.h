@@ -22,6 +22,7 @@ py::class_<LabelProposer<Label>, Proposer<LabelMove<Label>>, PyLabelProposer<Lab
         .def("set_up", &LabelProposer<Label>::setUp, py::arg("graph_prior"))
         .def("get_log_proposal_prob_ratio", &LabelProposer<Label>::getLogProposalProbRatio, py::arg("move"))
         .def("apply_label_move", &LabelProposer<Label>::applyLabelMove, py::arg("move"))
+        .def("apply_graph_move", &LabelProposer<Label>::applyGraphMove, py::arg("move"))
         ;
 }
 
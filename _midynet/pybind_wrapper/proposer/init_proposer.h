@@ -8,6 +8,7 @@
 
 #include "FastMIDyNet/proposer/movetypes.h"
 #include "FastMIDyNet/proposer/proposer.hpp"
+#include "FastMIDyNet/proposer/statistics.hpp"
 
 namespace py = pybind11;
 namespace FastMIDyNet{
@@ -18,10 +19,27 @@ py::class_<Proposer<MoveType>, NestedRandomVariable, PyProposer<MoveType>> decla
     return py::class_<Proposer<MoveType>, NestedRandomVariable, PyProposer<MoveType>>(m, pyName.c_str())
         .def(py::init<>())
         .def("propose_move", &Proposer<MoveType>::proposeMove)
-        .def("clear", &Proposer<MoveType>::clear);
+        .def("clear", &Proposer<MoveType>::clear)
+        .def("get_move_category_names", &Proposer<MoveType>::getMoveCategoryNames)
+        .def("get_proposal_statistics", &Proposer<MoveType>::getProposalStatistics)
+        .def("clear_proposal_statistics", &Proposer<MoveType>::clearProposalStatistics);
 }
 
 void initProposerBaseClass(py::module& m){
+    py::class_<ProposalCounts>(m, "ProposalCounts")
+        .def(py::init<>())
+        .def_readwrite("proposed", &ProposalCounts::proposed)
+        .def_readwrite("accepted", &ProposalCounts::accepted)
+        .def_readwrite("cycles", &ProposalCounts::cycles)
+        .def("get_acceptance_rate", &ProposalCounts::getAcceptanceRate)
+        .def("get_mean_cycles", &ProposalCounts::getMeanCycles)
+        .def("__repr__", [](const ProposalCounts& counts){
+            return "ProposalCounts(proposed=" + std::to_string(counts.proposed)
+                + ", accepted=" + std::to_string(counts.accepted)
+                + ", cycles=" + std::to_string(counts.cycles) + ")";
+        });
+    m.attr("proposal_statistics_enabled") = PROPOSAL_STATS_ENABLED;
+
     declareProposerBaseClass<GraphMove>(m, "EdgeProposerBase");
     declareProposerBaseClass<BlockMove>(m, "BlockProposerBase");
 }
@@ -43,6 +43,7 @@ void initSampler(py::module& m){
     py::class_<EdgeSampler>(m, "EdgeSampler")
         .def(py::init<>())
         .def("sample", &EdgeSampler::sample)
+        .def("sample_excluding", &EdgeSampler::sampleExcluding, py::arg("excluded_edge"))
         .def("contains", &EdgeSampler::contains, py::arg("edge"))
         .def("on_edge_insertion", &EdgeSampler::onEdgeInsertion, py::arg("edge"), py::arg("weight"))
         .def("on_edge_erasure", &EdgeSampler::onEdgeErasure, py::arg("edge"))
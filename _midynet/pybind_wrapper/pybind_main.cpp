@@ -33,6 +33,8 @@ PYBIND11_MODULE(_midynet, m) {
         .def("check_consistency", &NestedRandomVariable::checkConsistency)
         .def("check_safety", &NestedRandomVariable::checkSafety)
         .def("is_safe", &NestedRandomVariable::isSafe)
+        .def("get_cache_epoch", &NestedRandomVariable::getCacheEpoch)
+        .def("invalidate_caches", &NestedRandomVariable::invalidateCaches)
         ;
 
     py::module prior = m.def_submodule("prior");
@@ -34,15 +34,15 @@ void initRandomGraphBaseClass(py::module& m){
     py::class_<RandomGraph, NestedRandomVariable, PyRandomGraph<>>(m, "RandomGraph")
         .def(py::init<size_t>(), py::arg("size")=0)
         .def("get_graph", &RandomGraph::getGraph)
-        .def("set_graph", &RandomGraph::setGraph, py::arg("graph"))
+        .def("set_graph", &RandomGraph::setGraph, py::arg("graph"), py::call_guard<py::gil_scoped_release>())
         .def("get_size", &RandomGraph::getSize)
         .def("set_size", &RandomGraph::setSize)
         .def("get_edge_count", &RandomGraph::getEdgeCount)
         .def("get_average_degree", &RandomGraph::getAverageDegree)
-        .def("sample", &RandomGraph::sample)
-        .def("get_log_likelihood", &RandomGraph::getLogLikelihood)
-        .def("get_log_prior", &RandomGraph::getLogPrior)
-        .def("get_log_joint", &RandomGraph::getLogJoint)
+        .def("sample", &RandomGraph::sample, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_likelihood", &RandomGraph::getLogLikelihood, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_prior", &RandomGraph::getLogPrior, py::call_guard<py::gil_scoped_release>())
+        .def("get_log_joint", &RandomGraph::getLogJoint, py::call_guard<py::gil_scoped_release>())
         .def("get_log_likelihood_ratio_from_graph_move", &RandomGraph::getLogLikelihoodRatioFromGraphMove, py::arg("move"))
         .def("get_log_prior_ratio_from_graph_move", &RandomGraph::getLogPriorRatioFromGraphMove, py::arg("move"))
         .def("get_log_joint_ratio_from_graph_move", &RandomGraph::getLogJointRatioFromGraphMove, py::arg("move"))
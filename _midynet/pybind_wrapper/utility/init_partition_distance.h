@@ -0,0 +1,38 @@
+#ifndef FAST_MIDYNET_PYWRAPPER_INIT_PARTITION_DISTANCE_H
+#define FAST_MIDYNET_PYWRAPPER_INIT_PARTITION_DISTANCE_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "FastMIDyNet/utility/partition_distance.h"
+#include "FastMIDyNet/python/numpy.hpp"
+
+namespace py = pybind11;
+namespace FastMIDyNet{
+
+void initPartitionDistance(py::module& m){
+    m.def("get_partition_entropy", &getPartitionEntropy, py::arg("partition"));
+    m.def("get_mutual_information", &getMutualInformation, py::arg("partition1"), py::arg("partition2"));
+    m.def("get_normalized_mutual_information", &getNormalizedMutualInformation, py::arg("partition1"), py::arg("partition2"));
+    m.def("get_variation_of_information", &getVariationOfInformation, py::arg("partition1"), py::arg("partition2"));
+    m.def("align_partition", [](const BlockSequence& partition, const BlockSequence& reference){
+            auto alignedPartition = alignPartition(partition, reference);
+            return NumpyArray<BlockIndex>((py::ssize_t) alignedPartition.size(), alignedPartition.data());
+        }, py::arg("partition"), py::arg("reference"));
+    m.def("get_aligned_accuracy", &getAlignedAccuracy, py::arg("partition"), py::arg("reference"));
+    m.def("get_partition_distance", &getPartitionDistance, py::arg("partition1"), py::arg("partition2"), py::arg("metric")="vi");
+    /* The partitions are the rows of a 2-dimensional array, read while the GIL is held. */
+    m.def("get_partition_distance_matrix", [](const NumpyArray<BlockIndex>& partitionArray, std::string metric, size_t numThreads){
+            std::vector<BlockSequence> partitions = getMatrixFromArray(partitionArray);
+            std::vector<std::vector<double>> distances;
+            {
+                py::gil_scoped_release release;
+                distances = getPartitionDistanceMatrix(partitions, metric, numThreads);
+            }
+            return getMatrixArray(distances);
+        }, py::arg("partitions"), py::arg("metric")="vi", py::arg("num_threads")=0);
+}
+
+}
+
+#endif
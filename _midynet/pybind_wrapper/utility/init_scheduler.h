@@ -0,0 +1,32 @@
+#ifndef FAST_MIDYNET_PYWRAPPER_INIT_SCHEDULER_H
+#define FAST_MIDYNET_PYWRAPPER_INIT_SCHEDULER_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
+
+#include "FastMIDyNet/utility/scheduler.h"
+
+namespace py = pybind11;
+namespace FastMIDyNet{
+
+void initScheduler(py::module& m){
+    py::class_<TaskScheduler>(m, "TaskScheduler")
+        .def(py::init<size_t>(), py::arg("num_threads")=0)
+        /* The GIL is released while the tasks run and is only taken by the threads
+         * to call the Python functions, which release it again in the C++ calls. */
+        .def("run", [](TaskScheduler& self, size_t taskCount, py::function task, py::object onTaskEnd){
+                auto runTask = [&](size_t index){ py::gil_scoped_acquire gil; task(index); };
+                TaskScheduler::Task endTask = nullptr;
+                if (not onTaskEnd.is_none())
+                    endTask = [&](size_t index){ py::gil_scoped_acquire gil; onTaskEnd(index); };
+                py::gil_scoped_release release;
+                self.run(taskCount, runTask, endTask);
+            }, py::arg("task_count"), py::arg("task"), py::arg("on_task_end")=py::none())
+        .def("get_thread_count", &TaskScheduler::getThreadCount)
+        .def("get_stolen_task_count", &TaskScheduler::getStolenTaskCount)
+        ;
+}
+
+}
+
+#endif
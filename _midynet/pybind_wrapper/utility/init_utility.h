@@ -8,6 +8,8 @@
 #include "init_maps.h"
 #include "init_functions.h"
 #include "init_integerpartition.h"
+#include "init_scheduler.h"
+#include "init_partition_distance.h"
 // #include "init_distance.h"
 
 namespace py = pybind11;
@@ -18,6 +20,8 @@ void initUtility(py::module& m){
     initMaps(m);
     initFunctions(m);
     initIntegerPartition(m);
+    initScheduler(m);
+    initPartitionDistance(m);
     // initDistances(m);
 }
 
@@ -1 +1,80 @@
 #include "FastMIDyNet/mcmc/callbacks/collector.hpp"
+
+#include <stdexcept>
+
+
+namespace FastMIDyNet{
+
+const std::vector<std::string> CollectStatistics::STATISTIC_NAMES = {
+    "log_likelihood", "log_prior", "log_joint", "log_joint_ratio", "log_acceptance", "acceptance_rate"
+};
+
+CollectStatistics::CollectStatistics(const std::vector<std::string>& statistics, size_t stride, size_t capacity, bool onStep):
+    m_stride(stride), m_onStep(onStep){
+    if (stride == 0)
+        throw std::logic_error("CollectStatistics: `stride` must be positive.");
+    if (statistics.size() == 0)
+        throw std::logic_error("CollectStatistics: at least one statistic must be collected.");
+    for (const auto& name: statistics){
+        size_t index = 0;
+        while (index < STATISTIC_NAMES.size() and STATISTIC_NAMES[index] != name)
+            ++index;
+        if (index == STATISTIC_NAMES.size())
+            throw std::logic_error("CollectStatistics: unknown statistic `" + name + "`.");
+        m_statistics.push_back(static_cast<Statistic>(index));
+        m_buffers.push_back(RingBuffer<double>(capacity));
+    }
+}
+
+void CollectStatistics::onStepEnd(){
+    ++m_stepCount;
+    if (m_mcmcPtr->isLastAccepted())
+        ++m_acceptedCount;
+    if (m_onStep and ++m_callCount % m_stride == 0)
+        collect();
+}
+
+void CollectStatistics::onSweepEnd(){
+    if (not m_onStep and ++m_callCount % m_stride == 0)
+        collect();
+}
+
+void CollectStatistics::collect(){
+    for (size_t i = 0; i < m_statistics.size(); ++i)
+        m_buffers[i].push(getStatistic(m_statistics[i]));
+    m_stepCount = m_acceptedCount = 0;
+}
+
+void CollectStatistics::clear(){
+    for (auto& buffer: m_buffers)
+        buffer.clear();
+    m_callCount = m_stepCount = m_acceptedCount = 0;
+}
+
+const double CollectStatistics::getStatistic(Statistic statistic) const {
+    switch (statistic){
+        case LOG_LIKELIHOOD: return m_mcmcPtr->getLogLikelihood();
+        case LOG_PRIOR: return m_mcmcPtr->getLogPrior();
+        case LOG_JOINT: return m_mcmcPtr->getLogJoint();
+        case LOG_JOINT_RATIO: return m_mcmcPtr->getLastLogJointRatio();
+        case LOG_ACCEPTANCE: return m_mcmcPtr->getLastLogAcceptance();
+        case ACCEPTANCE_RATE: return (m_stepCount == 0) ? 0. : (double) m_acceptedCount / m_stepCount;
+    }
+    return 0;
+}
+
+const size_t CollectStatistics::getStatisticIndex(const std::string& name) const {
+    for (size_t i = 0; i < m_statistics.size(); ++i)
+        if (STATISTIC_NAMES[m_statistics[i]] == name)
+            return i;
+    throw std::logic_error("CollectStatistics: statistic `" + name + "` is not collected.");
+}
+
+const std::vector<std::string> CollectStatistics::getStatisticNames() const {
+    std::vector<std::string> names;
+    for (auto statistic: m_statistics)
+        names.push_back(STATISTIC_NAMES[statistic]);
+    return names;
+}
+
+}
@@ -24,6 +24,7 @@ const DegreeCountsMap DegreePrior::computeDegreeCounts(const std::vector<size_t>
 
 void DegreePrior::recomputeConsistentState() {
     m_degreeCounts = computeDegreeCounts(m_state, m_edgeMatrixPriorPtr->getBlockPrior().getState());
+    invalidateCaches();
 }
 
 void DegreePrior::setState(const DegreeSequence& state) {
@@ -60,7 +61,8 @@ void DegreePrior::applyGraphMoveToDegreeCounts(const GraphMove& move){
     const DegreeSequence& degreeSeq = getState();
     const BlockSequence& blockSeq = m_blockPriorPtr->getState();
 
-    IntMap<BaseGraph::VertexIndex> diffDegreeMap;
+    auto& diffDegreeMap = m_diffDegreeMap;
+    diffDegreeMap.clear();
     for (auto edge : move.addedEdges){
         diffDegreeMap.increment(edge.first);
         diffDegreeMap.increment(edge.second);
@@ -190,7 +192,8 @@ const double DegreeUniformPrior::getLogLikelihood() const{
 
 const double DegreeUniformPrior::getLogLikelihoodRatioFromGraphMove(const GraphMove& move) const{
     const BlockSequence& blockSeq = m_blockPriorPtr->getState();
-    IntMap<BlockIndex> diffEdgeCountsMap;
+    auto& diffEdgeCountsMap = m_diffEdgeCountsMap;
+    diffEdgeCountsMap.clear();
     for (auto edge : move.addedEdges){
         diffEdgeCountsMap.increment(blockSeq[edge.first]) ;
         diffEdgeCountsMap.increment(blockSeq[edge.second]) ;
@@ -266,8 +269,10 @@ const double DegreeUniformHyperPrior::getLogLikelihood() const {
     return logP;
 }
 const double DegreeUniformHyperPrior::getLogLikelihoodRatioFromGraphMove(const GraphMove& move) const {
-    IntMap<std::pair<BlockIndex, size_t>> diffDegreeMap;
-    IntMap<BlockIndex> diffEdgeMap;
+    auto& diffDegreeMap = m_diffDegreeCountsMap;
+    auto& diffEdgeMap = m_diffEdgeCountsMap;
+    diffDegreeMap.clear();
+    diffEdgeMap.clear();
     for (auto edge : move.addedEdges){
         size_t ki = m_state[edge.first], kj = m_state[edge.second];
         BlockIndex r = m_blockPriorPtr->getBlockOfIdx(edge.first), s = m_blockPriorPtr->getBlockOfIdx(edge.second);
@@ -17,8 +17,11 @@ void EdgeMatrixPrior::recomputeConsistentState() {
     for (auto r : m_state)
         m_edgeCounts.set(r, m_state.getDegreeOfIdx(r));
     m_edgeCountPriorPtr->setState(m_state.getTotalEdgeNumber());
+    invalidateCaches();
 }
 void EdgeMatrixPrior::recomputeStateFromGraph() {
+    if (m_graphPtr == nullptr)
+        throw SafetyError("EdgeMatrixPrior: cannot compute the edge matrix since no graph is bound, `setGraph` must be called first.");
     m_state = MultiGraph(m_blockPriorPtr->getMaxBlockCount());
     m_edgeCounts.clear();
     for (const auto& vertex: *m_graphPtr){
@@ -33,6 +36,7 @@ void EdgeMatrixPrior::recomputeStateFromGraph() {
             );
         }
     }
+    invalidateCaches();
 }
 void EdgeMatrixPrior::setGraph(const MultiGraph& graph) {
     m_graphPtr = &graph;
@@ -53,6 +57,8 @@ void EdgeMatrixPrior::setState(const MultiGraph& edgeMatrix) {
 void EdgeMatrixPrior::applyLabelMoveToState(const BlockMove& move) {
     if (move.prevLabel == move.nextLabel)
         return;
+    if (m_graphPtr == nullptr)
+        throw SafetyError("EdgeMatrixPrior: cannot apply a label move since no graph is bound, `setGraph` must be called first.");
 
     if (m_state.getSize() <= move.nextLabel)
         m_state.resize(move.nextLabel + 1);
@@ -6,11 +6,26 @@
 namespace FastMIDyNet {
 
 
-const GraphMove DoubleEdgeSwapProposer::proposeRawMove() const {
+static DoubleEdgeSwapProposer::MoveCategory getSwapCategory(const BaseGraph::Edge removedEdges[2], const BaseGraph::Edge addedEdges[2]){
+    const auto& i = removedEdges[0].first, j = removedEdges[0].second;
+    const auto& k = removedEdges[1].first, l = removedEdges[1].second;
+    if ((addedEdges[0] == removedEdges[0] and addedEdges[1] == removedEdges[1])
+            or (addedEdges[0] == removedEdges[1] and addedEdges[1] == removedEdges[0]))
+        return DoubleEdgeSwapProposer::TRIVIAL;
+    if (i == j and k == l)
+        return DoubleEdgeSwapProposer::DOUBLE_LOOPY;
+    if (i == j or k == l)
+        return DoubleEdgeSwapProposer::SINGLE_LOOPY;
+    if ((i == k and j != l) or (j == k and i != l) or (i == l and j != k) or (j == l and i != k))
+        return DoubleEdgeSwapProposer::HINGE;
+    if (removedEdges[0] == removedEdges[1])
+        return DoubleEdgeSwapProposer::DOUBLE_EDGE;
+    return DoubleEdgeSwapProposer::NORMAL;
+}
+
+const DoubleEdgeSwapProposer::SwapMove DoubleEdgeSwapProposer::proposeSwapMove() const {
     auto edge1 = m_edgeSampler.sample();
-    m_edgeSampler.onEdgeRemoval(edge1);
-    auto edge2 = m_edgeSampler.sample();
-    m_edgeSampler.onEdgeAddition(edge1);
+    auto edge2 = m_edgeSampler.sampleExcluding(edge1);
 
     BaseGraph::Edge newEdge1, newEdge2;
     if (m_swapOrientationDistribution(rng)) {
@@ -22,12 +37,41 @@ const GraphMove DoubleEdgeSwapProposer::proposeRawMove() const {
         newEdge2 = {edge1.second, edge2.first};
     }
 
-    GraphMove move = {{edge1, edge2}, {newEdge1, newEdge2}};
-    return move;
+    return describeMove({{edge1, edge2}, {newEdge1, newEdge2}});
+}
+
+const DoubleEdgeSwapProposer::SwapMove DoubleEdgeSwapProposer::describeMove(const GraphMove& move) const {
+    SwapMove swapMove;
+    swapMove.move = move;
+    BaseGraph::Edge removedEdges[2], addedEdges[2];
+    for (size_t k = 0; k < 2; ++k){
+        removedEdges[k] = getOrderedEdge(move.removedEdges[k]);
+        addedEdges[k] = getOrderedEdge(move.addedEdges[k]);
+    }
+    swapMove.category = getSwapCategory(removedEdges, addedEdges);
+    for (size_t k = 0; k < 2; ++k){
+        swapMove.removedEdgeWeights[k] = (swapMove.category == TRIVIAL) ? 0 : m_edgeSampler.getEdgeWeight(removedEdges[k]);
+        swapMove.addedEdgeWeights[k] = (swapMove.category == TRIVIAL) ? 0 : m_edgeSampler.getEdgeWeight(addedEdges[k]);
+    }
+    return swapMove;
+}
+
+const GraphMove DoubleEdgeSwapProposer::proposeRawMove() const {
+    m_lastSwapMove = proposeSwapMove();
+    m_hasLastSwapMove = true;
+    return m_lastSwapMove.move;
+}
+
+const DoubleEdgeSwapProposer::SwapMove& DoubleEdgeSwapProposer::getSwapMove(const GraphMove& move, SwapMove& swapMove) const {
+    if (m_hasLastSwapMove and move == m_lastSwapMove.move)
+        return m_lastSwapMove;
+    swapMove = describeMove(move);
+    return swapMove;
 }
 
 void DoubleEdgeSwapProposer::setUp( const MultiGraph& graph ) {
     m_edgeSampler.clear();
+    m_hasLastSwapMove = false;
     m_graphPtr = &graph;
     for (auto vertex : graph)
         for (auto neighbor : graph.getNeighboursOfIdx(vertex))
@@ -36,6 +80,7 @@ void DoubleEdgeSwapProposer::setUp( const MultiGraph& graph ) {
 }
 
 void DoubleEdgeSwapProposer::applyGraphMove(const GraphMove& move) {
+    m_hasLastSwapMove = false;
     for (auto edge: move.removedEdges) {
         edge = getOrderedEdge(edge);
         m_edgeSampler.onEdgeRemoval(edge);
@@ -48,89 +93,37 @@ void DoubleEdgeSwapProposer::applyGraphMove(const GraphMove& move) {
 
 
 const double DoubleEdgeSwapProposer::getLogProposalProbRatio(const GraphMove& move) const{
-    const auto& removedEdge1 = getOrderedEdge(move.removedEdges[0]);
-    const auto& removedEdge2 = getOrderedEdge(move.removedEdges[1]);
-
-    // move.display();
-    if ( isTrivialMove(move) ){
-        // printf("Trivial move\n\n");
-        return 0;
-    } else if ( isSelfLoop(removedEdge1) and isSelfLoop(removedEdge2) ){
-        // printf("Double loopy move\n\n");
-        return getLogPropForDoubleLoopyMove(move);
-    } else if ( isSelfLoop(removedEdge1) or isSelfLoop(removedEdge2) ) {
-        // printf("Single loopy move\n\n");
-        return getLogPropForNormalMove(move) - log(2);
-    } else if ( isHingeMove(move) ) {
-        // printf("Hinge move\n\n");
-        return getLogPropForNormalMove(move) + log(2);
-    } else if ( removedEdge1 == removedEdge2 ) {
-        // printf("Double edge move\n\n");
-        return getLogPropForDoubleEdgeMove(move);
-    }
-
-    // printf("Normal move\n\n");
-    return getLogPropForNormalMove(move);
-}
-
-bool DoubleEdgeSwapProposer::isTrivialMove(const GraphMove& move) const {
-    const auto& addedEdge1 = getOrderedEdge(move.addedEdges[0]);
-    const auto& addedEdge2 = getOrderedEdge(move.addedEdges[1]);
-
-    const auto& removedEdge1 = getOrderedEdge(move.removedEdges[0]);
-    const auto& removedEdge2 = getOrderedEdge(move.removedEdges[1]);
-
-    if (addedEdge1 == removedEdge1 and addedEdge2 == removedEdge2)
-        return true;
-    if (addedEdge1 == removedEdge2 and addedEdge2 == removedEdge1)
-        return true;
-    return false;
+    SwapMove swapMove;
+    return getLogProposalProbRatio(getSwapMove(move, swapMove));
 }
 
-bool DoubleEdgeSwapProposer::isHingeMove(const GraphMove& move) const {
-    const auto& removedEdge1 = getOrderedEdge(move.removedEdges[0]);
-    const auto& removedEdge2 = getOrderedEdge(move.removedEdges[1]);
-    const auto& i = removedEdge1.first, j = removedEdge1.second;
-    const auto& k = removedEdge2.first, l = removedEdge2.second;
-    return (i == k and j != l) or
-           (j == k and i != l) or
-           (i == l and j != k) or
-           (j == l and i != k);
-}
-
-
-const double DoubleEdgeSwapProposer::getLogPropForNormalMove(const GraphMove& move) const{
-    const auto& addedEdge1 = getOrderedEdge(move.addedEdges[0]), addedEdge2 = getOrderedEdge(move.addedEdges[1]);
-    const auto& removedEdge1 = getOrderedEdge(move.removedEdges[0]), removedEdge2 = getOrderedEdge(move.removedEdges[1]);
-    double addedEdge1Weight = m_edgeSampler.getEdgeWeight(addedEdge1);
-    double addedEdge2Weight = m_edgeSampler.getEdgeWeight(addedEdge2);
-    double removedEdge1Weight = m_edgeSampler.getEdgeWeight(removedEdge1);
-    double removedEdge2Weight = m_edgeSampler.getEdgeWeight(removedEdge2);
-    return log(addedEdge1Weight + 1) + log(addedEdge2Weight + 1)
-         - log(removedEdge1Weight) - log(removedEdge2Weight);
-}
-
-const double DoubleEdgeSwapProposer::getLogPropForDoubleLoopyMove(const GraphMove& move) const{
-    const auto& addedEdge = getOrderedEdge(move.addedEdges[0]);
-    const auto& removedSelfLoop1 = getOrderedEdge(move.removedEdges[0]);
-    const auto& removedSelfLoop2 = getOrderedEdge(move.removedEdges[1]);
-    double addedEdgeWeight = m_edgeSampler.getEdgeWeight(addedEdge);
-    double removedSelfLoop1Weight = m_edgeSampler.getEdgeWeight(removedSelfLoop1);
-    double removedSelfLoop2Weight = m_edgeSampler.getEdgeWeight(removedSelfLoop2);
-    return log(addedEdgeWeight + 2) + log(addedEdgeWeight + 1)
-         - log(removedSelfLoop1Weight) - log(removedSelfLoop2Weight)
-         - log(4);
+const double DoubleEdgeSwapProposer::getLogProposalProbRatio(const SwapMove& swapMove) const{
+    const double* removedWeights = swapMove.removedEdgeWeights;
+    const double* addedWeights = swapMove.addedEdgeWeights;
+    switch (swapMove.category) {
+        case TRIVIAL:
+            return 0;
+        case DOUBLE_LOOPY:
+            return log(addedWeights[0] + 2) + log(addedWeights[0] + 1)
+                 - log(removedWeights[0]) - log(removedWeights[1]) - log(4);
+        case DOUBLE_EDGE:
+            return log(4) + log(addedWeights[0] + 1) + log(addedWeights[1] + 1)
+                 - log(removedWeights[0]) - log(removedWeights[0] - 1);
+        default:
+            break;
+    }
+    double logRatio = log(addedWeights[0] + 1) + log(addedWeights[1] + 1)
+                    - log(removedWeights[0]) - log(removedWeights[1]);
+    if (swapMove.category == SINGLE_LOOPY)
+        return logRatio - log(2);
+    if (swapMove.category == HINGE)
+        return logRatio + log(2);
+    return logRatio;
 }
 
-const double DoubleEdgeSwapProposer::getLogPropForDoubleEdgeMove(const GraphMove& move) const{
-    const auto& addedSelfLoop1 = getOrderedEdge(move.addedEdges[0]);
-    const auto& addedSelfLoop2 = getOrderedEdge(move.addedEdges[1]);
-    const auto& removedEdge = getOrderedEdge(move.removedEdges[0]);
-    double addedSelfLoop1Weight = m_edgeSampler.getEdgeWeight(addedSelfLoop1);
-    double addedSelfLoop2Weight = m_edgeSampler.getEdgeWeight(addedSelfLoop2);
-    double removedEdgeWeight = m_edgeSampler.getEdgeWeight(removedEdge);
-    return log(4) + log(addedSelfLoop1Weight + 1) + log(addedSelfLoop2Weight + 1)
-         - log(removedEdgeWeight) - log(removedEdgeWeight - 1);
+const size_t DoubleEdgeSwapProposer::getMoveCategory(const GraphMove& move) const{
+    SwapMove swapMove;
+    return getSwapMove(move, swapMove).category;
 }
 
 
@@ -6,11 +6,15 @@ namespace FastMIDyNet{
 const GraphMove EdgeProposer::proposeMove() const {
     for (size_t i = 0; i < m_maxIteration; i++) {
         GraphMove move = proposeRawMove();
+        bool isValid = true;
         for (auto e : move.addedEdges){
-            if ((isSelfLoop(e) and not m_allowSelfLoops) or (isExistingEdge(e) and not m_allowMultiEdges))
-                continue;
-            return move;
+            if ((isSelfLoop(e) and not m_allowSelfLoops) or (isExistingEdge(e) and not m_allowMultiEdges)){
+                isValid = false;
+                break;
+            }
         }
+        if (isValid)
+            return move;
     }
     throw std::runtime_error("EdgeProposer: Could not find edge to propose.");
 }
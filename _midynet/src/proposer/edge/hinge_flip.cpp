@@ -8,14 +8,7 @@ namespace FastMIDyNet {
 
 const GraphMove HingeFlipProposer::proposeRawMove() const {
     auto edge = m_edgeSampler.sample();
-    if (m_edgeProposalCounter.count(edge) == 0)
-        m_edgeProposalCounter.insert({edge, 0});
-    ++m_edgeProposalCounter[edge];
-
     BaseGraph::VertexIndex vertex = m_vertexSamplerPtr->sample();
-    if (m_vertexProposalCounter.count(vertex) == 0)
-        m_vertexProposalCounter.insert({vertex, 0});
-    ++m_vertexProposalCounter[vertex];
 
     BaseGraph::Edge newEdge;
     if (m_flipOrientationDistribution(rng)) {
@@ -69,25 +62,30 @@ void HingeFlipProposer::applyGraphMove(const GraphMove& move) {
 }
 
 const double HingeFlipProposer::getLogProposalProbRatio(const GraphMove& move) const{
+    switch (getMoveCategory(move)) {
+        case TRIVIAL:
+            return 0;
+        case LOOPY:
+            return getLogPropRatioForLoopyMove(move);
+        case SELFIE:
+            return getLogPropRatioForSelfieMove(move);
+        default:
+            return getLogPropRatioForNormalMove(move);
+    }
+}
+
+const size_t HingeFlipProposer::getMoveCategory(const GraphMove& move) const{
     BaseGraph::VertexIndex i = move.addedEdges[0].first;
     BaseGraph::VertexIndex j = move.removedEdges[0].second;
     BaseGraph::VertexIndex k = move.addedEdges[0].second;
 
-    if ( isTrivialMove(move) ){
-        // printf("Trivial move\n");
-        return 0;
-    }
-    if (i == j and i != k){
-        // printf("Loopy move\n");
-        return getLogPropRatioForLoopyMove(move);
-    }
-    if ((i == k or j == k) and i != j){
-        // printf("Selfie move\n");
-        return getLogPropRatioForSelfieMove(move);
-    }
-    // printf("Normal move\n");
-    return getLogPropRatioForNormalMove(move);
-
+    if ( isTrivialMove(move) )
+        return TRIVIAL;
+    if (i == j and i != k)
+        return LOOPY;
+    if ((i == k or j == k) and i != j)
+        return SELFIE;
+    return NORMAL;
 }
 
 bool HingeFlipProposer::isTrivialMove(const GraphMove& move) const {
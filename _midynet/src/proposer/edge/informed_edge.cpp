@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/utility/parallel.hpp"
+#include "FastMIDyNet/rng.h"
+#include "FastMIDyNet/proposer/edge/informed_edge.h"
+
+
+namespace FastMIDyNet {
+
+static inline size_t popcount(uint64_t word){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    size_t count = 0;
+    for (; word != 0; word &= word - 1)
+        ++count;
+    return count;
+#endif
+}
+
+/* Packs, for each vertex, whether it is active and whether it changes state at each
+ * step into rows of `wordCount` 64-bit words. */
+static size_t buildStateBitsets(const StateSequence& pastStates, const StateSequence& futureStates,
+        std::vector<uint64_t>& activeStates, std::vector<uint64_t>& changedStates){
+    if (pastStates.size() != futureStates.size())
+        throw std::logic_error("InformedEdgeProposer: past and future states have different sizes.");
+    size_t stepCount = (pastStates.size() == 0) ? 0 : pastStates[0].size();
+    size_t wordCount = stepCount / 64 + (stepCount % 64 != 0);
+    activeStates.assign(pastStates.size() * wordCount, 0);
+    changedStates.assign(pastStates.size() * wordCount, 0);
+    for (size_t vertex = 0; vertex < pastStates.size(); ++vertex){
+        if (pastStates[vertex].size() != stepCount or futureStates[vertex].size() != stepCount)
+            throw std::logic_error("InformedEdgeProposer: state sequences have different lengths.");
+        for (size_t t = 0; t < stepCount; ++t){
+            uint64_t bit = (uint64_t) 1 << (t % 64);
+            if (pastStates[vertex][t] > 0)
+                activeStates[vertex * wordCount + t / 64] |= bit;
+            if (pastStates[vertex][t] != futureStates[vertex][t])
+                changedStates[vertex * wordCount + t / 64] |= bit;
+        }
+    }
+    return wordCount;
+}
+
+/* Scores are computed for tiles of vertices at once, so that each row of the bitsets
+ * streamed from memory is used against the whole tile. */
+static CandidateNeighborList getCandidateNeighbors(const std::vector<uint64_t>& activeStates,
+        const std::vector<uint64_t>& changedStates, size_t size, size_t wordCount,
+        size_t candidateCount, size_t numThreads){
+    const size_t tileSize = 64;
+    CandidateNeighborList candidates(size);
+    if (wordCount == 0 or candidateCount == 0)
+        return candidates;
+
+    parallelFor(size, numThreads, [&](size_t begin, size_t end){
+        std::vector<uint32_t> scores(tileSize * size);
+        std::vector<std::pair<uint32_t, BaseGraph::VertexIndex>> ranked;
+        for (size_t tileBegin = begin; tileBegin < end; tileBegin += tileSize){
+            size_t tileEnd = std::min(tileBegin + tileSize, end);
+            for (BaseGraph::VertexIndex j = 0; j < size; ++j){
+                const uint64_t* activeJ = &activeStates[j * wordCount];
+                const uint64_t* changedJ = &changedStates[j * wordCount];
+                for (size_t i = tileBegin; i < tileEnd; ++i){
+                    const uint64_t* activeI = &activeStates[i * wordCount];
+                    const uint64_t* changedI = &changedStates[i * wordCount];
+                    uint32_t score = 0;
+                    for (size_t w = 0; w < wordCount; ++w)
+                        score += popcount(activeI[w] & changedJ[w]) + popcount(activeJ[w] & changedI[w]);
+                    scores[(i - tileBegin) * size + j] = score;
+                }
+            }
+            for (size_t i = tileBegin; i < tileEnd; ++i){
+                ranked.clear();
+                for (BaseGraph::VertexIndex j = 0; j < size; ++j){
+                    uint32_t score = scores[(i - tileBegin) * size + j];
+                    if (j != i and score > 0)
+                        ranked.push_back({score, j});
+                }
+                size_t count = std::min(candidateCount, ranked.size());
+                std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(),
+                    [](const std::pair<uint32_t, BaseGraph::VertexIndex>& a, const std::pair<uint32_t, BaseGraph::VertexIndex>& b){
+                        return a.first > b.first or (a.first == b.first and a.second < b.second);
+                    });
+                for (size_t k = 0; k < count; ++k)
+                    candidates[i].push_back({ranked[k].second, ranked[k].first});
+            }
+        }
+    });
+    return candidates;
+}
+
+InformedEdgeProposer::InformedEdgeProposer(bool allowSelfLoops, bool allowMultiEdges,
+        size_t candidateCount, double uniformProb, size_t numThreads):
+    EdgeProposer(allowSelfLoops, allowMultiEdges),
+    m_candidateCount(candidateCount),
+    m_uniformProb(uniformProb),
+    m_numThreads(numThreads){
+    if (uniformProb < 0 or uniformProb > 1)
+        throw std::logic_error("InformedEdgeProposer: `uniformProb` must be between 0 and 1.");
+}
+
+CandidateNeighborList InformedEdgeProposer::computeCandidateNeighbors(const StateSequence& pastStates,
+        const StateSequence& futureStates, size_t candidateCount, size_t numThreads){
+    std::vector<uint64_t> activeStates, changedStates;
+    size_t wordCount = buildStateBitsets(pastStates, futureStates, activeStates, changedStates);
+    return getCandidateNeighbors(activeStates, changedStates, pastStates.size(), wordCount, candidateCount, numThreads);
+}
+
+void InformedEdgeProposer::setUpStates(const StateSequence& pastStates, const StateSequence& futureStates){
+    std::vector<uint64_t> activeStates, changedStates;
+    size_t wordCount = buildStateBitsets(pastStates, futureStates, activeStates, changedStates);
+    if (m_candidateSampler.getSize() != 0 and activeStates == m_activeStates and changedStates == m_changedStates)
+        return;
+
+    m_candidateSampler.clear();
+    auto candidates = getCandidateNeighbors(activeStates, changedStates, pastStates.size(), wordCount, m_candidateCount, m_numThreads);
+    for (BaseGraph::VertexIndex vertex = 0; vertex < candidates.size(); ++vertex)
+        for (const auto& candidate: candidates[vertex])
+            m_candidateSampler.onEdgeInsertion({vertex, candidate.first}, candidate.second);
+    m_activeStates = std::move(activeStates);
+    m_changedStates = std::move(changedStates);
+}
+
+void InformedEdgeProposer::setUp(const MultiGraph& graph){
+    m_edgeSampler.clear();
+    m_graphPtr = &graph;
+    for (auto vertex : graph)
+        for (auto neighbor : graph.getNeighboursOfIdx(vertex))
+            if (vertex <= neighbor.vertexIndex)
+                m_edgeSampler.onEdgeInsertion({vertex, neighbor.vertexIndex}, neighbor.label);
+}
+
+const GraphMove InformedEdgeProposer::proposeRawMove() const {
+    if (m_addOrRemoveDistribution(rng)){
+        BaseGraph::Edge edge;
+        if (m_uniform01(rng) < getUniformProb()){
+            std::uniform_int_distribution<BaseGraph::VertexIndex> vertexDistribution(0, m_graphPtr->getSize() - 1);
+            edge = getOrderedEdge({vertexDistribution(rng), vertexDistribution(rng)});
+        }
+        else
+            edge = m_candidateSampler.sample();
+        if ((isSelfLoop(edge) and not m_allowSelfLoops) or (isExistingEdge(edge) and not m_allowMultiEdges))
+            return {{}, {}};
+        return {{}, {edge}};
+    }
+    if (m_edgeSampler.getTotalWeight() == 0)
+        return {{}, {}};
+    return {{m_edgeSampler.sample()}, {}};
+}
+
+const double InformedEdgeProposer::getLogAdditionProb(const BaseGraph::Edge& edge) const {
+    double size = m_graphPtr->getSize();
+    double uniformProb = getUniformProb();
+    double prob = uniformProb * ((edge.first == edge.second) ? 1 : 2) / (size * size);
+    if (uniformProb < 1)
+        prob += (1 - uniformProb) * m_candidateSampler.getEdgeWeight(edge) / m_candidateSampler.getTotalWeight();
+    return log(prob);
+}
+
+const double InformedEdgeProposer::getLogProposalProbRatio(const GraphMove& move) const {
+    double edgeCount = m_edgeSampler.getTotalWeight();
+    if (move.addedEdges.size() != 0){
+        auto edge = getOrderedEdge(move.addedEdges[0]);
+        double weight = m_edgeSampler.getEdgeWeight(edge);
+        return log(weight + 1) - log(edgeCount + 1) - getLogAdditionProb(edge);
+    }
+    if (move.removedEdges.size() != 0){
+        auto edge = getOrderedEdge(move.removedEdges[0]);
+        double weight = m_edgeSampler.getEdgeWeight(edge);
+        return getLogAdditionProb(edge) - log(weight) + log(edgeCount);
+    }
+    return 0;
+}
+
+void InformedEdgeProposer::applyGraphMove(const GraphMove& move){
+    for (auto edge: move.removedEdges)
+        m_edgeSampler.onEdgeRemoval(getOrderedEdge(edge));
+    for (auto edge: move.addedEdges)
+        m_edgeSampler.onEdgeAddition(getOrderedEdge(edge));
+}
+
+} // namespace FastMIDyNet
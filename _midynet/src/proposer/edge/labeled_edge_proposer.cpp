@@ -1,5 +1,72 @@
+#include <string>
+
 #include "FastMIDyNet/proposer/edge/labeled_edge_proposer.h"
+#include "FastMIDyNet/rng.h"
 
 namespace FastMIDyNet{
 
+void LabeledEdgeProposer::insertVertex(BaseGraph::VertexIndex vertex, BlockIndex label){
+    if (label >= m_labelVertices.size())
+        m_labelVertices.resize(label + 1);
+    m_vertexPositions[vertex] = m_labelVertices[label].size();
+    m_labelVertices[label].push_back(vertex);
+}
+
+void LabeledEdgeProposer::eraseVertex(BaseGraph::VertexIndex vertex, BlockIndex label){
+    auto& vertices = m_labelVertices.at(label);
+    size_t position = m_vertexPositions[vertex];
+    if (position >= vertices.size() or vertices[position] != vertex)
+        throw std::logic_error("LabeledEdgeProposer: vertex " + std::to_string(vertex)
+            + " does not have label " + std::to_string(label) + ".");
+    vertices[position] = vertices.back();
+    m_vertexPositions[vertices[position]] = position;
+    vertices.pop_back();
+}
+
+void LabeledEdgeProposer::setUpLabels(const VertexLabeledRandomGraph<BlockIndex>& graphPrior){
+    m_graphPriorPtr = &graphPrior;
+    const auto& labels = graphPrior.getLabels();
+    m_labelVertices.clear();
+    m_vertexPositions.assign(labels.size(), 0);
+    for (BaseGraph::VertexIndex vertex = 0; vertex < labels.size(); ++vertex)
+        insertVertex(vertex, labels[vertex]);
+}
+
+void LabeledEdgeProposer::applyLabelMove(const BlockMove& move){
+    if (move.prevLabel == move.nextLabel)
+        return;
+    eraseVertex(move.vertexIndex, move.prevLabel);
+    insertVertex(move.vertexIndex, move.nextLabel);
+}
+
+BaseGraph::VertexIndex LabeledEdgeProposer::sampleVertexWithLabel(BlockIndex label) const {
+    if (getLabelSize(label) == 0)
+        throw std::logic_error("LabeledEdgeProposer: Cannot sample from empty label " + std::to_string(label) + ".");
+    const auto& vertices = m_labelVertices[label];
+    return vertices[std::uniform_int_distribution<size_t>(0, vertices.size() - 1)(rng)];
+}
+
+void LabeledEdgeProposer::checkSelfConsistency() const {
+    if (m_graphPriorPtr == nullptr)
+        return;
+    const auto& labels = m_graphPriorPtr->getLabels();
+    if (m_vertexPositions.size() != labels.size())
+        throw ConsistencyError("LabeledEdgeProposer: `m_vertexPositions` has size "
+            + std::to_string(m_vertexPositions.size()) + " while the graph prior has "
+            + std::to_string(labels.size()) + " vertices.");
+    size_t vertexCount = 0;
+    for (const auto& vertices: m_labelVertices)
+        vertexCount += vertices.size();
+    if (vertexCount != labels.size())
+        throw ConsistencyError("LabeledEdgeProposer: labels contain " + std::to_string(vertexCount)
+            + " vertices while the graph prior has " + std::to_string(labels.size()) + ".");
+    for (BaseGraph::VertexIndex vertex = 0; vertex < labels.size(); ++vertex){
+        size_t position = m_vertexPositions[vertex];
+        if (labels[vertex] >= m_labelVertices.size() or position >= m_labelVertices[labels[vertex]].size()
+                or m_labelVertices[labels[vertex]][position] != vertex)
+            throw ConsistencyError("LabeledEdgeProposer: vertex " + std::to_string(vertex)
+                + " is not stored with its label " + std::to_string(labels[vertex]) + ".");
+    }
+}
+
 }
@@ -0,0 +1,92 @@
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/rng.h"
+#include "FastMIDyNet/proposer/edge/labeled_single_edge.h"
+
+
+namespace FastMIDyNet {
+
+LabeledSingleEdgeProposer::LabeledSingleEdgeProposer(bool allowSelfLoops, bool allowMultiEdges, double labelPairShift):
+    LabeledEdgeProposer(allowSelfLoops, allowMultiEdges),
+    m_labelPairShift(labelPairShift){
+    if (labelPairShift <= 0)
+        throw std::logic_error("LabeledSingleEdgeProposer: `labelPairShift` must be positive.");
+}
+
+void LabeledSingleEdgeProposer::setUp(const MultiGraph& graph){
+    if (m_graphPriorPtr == nullptr)
+        throw std::logic_error("LabeledSingleEdgeProposer: no labeled graph prior is bound, "
+            "`setUpLabels` must be called before `setUp`.");
+    m_edgeSampler.clear();
+    m_graphPtr = &graph;
+    for (auto vertex : graph)
+        for (auto neighbor : graph.getNeighboursOfIdx(vertex))
+            if (vertex <= neighbor.vertexIndex)
+                m_edgeSampler.onEdgeInsertion({vertex, neighbor.vertexIndex}, neighbor.label);
+}
+
+const GraphMove LabeledSingleEdgeProposer::proposeRawMove() const {
+    double edgeCount = m_edgeSampler.getTotalWeight();
+    if (m_addOrRemoveDistribution(rng)){
+        BaseGraph::Edge edge;
+        if (m_uniform01(rng) * getTotalLabelPairWeight() < edgeCount){
+            auto labelEdge = m_edgeSampler.sample();
+            edge = {
+                sampleVertexWithLabel(getLabelOfIdx(labelEdge.first)),
+                sampleVertexWithLabel(getLabelOfIdx(labelEdge.second))
+            };
+        }
+        else{
+            std::uniform_int_distribution<BaseGraph::VertexIndex> vertexDistribution(0, m_graphPtr->getSize() - 1);
+            edge = {vertexDistribution(rng), vertexDistribution(rng)};
+        }
+        edge = getOrderedEdge(edge);
+        if ((isSelfLoop(edge) and not m_allowSelfLoops) or (isExistingEdge(edge) and not m_allowMultiEdges))
+            return {{}, {}};
+        return {{}, {edge}};
+    }
+    if (edgeCount == 0)
+        return {{}, {}};
+    return {{m_edgeSampler.sample()}, {}};
+}
+
+const double LabeledSingleEdgeProposer::getLabelPairWeight(BlockIndex r, BlockIndex s) const {
+    const auto& labelGraph = m_graphPriorPtr->getLabelGraph();
+    double labelEdgeCount = (r < labelGraph.getSize() and s < labelGraph.getSize()) ? labelGraph.getEdgeMultiplicityIdx(r, s) : 0;
+    double vertexPairCount = getLabelSize(r) * getLabelSize(s) * ((r == s) ? 1. : 2.);
+    return labelEdgeCount + m_labelPairShift * vertexPairCount;
+}
+
+/* The label edge count and the edge count are shifted by `edgeCountOffset` to get the
+ * probability of the reverse of a removal, in the graph where the edge is removed. */
+const double LabeledSingleEdgeProposer::getLogAdditionProb(const BaseGraph::Edge& edge, int edgeCountOffset) const {
+    BlockIndex r = getLabelOfIdx(edge.first), s = getLabelOfIdx(edge.second);
+    double vertexPairCount = getLabelSize(r) * getLabelSize(s) * ((r == s) ? 1. : 2.);
+    return log(getLabelPairWeight(r, s) + edgeCountOffset) - log(getTotalLabelPairWeight() + edgeCountOffset)
+        + log((edge.first == edge.second) ? 1 : 2) - log(vertexPairCount);
+}
+
+const double LabeledSingleEdgeProposer::getLogProposalProbRatio(const GraphMove& move) const {
+    double edgeCount = m_edgeSampler.getTotalWeight();
+    if (move.addedEdges.size() != 0){
+        auto edge = getOrderedEdge(move.addedEdges[0]);
+        double weight = m_edgeSampler.getEdgeWeight(edge);
+        return log(weight + 1) - log(edgeCount + 1) - getLogAdditionProb(edge);
+    }
+    if (move.removedEdges.size() != 0){
+        auto edge = getOrderedEdge(move.removedEdges[0]);
+        double weight = m_edgeSampler.getEdgeWeight(edge);
+        return getLogAdditionProb(edge, -1) - log(weight) + log(edgeCount);
+    }
+    return 0;
+}
+
+void LabeledSingleEdgeProposer::applyGraphMove(const GraphMove& move){
+    for (auto edge: move.removedEdges)
+        m_edgeSampler.onEdgeRemoval(getOrderedEdge(edge));
+    for (auto edge: move.addedEdges)
+        m_edgeSampler.onEdgeAddition(getOrderedEdge(edge));
+}
+
+} // namespace FastMIDyNet
@@ -1,3 +1,7 @@
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
 #include "FastMIDyNet/utility/functions.h"
 #include "FastMIDyNet/rng.h"
 #include "FastMIDyNet/proposer/edge/single_edge.h"
@@ -12,13 +16,6 @@ const GraphMove SingleEdgeProposer::proposeRawMove() const {
 
     BaseGraph::Edge proposedEdge = {vertex1, vertex2};
 
-    std::cout << "N = " << m_graphPtr->getSize() << std::endl;
-    std::cout << "E = " << m_graphPtr->getTotalEdgeNumber() << std::endl;
-    std::cout << "v1 = " << vertex1 << std::endl;
-    std::cout << "v2 = " << vertex2 << std::endl;
-    std::cout << "E(v1,v2) = " << m_graphPtr->getEdgeMultiplicityIdx(vertex1, vertex2) << std::endl;
-
-
     if (not m_graphPtr->isEdgeIdx(vertex1, vertex2))
         return {{}, {proposedEdge}};
 
@@ -87,5 +84,117 @@ const double SingleEdgeDegreeProposer::getLogProposalProbRatio(const GraphMove&m
     }
     return logRatio;
 }
+/* Pairs (i, j) with i <= j are indexed by j * (j + 1) / 2 + i when self-loops are
+ * allowed, and pairs with i < j by j * (j - 1) / 2 + i otherwise. */
+const size_t SingleEdgeSimpleProposer::getPairIndex(BaseGraph::Edge edge) const {
+    edge = getOrderedEdge(edge);
+    if (m_allowSelfLoops)
+        return edge.second * (edge.second + 1) / 2 + edge.first;
+    return edge.second * (edge.second - 1) / 2 + edge.first;
+}
+
+const BaseGraph::Edge SingleEdgeSimpleProposer::getPair(size_t pairIndex) const {
+    size_t offset = (m_allowSelfLoops) ? 1 : 0;
+    auto getRowStart = [&](size_t j) { return j * (j + 2 * offset - 1) / 2; };
+    size_t j = (1 - offset + sqrt(8. * pairIndex + 1)) / 2;
+    while (j > 0 and getRowStart(j) > pairIndex)
+        --j;
+    while (getRowStart(j + 1) <= pairIndex)
+        ++j;
+    return {pairIndex - getRowStart(j), j};
+}
+
+void SingleEdgeSimpleProposer::insertPair(size_t pairIndex, bool isEdge){
+    auto& pairs = (isEdge) ? m_edges : m_nonEdges;
+    m_isEdge[pairIndex] = isEdge;
+    m_positions[pairIndex] = pairs.size();
+    pairs.push_back(pairIndex);
+}
+
+void SingleEdgeSimpleProposer::erasePair(size_t pairIndex){
+    auto& pairs = (m_isEdge[pairIndex]) ? m_edges : m_nonEdges;
+    size_t position = m_positions[pairIndex];
+    pairs[position] = pairs.back();
+    m_positions[pairs[position]] = position;
+    pairs.pop_back();
+}
+
+void SingleEdgeSimpleProposer::setUp(const MultiGraph& graph){
+    m_graphPtr = &graph;
+    size_t size = graph.getSize();
+    size_t pairCount = (m_allowSelfLoops) ? size * (size + 1) / 2 : size * (size - 1) / 2;
+    m_edges.clear();
+    m_nonEdges.clear();
+    m_positions.assign(pairCount, 0);
+    m_isEdge.assign(pairCount, false);
+    for (auto vertex : graph)
+        for (auto neighbor : graph.getNeighboursOfIdx(vertex)){
+            if ((vertex == neighbor.vertexIndex and not m_allowSelfLoops) or neighbor.label > 1)
+                throw std::logic_error("SingleEdgeSimpleProposer: graph is not simple, edge ("
+                    + std::to_string(vertex) + ", " + std::to_string(neighbor.vertexIndex) + ") has multiplicity "
+                    + std::to_string(neighbor.label) + ".");
+            if (vertex <= neighbor.vertexIndex)
+                m_isEdge[getPairIndex({vertex, neighbor.vertexIndex})] = true;
+        }
+    for (size_t pairIndex = 0; pairIndex < pairCount; ++pairIndex)
+        insertPair(pairIndex, m_isEdge[pairIndex]);
+}
+
+const GraphMove SingleEdgeSimpleProposer::proposeRawMove() const {
+    double edgeCount = m_edges.size(), nonEdgeCount = m_nonEdges.size();
+    double additionProb = getAdditionProb(edgeCount, nonEdgeCount);
+    if (additionProb == 0 and edgeCount == 0)
+        return {{}, {}};
+    bool isAddition = (additionProb == 1) or (additionProb > 0 and m_addOrRemoveDistribution(rng));
+    const auto& pairs = (isAddition) ? m_nonEdges : m_edges;
+    auto edge = getPair(pairs[std::uniform_int_distribution<size_t>(0, pairs.size() - 1)(rng)]);
+    if (isAddition)
+        return {{}, {edge}};
+    return {{edge}, {}};
+}
+
+const double SingleEdgeSimpleProposer::getLogProposalProbRatio(const GraphMove& move) const {
+    double edgeCount = m_edges.size(), nonEdgeCount = m_nonEdges.size();
+    if (move.addedEdges.size() != 0)
+        return log(getRemovalProb(edgeCount + 1, nonEdgeCount - 1)) - log(edgeCount + 1)
+             - log(getAdditionProb(edgeCount, nonEdgeCount)) + log(nonEdgeCount);
+    if (move.removedEdges.size() != 0)
+        return log(getAdditionProb(edgeCount - 1, nonEdgeCount + 1)) - log(nonEdgeCount + 1)
+             - log(getRemovalProb(edgeCount, nonEdgeCount)) + log(edgeCount);
+    return 0;
+}
+
+void SingleEdgeSimpleProposer::applyGraphMove(const GraphMove& move){
+    for (auto edge: move.removedEdges){
+        size_t pairIndex = getPairIndex(edge);
+        if (not m_isEdge[pairIndex])
+            throw std::logic_error("SingleEdgeSimpleProposer: Cannot remove non-existing edge ("
+                + std::to_string(edge.first) + ", " + std::to_string(edge.second) + ").");
+        erasePair(pairIndex);
+        insertPair(pairIndex, false);
+    }
+    for (auto edge: move.addedEdges){
+        size_t pairIndex = getPairIndex(edge);
+        if (m_isEdge[pairIndex])
+            throw std::logic_error("SingleEdgeSimpleProposer: Cannot add existing edge ("
+                + std::to_string(edge.first) + ", " + std::to_string(edge.second) + ") to a simple graph.");
+        erasePair(pairIndex);
+        insertPair(pairIndex, true);
+    }
+}
+
+void SingleEdgeSimpleProposer::checkSelfConsistency() const {
+    if (m_graphPtr == nullptr)
+        return;
+    if (m_edges.size() != m_graphPtr->getTotalEdgeNumber())
+        throw ConsistencyError("SingleEdgeSimpleProposer: proposer has " + std::to_string(m_edges.size())
+            + " edges while the graph has " + std::to_string(m_graphPtr->getTotalEdgeNumber()) + ".");
+    for (auto pairIndex : m_edges){
+        auto edge = getPair(pairIndex);
+        if (m_graphPtr->getEdgeMultiplicityIdx(edge) != 1)
+            throw ConsistencyError("SingleEdgeSimpleProposer: edge (" + std::to_string(edge.first) + ", "
+                + std::to_string(edge.second) + ") is not a simple edge of the graph.");
+    }
+}
 
 } // namespace FastMIDyNet
@@ -3,34 +3,112 @@
 
 namespace FastMIDyNet{
 
+void EdgeSampler::addToWeight(size_t position, double weight){
+    m_weights[position] += weight;
+    m_totalWeight += weight;
+    for (size_t i = position + 1; i <= m_cumulativeWeights.size(); i += i & -i)
+        m_cumulativeWeights[i - 1] += weight;
+}
+
+double EdgeSampler::getWeightBefore(size_t position) const {
+    double weight = 0;
+    for (size_t i = position; i > 0; i -= i & -i)
+        weight += m_cumulativeWeights[i - 1];
+    return weight;
+}
+
+size_t EdgeSampler::findPosition(double cumulativeWeight) const {
+    size_t position = 0, step = 1;
+    while (2 * step <= m_cumulativeWeights.size())
+        step *= 2;
+    for (; step > 0; step /= 2){
+        if (position + step <= m_cumulativeWeights.size() and m_cumulativeWeights[position + step - 1] <= cumulativeWeight){
+            cumulativeWeight -= m_cumulativeWeights[position + step - 1];
+            position += step;
+        }
+    }
+    return (position < m_edges.size()) ? position : m_edges.size() - 1;
+}
+
+void EdgeSampler::insertEdge(const BaseGraph::Edge& orderedEdge, double weight){
+    size_t i = m_edges.size() + 1;
+    m_cumulativeWeights.push_back(weight + getWeightBefore(i - 1) - getWeightBefore(i - (i & -i)));
+    m_positions.set(orderedEdge, m_edges.size());
+    m_edges.push_back(orderedEdge);
+    m_weights.push_back(weight);
+    m_totalWeight += weight;
+}
+
+void EdgeSampler::eraseEdge(const BaseGraph::Edge& orderedEdge){
+    size_t position = m_positions.get(orderedEdge), last = m_edges.size() - 1;
+    if (position != last){
+        addToWeight(position, m_weights[last] - m_weights[position]);
+        m_edges[position] = m_edges[last];
+        m_positions.set(m_edges[position], position);
+    }
+    // no prefix of the remaining positions goes through the last node of the tree
+    m_totalWeight -= m_weights[last];
+    m_edges.pop_back();
+    m_weights.pop_back();
+    m_cumulativeWeights.pop_back();
+    m_positions.erase(orderedEdge);
+}
+
+BaseGraph::Edge EdgeSampler::sample() const {
+    if (m_edges.size() == 0)
+        throw std::logic_error("EdgeSampler: Cannot sample from an empty sampler.");
+    double cumulativeWeight = std::uniform_real_distribution<double>(0, m_totalWeight)(rng);
+    return m_edges[findPosition(cumulativeWeight)];
+}
+
+BaseGraph::Edge EdgeSampler::sampleExcluding(const BaseGraph::Edge& excludedEdge) const {
+    auto orderedEdge = getOrderedEdge(excludedEdge);
+    if (not contains(orderedEdge))
+        throw std::logic_error("EdgeSampler: Cannot exclude non-exising edge ("
+            + std::to_string(orderedEdge.first) + ", "
+            + std::to_string(orderedEdge.second) + ").");
+    if (m_totalWeight <= 1)
+        throw std::logic_error("EdgeSampler: Cannot sample from an empty sampler.");
+
+    size_t position = m_positions.get(orderedEdge);
+    double weightBefore = getWeightBefore(position);
+    double cumulativeWeight = std::uniform_real_distribution<double>(0, m_totalWeight - 1)(rng);
+    if (cumulativeWeight < weightBefore)
+        return m_edges[findPosition(cumulativeWeight)];
+    if (cumulativeWeight < weightBefore + m_weights[position] - 1)
+        return orderedEdge;
+    return m_edges[findPosition(cumulativeWeight + 1)];
+}
+
 void EdgeSampler::onEdgeRemoval(const BaseGraph::Edge& edge){
     auto orderedEdge = getOrderedEdge(edge);
     if (not contains(orderedEdge))
         throw std::logic_error("EdgeSampler: Cannot remove non-exising edge ("
             + std::to_string(orderedEdge.first) + ", "
             + std::to_string(orderedEdge.second) + ").");
-    double edgeWeight = round(m_edgeSampler.get_weight(orderedEdge));
-    if (edgeWeight == 1)
-        m_edgeSampler.erase(orderedEdge);
+    size_t position = m_positions.get(orderedEdge);
+    if (round(m_weights[position]) <= 1)
+        eraseEdge(orderedEdge);
     else
-        m_edgeSampler.set_weight(orderedEdge, edgeWeight-1);
+        addToWeight(position, -1);
 }
 
 void EdgeSampler::onEdgeAddition(const BaseGraph::Edge& edge){
     auto orderedEdge = getOrderedEdge(edge);
-
-    if (m_edgeSampler.count(orderedEdge) == 0)
-        m_edgeSampler.insert(orderedEdge, 1);
+    if (not contains(orderedEdge))
+        insertEdge(orderedEdge, 1);
     else
-        m_edgeSampler.set_weight(orderedEdge, round(m_edgeSampler.get_weight(orderedEdge))+1);
+        addToWeight(m_positions.get(orderedEdge), 1);
 }
 
-void EdgeSampler::onEdgeInsertion(const BaseGraph::Edge& edge, double edgeWeight=1){
+void EdgeSampler::onEdgeInsertion(const BaseGraph::Edge& edge, double edgeWeight){
     auto orderedEdge = getOrderedEdge(edge);
-    if (contains(orderedEdge))
-        m_edgeSampler.set_weight(orderedEdge, edgeWeight);
+    if (contains(orderedEdge)){
+        size_t position = m_positions.get(orderedEdge);
+        addToWeight(position, edgeWeight - m_weights[position]);
+    }
     else
-        m_edgeSampler.insert(orderedEdge, edgeWeight);
+        insertEdge(orderedEdge, edgeWeight);
 }
 
 double EdgeSampler::onEdgeErasure(const BaseGraph::Edge& edge){
@@ -39,8 +117,8 @@ double EdgeSampler::onEdgeErasure(const BaseGraph::Edge& edge){
         throw std::logic_error("EdgeSampler: Cannot erase non-exising edge ("
             + std::to_string(orderedEdge.first) + ", "
             + std::to_string(orderedEdge.second) + ").");
-    double edgeWeight = m_edgeSampler.get_weight(orderedEdge);
-    m_edgeSampler.erase(orderedEdge);
+    double edgeWeight = m_weights[m_positions.get(orderedEdge)];
+    eraseEdge(orderedEdge);
     return edgeWeight;
 }
 
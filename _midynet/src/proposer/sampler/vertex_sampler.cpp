@@ -4,6 +4,8 @@
 
 namespace FastMIDyNet{
 
+constexpr size_t VertexUniformSampler::NO_POSITION;
+
 BaseGraph::VertexIndex VertexDegreeSampler::sample() const {
     double prob = m_shift * m_vertexSampler.total_weight() / (
         m_shift * m_vertexSampler.total_weight() + m_totalEdgeWeight
@@ -60,32 +60,19 @@ const double DegreeCorrectedStochasticBlockModelFamily::getLogPrior() const {
 };
 
 const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioEdgeTerm (const GraphMove& move) const {
-    const BlockSequence& blockSeq = getLabels();
     const MultiGraph& edgeMat = m_edgeMatrixPriorPtr->getState();
     const CounterMap<size_t>& edgeCountsInBlocks = getEdgeLabelCounts();
-    const CounterMap<size_t>& vertexCountsInBlocks = getLabelCounts();
+    const MoveDiff<BlockIndex>& moveDiff = getMoveDiff(move);
     double logLikelihoodRatioTerm = 0;
 
-    IntMap<pair<BlockIndex, BlockIndex>> diffEdgeMatMap;
-    IntMap<BlockIndex> diffEdgeCountsInBlocksMap;
-
-    for (auto edge : move.addedEdges){
-        getDiffEdgeMatMapFromEdgeMove(edge, 1, diffEdgeMatMap);
-    }
-    for (auto edge : move.removedEdges){
-        getDiffEdgeMatMapFromEdgeMove(edge, -1, diffEdgeMatMap);
-    }
-
-    for (auto diff : diffEdgeMatMap){
+    for (const auto& diff : moveDiff.edgeMatrix){
         auto r = diff.first.first, s = diff.first.second;
         auto ers = edgeMat.getEdgeMultiplicityIdx(r, s);
-        diffEdgeCountsInBlocksMap.increment(r, diff.second);
-        diffEdgeCountsInBlocksMap.increment(s, diff.second);
         logLikelihoodRatioTerm += (r == s)? logDoubleFactorial(2 * ers + 2 * diff.second) : logFactorial(ers + diff.second);
         logLikelihoodRatioTerm -= (r == s)? logDoubleFactorial(2 * ers) : logFactorial(ers);
     }
 
-    for (auto diff : diffEdgeCountsInBlocksMap){
+    for (const auto& diff : moveDiff.edgeCounts){
         logLikelihoodRatioTerm -= logFactorial(edgeCountsInBlocks[diff.first] + diff.second) ;
         logLikelihoodRatioTerm -= -logFactorial(edgeCountsInBlocks[diff.first]);
     }
@@ -93,23 +80,10 @@ const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioEdg
 };
 
 const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioAdjTerm (const GraphMove& move) const {
-    IntMap<pair<VertexIndex, VertexIndex>> diffAdjMatMap;
-    IntMap<VertexIndex> diffDegreeMap;
+    const MoveDiff<BlockIndex>& moveDiff = getMoveDiff(move);
     double logLikelihoodRatioTerm = 0;
 
-
-    for (auto edge : move.addedEdges){
-        getDiffAdjMatMapFromEdgeMove(edge, 1, diffAdjMatMap);
-        diffDegreeMap.increment(edge.first);
-        diffDegreeMap.increment(edge.second);
-    }
-    for (auto edge : move.removedEdges){
-        getDiffAdjMatMapFromEdgeMove(edge, -1, diffAdjMatMap);
-        diffDegreeMap.decrement(edge.first);
-        diffDegreeMap.decrement(edge.second);
-    }
-
-    for (auto diff : diffAdjMatMap){
+    for (const auto& diff : moveDiff.adjacency){
         auto u = diff.first.first, v = diff.first.second;
         auto edgeMult = m_graph.getEdgeMultiplicityIdx(u, v);
         logLikelihoodRatioTerm -= (u == v) ? logDoubleFactorial(2 * (edgeMult + diff.second)) : logFactorial(edgeMult + diff.second);
@@ -117,7 +91,7 @@ const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioAdj
     }
 
     const DegreeSequence& degreeSeq = getDegrees();
-    for (auto diff : diffDegreeMap){
+    for (const auto& diff : moveDiff.degrees){
         logLikelihoodRatioTerm += logFactorial(degreeSeq[diff.first] + diff.second) - logFactorial(degreeSeq[diff.first]);
     }
     return logLikelihoodRatioTerm;
@@ -129,7 +103,6 @@ const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioFro
 }
 
 const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioFromLabelMove(const BlockMove& move) const {
-    const BlockSequence& blockSeq = getLabels();
     const MultiGraph& edgeMat = m_edgeMatrixPriorPtr->getState();
     const CounterMap<size_t>& edgesInBlock = getEdgeLabelCounts();
     double logLikelihoodRatio = 0;
@@ -137,22 +110,17 @@ const double DegreeCorrectedStochasticBlockModelFamily::getLogLikelihoodRatioFro
     if (move.prevLabel == move.nextLabel)
         return 0;
 
-    IntMap<pair<BlockIndex, BlockIndex>> diffEdgeMatMap;
-    IntMap<BlockIndex> diffEdgesInBlockMap;
-    getDiffEdgeMatMapFromBlockMove(move, diffEdgeMatMap);
-    for (auto diff : diffEdgeMatMap){
+    const MoveDiff<BlockIndex>& moveDiff = getMoveDiff(move);
+    for (const auto& diff : moveDiff.edgeMatrix){
         size_t ers;
         auto r = diff.first.first, s = diff.first.second;
         auto dErs = diff.second;
-        diffEdgesInBlockMap.increment(r, dErs);
-        diffEdgesInBlockMap.increment(s, dErs);
-
         ers = (r < edgeMat.getSize() and s < edgeMat.getSize()) ? edgeMat.getEdgeMultiplicityIdx(r, s) : 0;
         logLikelihoodRatio += (r == s) ? logDoubleFactorial(2 * ers + 2 * dErs) : logFactorial(ers + dErs);
         logLikelihoodRatio -= (r == s) ? logDoubleFactorial(2 * ers) : logFactorial(ers);
     }
 
-    for (auto diff : diffEdgesInBlockMap){
+    for (const auto& diff : moveDiff.edgeCounts){
             size_t er = 0;
             auto r = diff.first;
             auto dEr = diff.second;
@@ -212,3 +180,41 @@ void DegreeCorrectedStochasticBlockModelFamily::checkSelfSafety()const{
         throw SafetyError("StochasticBlockModelFamily: unsafe family since `m_degreePriorPtr` is empty.");
     m_degreePriorPtr->checkSafety();
 }
+
+void DegreeCompatibilityTracker::updateDegree(VertexIndex vertex, bool isAdded){
+    if (m_degrees[vertex] != m_expectedDegrees[vertex])
+        --m_degreeMismatchCount;
+    if (isAdded)
+        ++m_degrees[vertex];
+    else
+        --m_degrees[vertex];
+    if (m_degrees[vertex] != m_expectedDegrees[vertex])
+        ++m_degreeMismatchCount;
+}
+
+void DegreeCompatibilityTracker::setGraph(const MultiGraph& graph){
+    EdgeMatrixCompatibilityTracker::setGraph(graph);
+    if (not m_isSizeCompatible or m_expectedDegrees.size() != m_size){
+        m_isSizeCompatible = false;
+        return;
+    }
+    m_degrees = graph.getDegrees();
+    m_degreeMismatchCount = 0;
+    for (size_t vertex = 0; vertex < m_size; ++vertex)
+        if (m_degrees[vertex] != m_expectedDegrees[vertex])
+            ++m_degreeMismatchCount;
+}
+
+void DegreeCompatibilityTracker::applyGraphMove(const GraphMove& move){
+    EdgeMatrixCompatibilityTracker::applyGraphMove(move);
+    if (not m_isSizeCompatible)
+        return;
+    for (auto edge : move.removedEdges){
+        updateDegree(edge.first, false);
+        updateDegree(edge.second, false);
+    }
+    for (auto edge : move.addedEdges){
+        updateDegree(edge.first, true);
+        updateDegree(edge.second, true);
+    }
+}
@@ -55,61 +55,29 @@ const double StochasticBlockModelFamily::getLogPrior() const {
     return logPrior;
 };
 
-void StochasticBlockModelFamily::getDiffEdgeMatMapFromEdgeMove( const Edge& edge, int counter, IntMap<pair<BlockIndex, BlockIndex>>& diffEdgeMatMap ) const{
-    const BlockSequence& blockSeq = getLabels();
-    diffEdgeMatMap.increment(
-        getOrderedPair<BlockIndex>({blockSeq[edge.first], blockSeq[edge.second]}),
-        counter
-    );
-};
-
 const double StochasticBlockModelFamily::getLogLikelihoodRatioEdgeTerm (const GraphMove& move) const {
-    const BlockSequence& blockSeq = getLabels();
     const MultiGraph& edgeMat = m_edgeMatrixPriorPtr->getState();
-    const CounterMap<size_t>& edgeCounts = getEdgeLabelCounts();
     const CounterMap<size_t>& vertexCounts = getLabelCounts();
+    const MoveDiff<BlockIndex>& moveDiff = getMoveDiff(move);
     double logLikelihoodRatioTerm = 0;
 
-    IntMap<pair<BlockIndex, BlockIndex>> diffEdgeMatMap;
-    IntMap<BlockIndex> diffEdgeCountsMap;
-
-    for (auto edge : move.addedEdges)
-        getDiffEdgeMatMapFromEdgeMove(edge, 1, diffEdgeMatMap);
-    for (auto edge : move.removedEdges)
-        getDiffEdgeMatMapFromEdgeMove(edge, -1, diffEdgeMatMap);
-
-    for (auto diff : diffEdgeMatMap){
+    for (const auto& diff : moveDiff.edgeMatrix){
         auto r = diff.first.first, s = diff.first.second;
         size_t ers = (r >= edgeMat.getSize() or s >= edgeMat.getSize()) ? 0 : edgeMat.getEdgeMultiplicityIdx(r, s);
-        diffEdgeCountsMap.increment(r, diff.second);
-        diffEdgeCountsMap.increment(s, diff.second);
         logLikelihoodRatioTerm += (r == s) ? logDoubleFactorial(2 * ers + 2 * diff.second) : logFactorial(ers + diff.second);
         logLikelihoodRatioTerm -= (r == s) ? logDoubleFactorial(2 * ers) : logFactorial(ers);
     }
 
-    for (auto diff : diffEdgeCountsMap){
+    for (const auto& diff : moveDiff.edgeCounts){
             logLikelihoodRatioTerm -= diff.second * log( vertexCounts[diff.first] ) ;
     }
     return logLikelihoodRatioTerm;
 };
 
-void StochasticBlockModelFamily::getDiffAdjMatMapFromEdgeMove(
-    const Edge& edge, int counter, IntMap<pair<VertexIndex, VertexIndex>>& diffAdjMatMap
-) const{
-    Edge orderedEdge = getOrderedEdge(edge);
-    diffAdjMatMap.increment({orderedEdge.first, orderedEdge.second}, counter);
-};
-
 const double StochasticBlockModelFamily::getLogLikelihoodRatioAdjTerm (const GraphMove& move) const {
-    IntMap<pair<VertexIndex, VertexIndex>> diffAdjMatMap;
     double logLikelihoodRatioTerm = 0;
 
-    for (auto edge : move.addedEdges)
-        getDiffAdjMatMapFromEdgeMove(edge, 1, diffAdjMatMap);
-    for (auto edge : move.removedEdges)
-        getDiffAdjMatMapFromEdgeMove(edge, -1, diffAdjMatMap);
-
-    for (auto diff : diffAdjMatMap){
+    for (const auto& diff : getMoveDiff(move).adjacency){
         auto u = diff.first.first, v = diff.first.second;
         auto edgeMult = m_graph.getEdgeMultiplicityIdx(u, v);
         logLikelihoodRatioTerm -= (u == v) ? logDoubleFactorial(2 * edgeMult + 2 * diff.second) : logFactorial(edgeMult + diff.second);
@@ -122,26 +90,7 @@ const double StochasticBlockModelFamily::getLogLikelihoodRatioFromGraphMove (con
     return getLogLikelihoodRatioEdgeTerm(move) + getLogLikelihoodRatioAdjTerm(move);
 }
 
-void StochasticBlockModelFamily::getDiffEdgeMatMapFromBlockMove(
-    const BlockMove& move, IntMap<pair<BlockIndex, BlockIndex>>& diffEdgeMatMap
-) const {
-    const BlockSequence& blockSeq = getLabels();
-    for (auto neighbor : m_graph.getNeighboursOfIdx(move.vertexIndex)){
-        BlockIndex blockIdx = blockSeq[neighbor.vertexIndex];
-        size_t edgeMult = neighbor.label;
-        pair<BlockIndex, BlockIndex> orderedBlockPair = getOrderedPair<BlockIndex> ({move.prevLabel, blockIdx});
-        diffEdgeMatMap.decrement(orderedBlockPair, neighbor.label);
-
-        if (neighbor.vertexIndex == move.vertexIndex) // handling self-loops
-            blockIdx = move.nextLabel;
-
-        orderedBlockPair = getOrderedPair<BlockIndex> ({move.nextLabel, blockIdx});
-        diffEdgeMatMap.increment(orderedBlockPair, neighbor.label);
-    }
-};
-
 const double StochasticBlockModelFamily::getLogLikelihoodRatioFromLabelMove(const BlockMove& move) const {
-    const BlockSequence& blockSeq = getLabels();
     const MultiGraph& edgeMat = m_edgeMatrixPriorPtr->getState();
     const CounterMap<size_t>& edgeCounts = getEdgeLabelCounts();
     const CounterMap<size_t>& vertexCounts = getLabelCounts();
@@ -151,11 +100,7 @@ const double StochasticBlockModelFamily::getLogLikelihoodRatioFromLabelMove(cons
     if (move.prevLabel == move.nextLabel)
         return 0;
 
-    IntMap<pair<BlockIndex, BlockIndex>> diffEdgeMatMap;
-
-    getDiffEdgeMatMapFromBlockMove(move, diffEdgeMatMap);
-
-    for (auto diff : diffEdgeMatMap){
+    for (const auto& diff : getMoveDiff(move).edgeMatrix){
         auto r = diff.first.first, s = diff.first.second;
         size_t ers = (r >= edgeMat.getSize() or s >= edgeMat.getSize()) ? 0 : edgeMat.getEdgeMultiplicityIdx(r, s);
         logLikelihoodRatio += (r == s) ? logDoubleFactorial(2 * ers + 2 * diff.second) : logFactorial(ers + diff.second);
@@ -240,3 +185,55 @@ void StochasticBlockModelFamily::checkSelfSafety()const{
         throw SafetyError("StochasticBlockModelFamily: unsafe family since `m_edgeMatrixPriorPtr` is empty.");
     m_edgeMatrixPriorPtr->checkSafety();
 }
+
+EdgeMatrixCompatibilityTracker::EdgeMatrixCompatibilityTracker(size_t size, const BlockSequence& labels, const MultiGraph& expectedEdgeMatrix):
+    m_size(size), m_labels(labels){
+    if (not m_labels.empty())
+        m_blockCount = *max_element(m_labels.begin(), m_labels.end()) + 1;
+    // the edge matrix of a graph has one row per block up to the largest label
+    m_isBlockCountCompatible = m_blockCount == expectedEdgeMatrix.getSize();
+    m_edgeMatrix.resize(m_blockCount * m_blockCount, 0);
+    m_expectedEdgeMatrix.resize(m_blockCount * m_blockCount, 0);
+    if (not m_isBlockCountCompatible)
+        return;
+    for (BlockIndex r = 0; r < m_blockCount; ++r)
+        for (BlockIndex s = r; s < m_blockCount; ++s)
+            m_expectedEdgeMatrix[getEntryIdx(r, s)] = expectedEdgeMatrix.getEdgeMultiplicityIdx(r, s);
+}
+
+void EdgeMatrixCompatibilityTracker::updateEntry(const BaseGraph::Edge& edge, bool isAdded){
+    size_t idx = getEntryIdx(m_labels[edge.first], m_labels[edge.second]);
+    if (m_edgeMatrix[idx] != m_expectedEdgeMatrix[idx])
+        --m_mismatchCount;
+    if (isAdded)
+        ++m_edgeMatrix[idx];
+    else
+        --m_edgeMatrix[idx];
+    if (m_edgeMatrix[idx] != m_expectedEdgeMatrix[idx])
+        ++m_mismatchCount;
+}
+
+void EdgeMatrixCompatibilityTracker::setGraph(const MultiGraph& graph){
+    m_isSizeCompatible = graph.getSize() == m_size and m_labels.size() == m_size;
+    if (not m_isSizeCompatible)
+        return;
+    fill(m_edgeMatrix.begin(), m_edgeMatrix.end(), 0);
+    for (auto idx : graph)
+        for (auto neighbor : graph.getNeighboursOfIdx(idx))
+            if (idx <= neighbor.vertexIndex)
+                m_edgeMatrix[getEntryIdx(m_labels[idx], m_labels[neighbor.vertexIndex])] += neighbor.label;
+    m_mismatchCount = 0;
+    for (BlockIndex r = 0; r < m_blockCount; ++r)
+        for (BlockIndex s = r; s < m_blockCount; ++s)
+            if (m_edgeMatrix[getEntryIdx(r, s)] != m_expectedEdgeMatrix[getEntryIdx(r, s)])
+                ++m_mismatchCount;
+}
+
+void EdgeMatrixCompatibilityTracker::applyGraphMove(const GraphMove& move){
+    if (not m_isSizeCompatible)
+        return;
+    for (auto edge : move.removedEdges)
+        updateEntry(edge, false);
+    for (auto edge : move.addedEdges)
+        updateEntry(edge, true);
+}
@@ -8,8 +8,8 @@
 
 namespace FastMIDyNet {
 
-RNG rng;
-size_t SEED=0;
+thread_local RNG rng;
+thread_local size_t SEED=0;
 void seed(size_t seed){ SEED=seed; rng.seed(seed); std::srand(seed); }
 void seedWithTime(){
     seed(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "FastMIDyNet/utility/edge_marginals.h"
+
+
+namespace FastMIDyNet{
+
+const size_t EdgeMarginalAccumulator::HISTOGRAM_WIDTH;
+constexpr size_t EdgeMarginalAccumulator::EMPTY_SLOT;
+constexpr size_t EdgeMarginalAccumulator::NO_OVERFLOW;
+
+EdgeMarginalAccumulator::EdgeMarginalAccumulator(size_t capacity){
+    size_t tableSize = 2;
+    while (tableSize < 2 * capacity)
+        tableSize *= 2;
+    m_slots.assign(tableSize, EMPTY_SLOT);
+    m_histograms.reserve(capacity);
+}
+
+size_t EdgeMarginalAccumulator::hashEdge(const BaseGraph::Edge& edge){
+    size_t x = (static_cast<size_t>(edge.first) << 32) ^ static_cast<size_t>(edge.second);
+    x ^= x >> 31;
+    x *= 0x7fb5d329728ea185ULL;
+    x ^= x >> 27;
+    return x;
+}
+
+size_t EdgeMarginalAccumulator::findSlot(const BaseGraph::Edge& edge) const {
+    const size_t mask = m_slots.size() - 1;
+    size_t slot = hashEdge(edge) & mask;
+    while (m_slots[slot] != EMPTY_SLOT and m_histograms[m_slots[slot]].edge != edge)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+const EdgeMarginalAccumulator::EdgeHistogram* EdgeMarginalAccumulator::find(const BaseGraph::Edge& edge) const {
+    size_t histogramIdx = m_slots[findSlot(edge)];
+    return (histogramIdx == EMPTY_SLOT) ? nullptr : &m_histograms[histogramIdx];
+}
+
+EdgeMarginalAccumulator::EdgeHistogram& EdgeMarginalAccumulator::findOrInsert(const BaseGraph::Edge& edge){
+    size_t slot = findSlot(edge);
+    if (m_slots[slot] != EMPTY_SLOT)
+        return m_histograms[m_slots[slot]];
+    m_slots[slot] = m_histograms.size();
+    m_histograms.push_back(EdgeHistogram());
+    m_histograms.back().edge = edge;
+    if (2 * m_histograms.size() > m_slots.size())
+        rehash(2 * m_slots.size());
+    return m_histograms.back();
+}
+
+void EdgeMarginalAccumulator::rehash(size_t tableSize){
+    m_slots.assign(tableSize, EMPTY_SLOT);
+    for (size_t histogramIdx = 0; histogramIdx < m_histograms.size(); ++histogramIdx)
+        m_slots[findSlot(m_histograms[histogramIdx].edge)] = histogramIdx;
+}
+
+double& EdgeMarginalAccumulator::getStoredWeight(EdgeHistogram& histogram, size_t multiplicity){
+    if (multiplicity <= HISTOGRAM_WIDTH)
+        return histogram.weights[multiplicity - 1];
+    if (histogram.overflowIdx == NO_OVERFLOW){
+        histogram.overflowIdx = m_overflowWeights.size();
+        m_overflowWeights.push_back({});
+    }
+    auto& weights = m_overflowWeights[histogram.overflowIdx];
+    if (weights.size() < multiplicity - HISTOGRAM_WIDTH)
+        weights.resize(multiplicity - HISTOGRAM_WIDTH, 0);
+    return weights[multiplicity - HISTOGRAM_WIDTH - 1];
+}
+
+void EdgeMarginalAccumulator::setMultiplicity(const BaseGraph::Edge& edge, size_t multiplicity){
+    if (multiplicity == 0 and find(edge) == nullptr)
+        return;
+    EdgeHistogram& histogram = findOrInsert(edge);
+    if (histogram.multiplicity == multiplicity)
+        return;
+    if (histogram.multiplicity > 0)
+        getStoredWeight(histogram, histogram.multiplicity) += m_time - histogram.since;
+    m_totalMultiplicity += multiplicity;
+    m_totalMultiplicity -= histogram.multiplicity;
+    histogram.multiplicity = multiplicity;
+    histogram.since = m_time;
+}
+
+void EdgeMarginalAccumulator::addMultiplicity(const BaseGraph::Edge& edge, int delta){
+    int multiplicity = static_cast<int>(getMultiplicity(edge)) + delta;
+    if (multiplicity < 0)
+        throw std::logic_error("EdgeMarginalAccumulator: the multiplicity of edge ("
+            + std::to_string(edge.first) + ", " + std::to_string(edge.second) + ") cannot be negative.");
+    setMultiplicity(edge, multiplicity);
+}
+
+void EdgeMarginalAccumulator::setGraph(const MultiGraph& graph){
+    for (size_t histogramIdx = 0; histogramIdx < m_histograms.size(); ++histogramIdx){
+        const auto& edge = m_histograms[histogramIdx].edge;
+        bool isInGraph = edge.second < graph.getSize();
+        setMultiplicity(edge, isInGraph ? graph.getEdgeMultiplicityIdx(edge) : 0);
+    }
+    for (auto vertex: graph)
+        for (auto neighbor: graph.getNeighboursOfIdx(vertex))
+            if (vertex <= neighbor.vertexIndex)
+                setMultiplicity({vertex, neighbor.vertexIndex}, neighbor.label);
+}
+
+void EdgeMarginalAccumulator::clear(){
+    std::fill(m_slots.begin(), m_slots.end(), EMPTY_SLOT);
+    m_histograms.clear();
+    m_overflowWeights.clear();
+    m_time = 0;
+    m_totalMultiplicity = 0;
+}
+
+const size_t EdgeMarginalAccumulator::getMultiplicity(const BaseGraph::Edge& edge) const {
+    const EdgeHistogram* histogram = find(edge);
+    return (histogram == nullptr) ? 0 : histogram->multiplicity;
+}
+
+const double EdgeMarginalAccumulator::getWeight(const EdgeHistogram& histogram, size_t multiplicity) const {
+    if (multiplicity == 0)
+        return m_time - getObservedWeight(histogram);
+    double weight = (multiplicity == histogram.multiplicity) ? m_time - histogram.since : 0;
+    if (multiplicity <= HISTOGRAM_WIDTH)
+        return weight + histogram.weights[multiplicity - 1];
+    if (histogram.overflowIdx != NO_OVERFLOW){
+        const auto& weights = m_overflowWeights[histogram.overflowIdx];
+        if (multiplicity - HISTOGRAM_WIDTH <= weights.size())
+            weight += weights[multiplicity - HISTOGRAM_WIDTH - 1];
+    }
+    return weight;
+}
+
+const double EdgeMarginalAccumulator::getObservedWeight(const EdgeHistogram& histogram) const {
+    double weight = (histogram.multiplicity > 0) ? m_time - histogram.since : 0;
+    for (size_t i = 0; i < HISTOGRAM_WIDTH; ++i)
+        weight += histogram.weights[i];
+    if (histogram.overflowIdx != NO_OVERFLOW)
+        for (auto w: m_overflowWeights[histogram.overflowIdx])
+            weight += w;
+    return weight;
+}
+
+const size_t EdgeMarginalAccumulator::getMaxObservedMultiplicity(const EdgeHistogram& histogram) const {
+    size_t maxMultiplicity = HISTOGRAM_WIDTH;
+    if (histogram.overflowIdx != NO_OVERFLOW)
+        maxMultiplicity += m_overflowWeights[histogram.overflowIdx].size();
+    maxMultiplicity = std::max(maxMultiplicity, histogram.multiplicity);
+    while (maxMultiplicity > 0 and getWeight(histogram, maxMultiplicity) <= 0)
+        --maxMultiplicity;
+    return maxMultiplicity;
+}
+
+const double EdgeMarginalAccumulator::getWeight(const BaseGraph::Edge& edge, size_t multiplicity) const {
+    const EdgeHistogram* histogram = find(edge);
+    if (histogram == nullptr)
+        return (multiplicity == 0) ? m_time : 0;
+    return getWeight(*histogram, multiplicity);
+}
+
+const bool EdgeMarginalAccumulator::isObserved(const BaseGraph::Edge& edge) const {
+    const EdgeHistogram* histogram = find(edge);
+    return histogram != nullptr and getObservedWeight(*histogram) > 0;
+}
+
+const size_t EdgeMarginalAccumulator::getMaxObservedMultiplicity(const BaseGraph::Edge& edge) const {
+    const EdgeHistogram* histogram = find(edge);
+    return (histogram == nullptr) ? 0 : getMaxObservedMultiplicity(*histogram);
+}
+
+const size_t EdgeMarginalAccumulator::getMaxObservedMultiplicity() const {
+    size_t maxMultiplicity = 0;
+    for (const auto& histogram: m_histograms)
+        maxMultiplicity = std::max(maxMultiplicity, getMaxObservedMultiplicity(histogram));
+    return maxMultiplicity;
+}
+
+const std::vector<BaseGraph::Edge> EdgeMarginalAccumulator::getObservedEdges() const {
+    std::vector<BaseGraph::Edge> edges;
+    for (const auto& histogram: m_histograms)
+        if (getObservedWeight(histogram) > 0)
+            edges.push_back(histogram.edge);
+    return edges;
+}
+
+void EdgeMarginalAccumulator::getProbs(double* probs, size_t columnCount) const {
+    for (const auto& histogram: m_histograms){
+        if (getObservedWeight(histogram) <= 0)
+            continue;
+        for (size_t multiplicity = 0; multiplicity < columnCount; ++multiplicity)
+            probs[multiplicity] = getWeight(histogram, multiplicity) / m_time;
+        probs += columnCount;
+    }
+}
+
+const double EdgeMarginalAccumulator::getEntropy() const {
+    double entropy = 0;
+    for (const auto& histogram: m_histograms){
+        if (getObservedWeight(histogram) <= 0)
+            continue;
+        size_t maxMultiplicity = getMaxObservedMultiplicity(histogram);
+        for (size_t multiplicity = 0; multiplicity <= maxMultiplicity; ++multiplicity){
+            double p = getWeight(histogram, multiplicity) / m_time;
+            if (p > 0)
+                entropy -= p * log(p);
+        }
+    }
+    return entropy;
+}
+
+const double EdgeMarginalAccumulator::getLogProb(const MultiGraph& graph) const {
+    double logProb = 0;
+    for (const auto& histogram: m_histograms){
+        if (getObservedWeight(histogram) <= 0)
+            continue;
+        const auto& edge = histogram.edge;
+        size_t multiplicity = (edge.second < graph.getSize()) ? graph.getEdgeMultiplicityIdx(edge) : 0;
+        logProb += log(getWeight(histogram, multiplicity) / m_time);
+    }
+    return logProb;
+}
+
+}
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "FastMIDyNet/utility/graph_enumeration.h"
+
+
+namespace FastMIDyNet{
+
+size_t getBinomialCoefficient(size_t n, size_t k){
+    if (k > n)
+        return 0;
+    k = std::min(k, n - k);
+    // binomial * (n - k + i) is divisible by i, so i / gcd(binomial, i) divides n - k + i
+    size_t binomial = 1;
+    for (size_t i = 1; i <= k; ++i){
+        size_t a = binomial, b = i;
+        while (b != 0){
+            size_t remainder = a % b;
+            a = b;
+            b = remainder;
+        }
+        size_t factor = (n - k + i) / (i / a);
+        binomial /= a;
+        if (binomial > std::numeric_limits<size_t>::max() / factor)
+            throw std::overflow_error("getBinomialCoefficient: C(" + std::to_string(n) + ", "
+                + std::to_string(k) + ") overflows.");
+        binomial *= factor;
+    }
+    return binomial;
+}
+
+/* Compositions of `total` over `slotCount` slots are visited by increasing
+ * multiplicity v of the last slot, the other slots being visited recursively
+ * forward when v is even and backward when it is odd. The forward path goes
+ * from (total, 0, ..., 0) to (0, ..., 0, total), so every transition between
+ * two values of v moves one unit between the first or the penultimate slot and
+ * the last one. */
+CompositionGrayCode::CompositionGrayCode(size_t total, size_t slotCount, size_t rank):
+    m_total(total){
+    if (slotCount == 0)
+        throw std::logic_error("CompositionGrayCode: `slotCount` must be positive.");
+    m_state.resize(slotCount, 0);
+    if (rank >= getStateCount())
+        throw std::logic_error("CompositionGrayCode: rank " + std::to_string(rank)
+            + " is out of range, there are " + std::to_string(getStateCount()) + " compositions.");
+    unrank(slotCount, true, total, rank);
+    m_rank = rank;
+}
+
+void CompositionGrayCode::unrank(size_t slotCount, bool forward, size_t total, size_t rank){
+    if (slotCount == 1){
+        m_state[0] = total;
+        return;
+    }
+    for (size_t i = 0; i <= total; ++i){
+        size_t lastMultiplicity = forward ? i : total - i;
+        size_t blockSize = getBinomialCoefficient(total - lastMultiplicity + slotCount - 2, slotCount - 2);
+        if (rank < blockSize){
+            m_state[slotCount - 1] = lastMultiplicity;
+            unrank(slotCount - 1, forward xor (lastMultiplicity % 2 == 1), total - lastMultiplicity, rank);
+            return;
+        }
+        rank -= blockSize;
+    }
+}
+
+bool CompositionGrayCode::step(size_t slotCount, bool forward, size_t total, size_t& decrementedSlot, size_t& incrementedSlot){
+    if (slotCount == 1)
+        return false;
+    size_t& lastMultiplicity = m_state[slotCount - 1];
+    bool innerForward = forward xor (lastMultiplicity % 2 == 1);
+    if (step(slotCount - 1, innerForward, total - lastMultiplicity, decrementedSlot, incrementedSlot))
+        return true;
+
+    // the other slots are at the end of their path, all their units are in one slot
+    size_t innerSlot = innerForward ? slotCount - 2 : 0;
+    if (forward and lastMultiplicity < total){
+        decrementedSlot = innerSlot;
+        incrementedSlot = slotCount - 1;
+    }
+    else if (not forward and lastMultiplicity > 0){
+        decrementedSlot = slotCount - 1;
+        incrementedSlot = innerSlot;
+    }
+    else
+        return false;
+    --m_state[decrementedSlot];
+    ++m_state[incrementedSlot];
+    return true;
+}
+
+bool CompositionGrayCode::next(size_t& decrementedSlot, size_t& incrementedSlot){
+    if (not step(m_state.size(), true, m_total, decrementedSlot, incrementedSlot))
+        return false;
+    ++m_rank;
+    return true;
+}
+
+/* The revolving door sequence of the combinations of t out of n elements is the
+ * sequence for (n-1, t) followed by the reversed sequence for (n-1, t-1) to
+ * which element n-1 is added. */
+CombinationGrayCode::CombinationGrayCode(size_t total, size_t slotCount, size_t rank):
+    m_total(total){
+    if (total > slotCount)
+        throw std::logic_error("CombinationGrayCode: cannot choose " + std::to_string(total)
+            + " slots out of " + std::to_string(slotCount) + ".");
+    m_state.resize(slotCount, 0);
+    if (rank >= getStateCount())
+        throw std::logic_error("CombinationGrayCode: rank " + std::to_string(rank)
+            + " is out of range, there are " + std::to_string(getStateCount()) + " combinations.");
+    m_rank = rank;
+
+    size_t n = slotCount, t = total;
+    while (t > 0 and t < n){
+        size_t firstBlockSize = getBinomialCoefficient(n - 1, t);
+        if (rank >= firstBlockSize){
+            m_state[n - 1] = 1;
+            rank = getBinomialCoefficient(n - 1, t - 1) - 1 - (rank - firstBlockSize);
+            --t;
+        }
+        --n;
+    }
+    for (size_t i = 0; i < t; ++i)
+        m_state[i] = 1;
+
+    // 1-indexed combination with the sentinel c[t+1] = n, as in algorithm R
+    m_combination.push_back(0);
+    for (size_t i = 0; i < slotCount; ++i)
+        if (m_state[i] == 1)
+            m_combination.push_back(i);
+    m_combination.push_back(slotCount);
+}
+
+void CombinationGrayCode::replace(size_t removed, size_t added, size_t& decrementedSlot, size_t& incrementedSlot){
+    m_state[removed] = 0;
+    m_state[added] = 1;
+    decrementedSlot = removed;
+    incrementedSlot = added;
+    ++m_rank;
+}
+
+bool CombinationGrayCode::next(size_t& decrementedSlot, size_t& incrementedSlot){
+    const size_t t = m_total;
+    std::vector<size_t>& c = m_combination;
+    if (t == 0 or t == m_state.size())
+        return false;
+
+    bool increase;
+    if (t % 2 == 1){
+        if (c[1] + 1 < c[2]){
+            replace(c[1], c[1] + 1, decrementedSlot, incrementedSlot);
+            ++c[1];
+            return true;
+        }
+        increase = false;
+    }
+    else{
+        if (c[1] > 0){
+            replace(c[1], c[1] - 1, decrementedSlot, incrementedSlot);
+            --c[1];
+            return true;
+        }
+        increase = true;
+    }
+
+    for (size_t j = 2; j <= t; ++j){
+        if (not increase){
+            // here c[j] = c[j-1] + 1, try to decrease c[j]
+            if (c[j] >= j){
+                replace(c[j], j - 2, decrementedSlot, incrementedSlot);
+                c[j] = c[j - 1];
+                c[j - 1] = j - 2;
+                return true;
+            }
+        }
+        else{
+            // here c[j-1] = j - 2, try to increase c[j]
+            if (c[j] + 1 < c[j + 1]){
+                replace(j - 2, c[j] + 1, decrementedSlot, incrementedSlot);
+                c[j - 1] = c[j];
+                ++c[j];
+                return true;
+            }
+        }
+        increase = not increase;
+    }
+    return false;
+}
+
+GraphEnumerator::GraphEnumerator(size_t size, size_t edgeCount, bool allowSelfLoops, bool allowMultiEdges, size_t firstRank, size_t lastRank):
+    m_size(size){
+    for (BaseGraph::VertexIndex i = 0; i < size; ++i)
+        for (BaseGraph::VertexIndex j = (allowSelfLoops ? i : i + 1); j < size; ++j)
+            m_edges.push_back({i, j});
+    if (m_edges.size() == 0)
+        throw std::logic_error("GraphEnumerator: there is no edge to enumerate on " + std::to_string(size) + " vertices.");
+
+    if (allowMultiEdges)
+        m_grayCode = new CompositionGrayCode(edgeCount, m_edges.size(), firstRank);
+    else
+        m_grayCode = new CombinationGrayCode(edgeCount, m_edges.size(), firstRank);
+    m_lastRank = std::min(lastRank, getGraphCount());
+}
+
+size_t GraphEnumerator::getGraphCount(size_t size, size_t edgeCount, bool allowSelfLoops, bool allowMultiEdges){
+    size_t edgeSlotCount = (allowSelfLoops) ? size * (size + 1) / 2 : size * (size - 1) / 2;
+    if (allowMultiEdges)
+        return getBinomialCoefficient(edgeCount + edgeSlotCount - 1, edgeCount);
+    return getBinomialCoefficient(edgeSlotCount, edgeCount);
+}
+
+MultiGraph GraphEnumerator::getGraph() const {
+    MultiGraph graph(m_size);
+    const auto& multiplicities = getEdgeMultiplicities();
+    for (size_t i = 0; i < m_edges.size(); ++i)
+        if (multiplicities[i] > 0)
+            graph.addMultiedgeIdx(m_edges[i].first, m_edges[i].second, multiplicities[i]);
+    return graph;
+}
+
+bool GraphEnumerator::next(GraphMove& move){
+    if (m_grayCode->getRank() + 1 >= m_lastRank)
+        return false;
+    size_t removedSlot, addedSlot;
+    if (not m_grayCode->next(removedSlot, addedSlot))
+        return false;
+    move.removedEdges.assign(1, m_edges[removedSlot]);
+    move.addedEdges.assign(1, m_edges[addedSlot]);
+    return true;
+}
+
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "FastMIDyNet/utility/graph_snapshot.h"
+
+
+namespace FastMIDyNet{
+
+static void writeVarint(uint64_t value, std::vector<uint8_t>& bytes){
+    while (value >= 0x80){
+        bytes.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back((uint8_t) value);
+}
+
+static uint64_t readVarint(const std::vector<uint8_t>& bytes, size_t& position){
+    uint64_t value = 0;
+    for (size_t shift = 0; position < bytes.size(); shift += 7){
+        uint8_t byte = bytes[position++];
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+    throw std::logic_error("GraphSnapshot: truncated varint.");
+}
+
+static uint64_t zigzagEncode(int64_t value){ return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63); }
+static int64_t zigzagDecode(uint64_t value){ return (int64_t) (value >> 1) ^ -(int64_t) (value & 1); }
+
+
+GraphSnapshot::GraphSnapshot(const MultiGraph& graph):
+    m_size(graph.getSize()),
+    m_edgeCount(graph.getTotalEdgeNumber()),
+    m_bytes(encode(graph.getSize(), getEdgeMultiplicities(graph))) { }
+
+MultiGraph GraphSnapshot::getGraph() const {
+    size_t size;
+    MultiGraph graph(m_size);
+    for (const auto& edge: decode(m_bytes, size))
+        graph.addMultiedgeIdx(edge.first.first, edge.first.second, edge.second);
+    return graph;
+}
+
+EdgeMultiplicityList GraphSnapshot::getEdgeMultiplicities(const MultiGraph& graph){
+    EdgeMultiplicityList edges;
+    for (auto vertex: graph){
+        size_t rowBegin = edges.size();
+        for (const auto& neighbor: graph.getNeighboursOfIdx(vertex))
+            if (neighbor.vertexIndex >= vertex)
+                edges.push_back({{vertex, neighbor.vertexIndex}, neighbor.label});
+        std::sort(edges.begin() + rowBegin, edges.end());
+    }
+    return edges;
+}
+
+std::vector<uint8_t> GraphSnapshot::encode(size_t size, const EdgeMultiplicityList& edges){
+    std::vector<uint8_t> bytes;
+    writeVarint(size, bytes);
+    auto edge = edges.begin();
+    for (BaseGraph::VertexIndex vertex = 0; vertex < size; ++vertex){
+        auto rowEnd = edge;
+        while (rowEnd != edges.end() and rowEnd->first.first == vertex)
+            ++rowEnd;
+        writeVarint(rowEnd - edge, bytes);
+        BaseGraph::VertexIndex previous = vertex;
+        for (; edge != rowEnd; ++edge){
+            writeVarint(edge->first.second - previous, bytes);
+            writeVarint(edge->second, bytes);
+            previous = edge->first.second;
+        }
+    }
+    return bytes;
+}
+
+EdgeMultiplicityList GraphSnapshot::decode(const std::vector<uint8_t>& bytes, size_t& size){
+    EdgeMultiplicityList edges;
+    size_t position = 0;
+    size = readVarint(bytes, position);
+    for (BaseGraph::VertexIndex vertex = 0; vertex < size; ++vertex){
+        size_t rowLength = readVarint(bytes, position);
+        BaseGraph::VertexIndex neighbor = vertex;
+        for (size_t i = 0; i < rowLength; ++i){
+            neighbor += readVarint(bytes, position);
+            edges.push_back({{vertex, neighbor}, readVarint(bytes, position)});
+        }
+    }
+    return edges;
+}
+
+
+GraphSnapshotSequence::GraphSnapshotSequence(size_t keyframePeriod):
+    m_keyframePeriod(keyframePeriod){
+    if (keyframePeriod == 0)
+        throw std::logic_error("GraphSnapshotSequence: `keyframePeriod` must be positive.");
+}
+
+void GraphSnapshotSequence::push(const MultiGraph& graph){
+    if (m_frames.size() == 0)
+        m_graphSize = graph.getSize();
+    else if (graph.getSize() != m_graphSize)
+        throw std::logic_error("GraphSnapshotSequence: cannot push a graph of size "
+            + std::to_string(graph.getSize()) + " in a sequence of graphs of size "
+            + std::to_string(m_graphSize) + ".");
+
+    EdgeMultiplicityList edges = GraphSnapshot::getEdgeMultiplicities(graph);
+    if (isKeyframe(m_frames.size()))
+        m_frames.push_back(GraphSnapshot::encode(m_graphSize, edges));
+    else
+        m_frames.push_back(encodeDiff(m_lastEdges, edges));
+    m_lastEdges = std::move(edges);
+}
+
+MultiGraph GraphSnapshotSequence::getGraph(size_t index) const {
+    if (index >= size())
+        throw std::logic_error("GraphSnapshotSequence: index " + std::to_string(index)
+            + " is out of range for a sequence of " + std::to_string(size()) + " graphs.");
+    size_t keyframe = index - index % m_keyframePeriod, graphSize;
+    EdgeMultiplicityList edges = GraphSnapshot::decode(m_frames[keyframe], graphSize);
+    for (size_t i = keyframe + 1; i <= index; ++i)
+        applyDiff(m_frames[i], edges);
+    return buildGraph(edges);
+}
+
+std::vector<MultiGraph> GraphSnapshotSequence::getGraphs() const {
+    std::vector<MultiGraph> graphs;
+    graphs.reserve(size());
+    EdgeMultiplicityList edges;
+    size_t graphSize;
+    for (size_t i = 0; i < size(); ++i){
+        if (isKeyframe(i))
+            edges = GraphSnapshot::decode(m_frames[i], graphSize);
+        else
+            applyDiff(m_frames[i], edges);
+        graphs.push_back(buildGraph(edges));
+    }
+    return graphs;
+}
+
+const size_t GraphSnapshotSequence::getByteCount() const {
+    size_t byteCount = 0;
+    for (const auto& frame: m_frames)
+        byteCount += frame.size();
+    return byteCount;
+}
+
+/* A diff lists the edges whose multiplicity changed, by increasing index
+ * v * size + u, as the gap from the previous index and the zigzag-encoded change. */
+std::vector<uint8_t> GraphSnapshotSequence::encodeDiff(const EdgeMultiplicityList& prevEdges, const EdgeMultiplicityList& nextEdges) const {
+    std::vector<std::pair<uint64_t, int64_t>> changes;
+    auto getIndex = [&](const BaseGraph::Edge& edge){ return (uint64_t) edge.first * m_graphSize + edge.second; };
+    auto prev = prevEdges.begin(), next = nextEdges.begin();
+    while (prev != prevEdges.end() or next != nextEdges.end()){
+        if (next == nextEdges.end() or (prev != prevEdges.end() and prev->first < next->first)){
+            changes.push_back({getIndex(prev->first), -(int64_t) prev->second});
+            ++prev;
+        }
+        else if (prev == prevEdges.end() or next->first < prev->first){
+            changes.push_back({getIndex(next->first), (int64_t) next->second});
+            ++next;
+        }
+        else{
+            if (prev->second != next->second)
+                changes.push_back({getIndex(next->first), (int64_t) next->second - (int64_t) prev->second});
+            ++prev;
+            ++next;
+        }
+    }
+
+    std::vector<uint8_t> bytes;
+    writeVarint(changes.size(), bytes);
+    uint64_t previousIndex = 0;
+    for (const auto& change: changes){
+        writeVarint(change.first - previousIndex, bytes);
+        writeVarint(zigzagEncode(change.second), bytes);
+        previousIndex = change.first;
+    }
+    return bytes;
+}
+
+void GraphSnapshotSequence::applyDiff(const std::vector<uint8_t>& bytes, EdgeMultiplicityList& edges) const {
+    size_t position = 0;
+    size_t changeCount = readVarint(bytes, position);
+    EdgeMultiplicityList nextEdges;
+    nextEdges.reserve(edges.size() + changeCount);
+    auto edge = edges.begin();
+    uint64_t index = 0;
+    for (size_t i = 0; i < changeCount; ++i){
+        index += readVarint(bytes, position);
+        int64_t change = zigzagDecode(readVarint(bytes, position));
+        BaseGraph::Edge changedEdge = {index / m_graphSize, index % m_graphSize};
+        while (edge != edges.end() and edge->first < changedEdge)
+            nextEdges.push_back(*edge++);
+        int64_t multiplicity = change;
+        if (edge != edges.end() and edge->first == changedEdge)
+            multiplicity += (edge++)->second;
+        if (multiplicity < 0)
+            throw std::logic_error("GraphSnapshotSequence: diff removes more edges than there are.");
+        if (multiplicity > 0)
+            nextEdges.push_back({changedEdge, (size_t) multiplicity});
+    }
+    nextEdges.insert(nextEdges.end(), edge, edges.end());
+    edges = std::move(nextEdges);
+}
+
+MultiGraph GraphSnapshotSequence::buildGraph(const EdgeMultiplicityList& edges) const {
+    MultiGraph graph(m_graphSize);
+    for (const auto& edge: edges)
+        graph.addMultiedgeIdx(edge.first.first, edge.first.second, edge.second);
+    return graph;
+}
+
+}
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "FastMIDyNet/utility/partition_distance.h"
+#include "FastMIDyNet/utility/scheduler.h"
+
+
+namespace FastMIDyNet{
+
+static void compactLabels(const BlockSequence& partition, std::vector<BlockIndex>& compactPartition, std::vector<BlockIndex>& labels){
+    const BlockIndex NO_LABEL = std::numeric_limits<BlockIndex>::max();
+    std::vector<BlockIndex> compactLabels;
+    compactPartition.resize(partition.size());
+    labels.clear();
+    for (size_t vertex = 0; vertex < partition.size(); ++vertex){
+        BlockIndex label = partition[vertex];
+        if (label >= compactLabels.size())
+            compactLabels.resize(label + 1, NO_LABEL);
+        if (compactLabels[label] == NO_LABEL){
+            compactLabels[label] = labels.size();
+            labels.push_back(label);
+        }
+        compactPartition[vertex] = compactLabels[label];
+    }
+}
+
+ContingencyTable::ContingencyTable(const BlockSequence& partition1, const BlockSequence& partition2): m_size(partition1.size()){
+    if (partition1.size() != partition2.size())
+        throw std::logic_error("ContingencyTable: partitions of " + std::to_string(partition1.size())
+            + " and " + std::to_string(partition2.size()) + " vertices.");
+    std::vector<BlockIndex> rows, columns;
+    compactLabels(partition1, rows, m_rowLabels);
+    compactLabels(partition2, columns, m_columnLabels);
+    m_rowSums.assign(m_rowLabels.size(), 0);
+    m_columnSums.assign(m_columnLabels.size(), 0);
+    m_counts.assign(m_rowLabels.size() * m_columnLabels.size(), 0);
+    for (size_t vertex = 0; vertex < m_size; ++vertex){
+        ++m_counts[rows[vertex] * m_columnLabels.size() + columns[vertex]];
+        ++m_rowSums[rows[vertex]];
+        ++m_columnSums[columns[vertex]];
+    }
+}
+
+double ContingencyTable::getEntropy(const std::vector<size_t>& blockSizes, size_t size){
+    double entropy = 0;
+    for (auto blockSize: blockSizes)
+        if (blockSize > 0)
+            entropy -= (double) blockSize / size * log((double) blockSize / size);
+    return entropy;
+}
+
+const double ContingencyTable::getMutualInformation() const {
+    double mutualInformation = 0;
+    for (BlockIndex r = 0; r < getRowCount(); ++r)
+        for (BlockIndex s = 0; s < getColumnCount(); ++s){
+            size_t count = get(r, s);
+            if (count > 0)
+                mutualInformation += (double) count / m_size
+                    * log((double) count * m_size / ((double) m_rowSums[r] * m_columnSums[s]));
+        }
+    return mutualInformation;
+}
+
+double getPartitionEntropy(const BlockSequence& partition){
+    return ContingencyTable(partition, partition).getRowEntropy();
+}
+
+double getMutualInformation(const BlockSequence& partition1, const BlockSequence& partition2){
+    return ContingencyTable(partition1, partition2).getMutualInformation();
+}
+
+static double getNormalizedMutualInformation(const ContingencyTable& table){
+    double entropySum = table.getRowEntropy() + table.getColumnEntropy();
+    if (entropySum == 0)
+        return 1;
+    return 2 * table.getMutualInformation() / entropySum;
+}
+
+double getNormalizedMutualInformation(const BlockSequence& partition1, const BlockSequence& partition2){
+    return getNormalizedMutualInformation(ContingencyTable(partition1, partition2));
+}
+
+static double getVariationOfInformation(const ContingencyTable& table){
+    /* rounding errors could make it slightly negative for equal partitions */
+    return std::max(0., table.getRowEntropy() + table.getColumnEntropy() - 2 * table.getMutualInformation());
+}
+
+double getVariationOfInformation(const BlockSequence& partition1, const BlockSequence& partition2){
+    return getVariationOfInformation(ContingencyTable(partition1, partition2));
+}
+
+/* Shortest augmenting paths with vertex potentials on the square matrix of costs
+ * -weight, padded with zeros. */
+std::vector<size_t> getMaximumWeightMatching(const std::vector<std::vector<double>>& weights, size_t columnCount){
+    const size_t rowCount = weights.size();
+    const size_t n = std::max(rowCount, columnCount);
+    auto getCost = [&](size_t row, size_t column){
+        return (row < rowCount and column < columnCount) ? -weights[row][column] : 0.;
+    };
+    const double INF = std::numeric_limits<double>::infinity();
+    /* indices are shifted by one, 0 being the virtual column of the current path */
+    std::vector<double> rowPotentials(n + 1, 0), columnPotentials(n + 1, 0);
+    std::vector<size_t> columnMatches(n + 1, 0), previousColumns(n + 1, 0);
+    for (size_t row = 1; row <= n; ++row){
+        columnMatches[0] = row;
+        size_t column = 0;
+        std::vector<double> minSlacks(n + 1, INF);
+        std::vector<bool> isUsed(n + 1, false);
+        do {
+            isUsed[column] = true;
+            size_t currentRow = columnMatches[column], nextColumn = 0;
+            double delta = INF;
+            for (size_t j = 1; j <= n; ++j){
+                if (isUsed[j])
+                    continue;
+                double slack = getCost(currentRow - 1, j - 1) - rowPotentials[currentRow] - columnPotentials[j];
+                if (slack < minSlacks[j]){
+                    minSlacks[j] = slack;
+                    previousColumns[j] = column;
+                }
+                if (minSlacks[j] < delta){
+                    delta = minSlacks[j];
+                    nextColumn = j;
+                }
+            }
+            for (size_t j = 0; j <= n; ++j){
+                if (isUsed[j]){
+                    rowPotentials[columnMatches[j]] += delta;
+                    columnPotentials[j] -= delta;
+                }
+                else
+                    minSlacks[j] -= delta;
+            }
+            column = nextColumn;
+        } while (columnMatches[column] != 0);
+        do {
+            size_t previousColumn = previousColumns[column];
+            columnMatches[column] = columnMatches[previousColumn];
+            column = previousColumn;
+        } while (column != 0);
+    }
+
+    std::vector<size_t> rowMatches(rowCount, columnCount);
+    for (size_t column = 1; column <= n; ++column)
+        if (columnMatches[column] - 1 < rowCount and column - 1 < columnCount)
+            rowMatches[columnMatches[column] - 1] = column - 1;
+    return rowMatches;
+}
+
+static std::vector<size_t> getBlockMatching(const ContingencyTable& table){
+    std::vector<std::vector<double>> weights(table.getRowCount(), std::vector<double>(table.getColumnCount()));
+    for (BlockIndex r = 0; r < table.getRowCount(); ++r)
+        for (BlockIndex s = 0; s < table.getColumnCount(); ++s)
+            weights[r][s] = table.get(r, s);
+    return getMaximumWeightMatching(weights, table.getColumnCount());
+}
+
+BlockSequence alignPartition(const BlockSequence& partition, const BlockSequence& reference){
+    ContingencyTable table(partition, reference);
+    if (partition.size() == 0)
+        return {};
+    auto matching = getBlockMatching(table);
+    const auto& rowLabels = table.getRowLabels();
+    const auto& columnLabels = table.getColumnLabels();
+
+    BlockIndex nextLabel = (columnLabels.size() == 0) ? 0 : *std::max_element(columnLabels.begin(), columnLabels.end()) + 1;
+    std::vector<BlockIndex> newLabels(*std::max_element(rowLabels.begin(), rowLabels.end()) + 1);
+    for (BlockIndex r = 0; r < rowLabels.size(); ++r)
+        newLabels[rowLabels[r]] = (matching[r] < columnLabels.size()) ? columnLabels[matching[r]] : nextLabel++;
+
+    BlockSequence alignedPartition(partition.size());
+    for (size_t vertex = 0; vertex < partition.size(); ++vertex)
+        alignedPartition[vertex] = newLabels[partition[vertex]];
+    return alignedPartition;
+}
+
+static double getAlignedAccuracy(const ContingencyTable& table){
+    if (table.getSize() == 0)
+        return 1;
+    auto matching = getBlockMatching(table);
+    size_t matchedCount = 0;
+    for (BlockIndex r = 0; r < table.getRowCount(); ++r)
+        if (matching[r] < table.getColumnCount())
+            matchedCount += table.get(r, matching[r]);
+    return (double) matchedCount / table.getSize();
+}
+
+double getAlignedAccuracy(const BlockSequence& partition, const BlockSequence& reference){
+    return getAlignedAccuracy(ContingencyTable(partition, reference));
+}
+
+static void checkMetric(const std::string& metric){
+    if (metric != "vi" and metric != "nmi" and metric != "accuracy")
+        throw std::logic_error("getPartitionDistance: invalid metric `" + metric
+            + "`, valid metrics are `vi`, `nmi` and `accuracy`.");
+}
+
+static double getDistance(const ContingencyTable& table, const std::string& metric){
+    if (metric == "vi")
+        return getVariationOfInformation(table);
+    if (metric == "nmi")
+        return 1 - getNormalizedMutualInformation(table);
+    checkMetric(metric);
+    return 1 - getAlignedAccuracy(table);
+}
+
+double getPartitionDistance(const BlockSequence& partition1, const BlockSequence& partition2, const std::string& metric){
+    return getDistance(ContingencyTable(partition1, partition2), metric);
+}
+
+/* One task per row of the upper triangle, so that the work-stealing balances the rows
+ * of decreasing length. Each pair is only written by the task of its row. */
+std::vector<std::vector<double>> getPartitionDistanceMatrix(
+    const std::vector<BlockSequence>& partitions, const std::string& metric, size_t numThreads
+){
+    checkMetric(metric);
+    const size_t count = partitions.size();
+    std::vector<std::vector<double>> distances(count, std::vector<double>(count, 0));
+    TaskScheduler scheduler(numThreads);
+    scheduler.run(count, [&](size_t i){
+        for (size_t j = i + 1; j < count; ++j)
+            distances[i][j] = distances[j][i] = getPartitionDistance(partitions[i], partitions[j], metric);
+    });
+    return distances;
+}
+
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "FastMIDyNet/rng.h"
+#include "FastMIDyNet/utility/partition_summary.h"
+
+
+namespace FastMIDyNet{
+
+BlockSequence CompressedPartition::getCanonicalPartition(const BlockSequence& partition){
+    BlockSequence canonicalPartition(partition.size());
+    std::vector<BlockIndex> canonicalLabels;
+    const BlockIndex NO_LABEL = partition.size();
+    BlockIndex labelCount = 0;
+    for (size_t vertex = 0; vertex < partition.size(); ++vertex){
+        BlockIndex label = partition[vertex];
+        if (label >= canonicalLabels.size())
+            canonicalLabels.resize(label + 1, NO_LABEL);
+        if (canonicalLabels[label] == NO_LABEL)
+            canonicalLabels[label] = labelCount++;
+        canonicalPartition[vertex] = canonicalLabels[label];
+    }
+    return canonicalPartition;
+}
+
+CompressedPartition::CompressedPartition(const BlockSequence& partition): m_size(partition.size()){
+    BlockSequence canonicalPartition = getCanonicalPartition(partition);
+    BlockIndex maxLabel = (m_size == 0) ? 0 : *std::max_element(canonicalPartition.begin(), canonicalPartition.end());
+    m_bitWidth = 1;
+    while (m_bitWidth < 64 and (maxLabel >> m_bitWidth) != 0)
+        ++m_bitWidth;
+    m_words.assign((m_size * m_bitWidth + 63) / 64, 0);
+    for (size_t vertex = 0; vertex < m_size; ++vertex){
+        size_t position = vertex * m_bitWidth;
+        uint64_t label = canonicalPartition[vertex];
+        m_words[position / 64] |= label << (position % 64);
+        if (position % 64 + m_bitWidth > 64)
+            m_words[position / 64 + 1] |= label >> (64 - position % 64);
+    }
+}
+
+BlockSequence CompressedPartition::getPartition() const {
+    BlockSequence partition(m_size);
+    const uint64_t mask = (m_bitWidth == 64) ? ~(uint64_t) 0 : ((uint64_t) 1 << m_bitWidth) - 1;
+    for (size_t vertex = 0; vertex < m_size; ++vertex){
+        size_t position = vertex * m_bitWidth;
+        uint64_t label = m_words[position / 64] >> (position % 64);
+        if (position % 64 + m_bitWidth > 64)
+            label |= m_words[position / 64 + 1] << (64 - position % 64);
+        partition[vertex] = label & mask;
+    }
+    return partition;
+}
+
+void PartitionSummarizer::setSize(size_t size){
+    m_size = size;
+    m_coassignmentCounts.assign(0, 0);
+    m_pairs.clear();
+    if (size < 2)
+        return;
+    std::uniform_int_distribution<BaseGraph::VertexIndex> vertexDistribution(0, size - 1);
+    for (size_t i = 0; i < m_pairCount; ++i){
+        BaseGraph::VertexIndex u = vertexDistribution(rng), v = vertexDistribution(rng);
+        while (v == u)
+            v = vertexDistribution(rng);
+        m_pairs.push_back({std::min(u, v), std::max(u, v)});
+    }
+    m_coassignmentCounts.assign(m_pairs.size(), 0);
+}
+
+void PartitionSummarizer::update(const BlockSequence& partition){
+    if (m_count == 0)
+        setSize(partition.size());
+    else if (partition.size() != m_size)
+        throw std::logic_error("PartitionSummarizer: partition of " + std::to_string(partition.size())
+            + " vertices, while the previous ones have " + std::to_string(m_size) + " vertices.");
+    ++m_count;
+
+    BlockSequence canonicalPartition = CompressedPartition::getCanonicalPartition(partition);
+    size_t blockCount = (m_size == 0) ? 0 : *std::max_element(canonicalPartition.begin(), canonicalPartition.end()) + 1;
+    if (blockCount >= m_blockCountHistogram.size())
+        m_blockCountHistogram.resize(blockCount + 1, 0);
+    ++m_blockCountHistogram[blockCount];
+
+    for (size_t i = 0; i < m_pairs.size(); ++i)
+        if (canonicalPartition[m_pairs[i].first] == canonicalPartition[m_pairs[i].second])
+            ++m_coassignmentCounts[i];
+
+    std::vector<size_t> blockSizes(blockCount, 0);
+    for (auto label: canonicalPartition)
+        ++blockSizes[label];
+    for (auto blockSize: blockSizes)
+        m_partitionEntropySum -= (double) blockSize / m_size * log((double) blockSize / m_size);
+
+    align(canonicalPartition, blockCount);
+
+    if (m_reservoir.size() < m_reservoirCapacity)
+        m_reservoir.push_back(CompressedPartition(canonicalPartition));
+    else if (m_reservoirCapacity > 0){
+        size_t index = std::uniform_int_distribution<size_t>(0, m_count - 1)(rng);
+        if (index < m_reservoirCapacity)
+            m_reservoir[index] = CompressedPartition(canonicalPartition);
+    }
+}
+
+/* The overlap of label r with aligned label s is the number of times the vertices of
+ * label r had label s. The pairs of largest overlap are matched first, and the labels
+ * left unmatched take the free aligned labels, or new ones. */
+void PartitionSummarizer::align(const BlockSequence& partition, size_t labelCount){
+    const size_t alignedCount = m_labelCounts.size();
+    std::vector<size_t> overlaps(labelCount * alignedCount, 0);
+    for (size_t vertex = 0; vertex < m_size; ++vertex)
+        for (size_t s = 0; s < alignedCount; ++s)
+            overlaps[partition[vertex] * alignedCount + s] += m_labelCounts[s][vertex];
+
+    std::vector<std::tuple<size_t, BlockIndex, BlockIndex>> candidates;
+    for (BlockIndex r = 0; r < labelCount; ++r)
+        for (BlockIndex s = 0; s < alignedCount; ++s)
+            if (overlaps[r * alignedCount + s] > 0)
+                candidates.push_back(std::make_tuple(overlaps[r * alignedCount + s], r, s));
+    std::sort(candidates.begin(), candidates.end(), [](
+        const std::tuple<size_t, BlockIndex, BlockIndex>& a, const std::tuple<size_t, BlockIndex, BlockIndex>& b){
+            if (std::get<0>(a) != std::get<0>(b))
+                return std::get<0>(a) > std::get<0>(b);
+            return std::make_pair(std::get<1>(a), std::get<2>(a)) < std::make_pair(std::get<1>(b), std::get<2>(b));
+        });
+
+    const BlockIndex UNMATCHED = std::max(labelCount, alignedCount);
+    m_lastAlignment.assign(labelCount, UNMATCHED);
+    std::vector<bool> isMatched(alignedCount, false);
+    for (const auto& candidate: candidates){
+        BlockIndex r = std::get<1>(candidate), s = std::get<2>(candidate);
+        if (m_lastAlignment[r] == UNMATCHED and not isMatched[s]){
+            m_lastAlignment[r] = s;
+            isMatched[s] = true;
+        }
+    }
+    BlockIndex freeLabel = 0;
+    for (BlockIndex r = 0; r < labelCount; ++r){
+        if (m_lastAlignment[r] != UNMATCHED)
+            continue;
+        while (freeLabel < alignedCount and isMatched[freeLabel])
+            ++freeLabel;
+        if (freeLabel < alignedCount)
+            isMatched[freeLabel] = true;
+        else
+            m_labelCounts.push_back(std::vector<size_t>(m_size, 0));
+        m_lastAlignment[r] = freeLabel++;
+    }
+
+    for (size_t vertex = 0; vertex < m_size; ++vertex)
+        ++m_labelCounts[m_lastAlignment[partition[vertex]]][vertex];
+}
+
+void PartitionSummarizer::clear(){
+    m_size = 0;
+    m_count = 0;
+    m_blockCountHistogram.clear();
+    m_pairs.clear();
+    m_coassignmentCounts.clear();
+    m_labelCounts.clear();
+    m_lastAlignment.clear();
+    m_partitionEntropySum = 0;
+    m_reservoir.clear();
+}
+
+const std::vector<double> PartitionSummarizer::getCoassignmentProbs() const {
+    std::vector<double> probs(m_coassignmentCounts.size());
+    for (size_t i = 0; i < probs.size(); ++i)
+        probs[i] = (double) m_coassignmentCounts[i] / m_count;
+    return probs;
+}
+
+const BlockSequence PartitionSummarizer::getConsensus() const {
+    BlockSequence consensus(m_size, 0);
+    for (size_t vertex = 0; vertex < m_size; ++vertex)
+        for (BlockIndex s = 1; s < m_labelCounts.size(); ++s)
+            if (m_labelCounts[s][vertex] > m_labelCounts[consensus[vertex]][vertex])
+                consensus[vertex] = s;
+    return consensus;
+}
+
+const double PartitionSummarizer::getMarginalEntropy() const {
+    double entropy = 0;
+    for (const auto& counts: m_labelCounts)
+        for (auto count: counts)
+            if (count > 0)
+                entropy -= (double) count / m_count * log((double) count / m_count);
+    return entropy;
+}
+
+const std::vector<BlockSequence> PartitionSummarizer::getReservoir() const {
+    std::vector<BlockSequence> partitions;
+    for (const auto& partition: m_reservoir)
+        partitions.push_back(partition.getPartition());
+    return partitions;
+}
+
+const size_t PartitionSummarizer::getReservoirByteCount() const {
+    size_t byteCount = 0;
+    for (const auto& partition: m_reservoir)
+        byteCount += partition.getByteCount();
+    return byteCount;
+}
+
+}
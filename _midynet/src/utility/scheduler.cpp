@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include "FastMIDyNet/utility/parallel.hpp"
+#include "FastMIDyNet/utility/scheduler.h"
+
+
+namespace FastMIDyNet{
+
+TaskScheduler::TaskScheduler(size_t numThreads):
+    m_threadCount(FastMIDyNet::getThreadCount(numThreads)), m_isStopped(false), m_stolenTaskCount(0){
+    for (size_t i = 0; i < m_threadCount; ++i)
+        m_queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+}
+
+bool TaskScheduler::popTask(size_t threadIndex, size_t& task){
+    TaskQueue& queue = *m_queues[threadIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool TaskScheduler::stealTask(size_t threadIndex, size_t& task){
+    for (size_t i = 1; i < m_threadCount; ++i){
+        TaskQueue& queue = *m_queues[(threadIndex + i) % m_threadCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+        ++m_stolenTaskCount;
+        return true;
+    }
+    return false;
+}
+
+/* Tasks never create other tasks, so a thread that finds every queue empty is done. */
+void TaskScheduler::work(size_t threadIndex, const Task& task, const Task& onTaskEnd){
+    size_t taskIndex;
+    while (not m_isStopped and (popTask(threadIndex, taskIndex) or stealTask(threadIndex, taskIndex))){
+        task(taskIndex);
+        if (onTaskEnd){
+            std::lock_guard<std::mutex> lock(m_onTaskEndMutex);
+            onTaskEnd(taskIndex);
+        }
+    }
+}
+
+void TaskScheduler::run(size_t taskCount, const Task& task, const Task& onTaskEnd){
+    m_isStopped = false;
+    m_stolenTaskCount = 0;
+    size_t blockSize = taskCount / m_threadCount + (taskCount % m_threadCount != 0);
+    for (size_t i = 0; i < m_threadCount; ++i){
+        auto& tasks = m_queues[i]->tasks;
+        tasks.clear();
+        /* Queues are reversed so that each thread starts with the first task of its block. */
+        for (size_t j = std::min((i + 1) * blockSize, taskCount); j > std::min(i * blockSize, taskCount); --j)
+            tasks.push_back(j - 1);
+    }
+
+    std::vector<std::exception_ptr> errors(m_threadCount, nullptr);
+    auto worker = [&](size_t threadIndex){
+        try {
+            work(threadIndex, task, onTaskEnd);
+        }
+        catch (...) {
+            errors[threadIndex] = std::current_exception();
+            m_isStopped = true;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < m_threadCount; ++i)
+        threads.push_back(std::thread(worker, i));
+    worker(0);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& queue : m_queues)
+        queue->tasks.clear();
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+}
@@ -130,6 +130,45 @@ TEST_F(TestDynamicsBaseClass, getFutureStates_returnFutureStates){
     }
 }
 
+TEST_F(TestDynamicsBaseClass, getPastStateArray_afterResampling_keepPreviousArrayUnchanged){
+    dynamics.sampleState();
+    StateSequence pastStates = dynamics.getPastStates();
+    auto pastStateArray = dynamics.getPastStateArray();
+    EXPECT_EQ(pastStateArray, dynamics.getPastStateArray());
+    ASSERT_EQ(pastStateArray->size(), NUM_VERTICES * NUM_STEPS);
+    for (size_t idx = 0; idx < NUM_VERTICES; ++idx)
+        for (size_t t = 0; t < NUM_STEPS; ++t)
+            EXPECT_EQ((*pastStateArray)[idx * NUM_STEPS + t], pastStates[idx][t]);
+
+    dynamics.sampleState();
+    EXPECT_NE(pastStateArray, dynamics.getPastStateArray());
+    EXPECT_EQ(*pastStateArray, *Dynamics<RandomGraph>::getStateArray(pastStates));
+}
+
+TEST_F(TestDynamicsBaseClass, setStateSequences_forSampledSequences_recoverSameLikelihood){
+    dynamics.sampleState();
+    StateSequence pastStates = dynamics.getPastStates(), futureStates = dynamics.getFutureStates();
+    double logLikelihood = dynamics.getLogLikelihood();
+    dynamics.sampleState();
+    dynamics.setStateSequences(pastStates, futureStates);
+    EXPECT_EQ(dynamics.getPastStates(), pastStates);
+    EXPECT_EQ(dynamics.getNeighborsPastStates(), dynamics.computeNeighborsStateSequence(pastStates));
+    for (BaseGraph::VertexIndex idx = 0; idx < NUM_VERTICES; ++idx)
+        EXPECT_EQ(dynamics.getCurrentState()[idx], futureStates[idx][NUM_STEPS - 1]);
+    EXPECT_DOUBLE_EQ(dynamics.getLogLikelihood(), logLikelihood);
+}
+
+TEST_F(TestDynamicsBaseClass, setStateSequences_forInvalidSequences_throwLogicError){
+    StateSequence pastStates(NUM_VERTICES, State(NUM_STEPS, 0));
+    StateSequence futureStates(pastStates);
+    futureStates[0].pop_back();
+    EXPECT_THROW(dynamics.setStateSequences(pastStates, futureStates), std::logic_error);
+    futureStates[0].push_back(NUM_STATES);
+    EXPECT_THROW(dynamics.setStateSequences(pastStates, futureStates), std::logic_error);
+    futureStates.pop_back();
+    EXPECT_THROW(dynamics.setStateSequences(pastStates, futureStates), std::logic_error);
+}
+
 TEST_F(TestDynamicsBaseClass, getLogJointRatio_forSomeGraphMove_returnLogJointRatio){
     dynamics.sampleState();
     double ratio = dynamics.getLogJointRatioFromGraphMove(GRAPH_MOVE);
@@ -157,6 +196,29 @@ TEST_F(TestDynamicsBaseClass, applyMove_forSomeGraphMove_expectChangesInTheGraph
     EXPECT_EQ(dynamics.getCurrentNeighborsState(), dynamics.computeNeighborsState(dynamics.getCurrentState()));
 }
 
+TEST_F(TestDynamicsBaseClass, getLogLikelihoods_forManyGraphs_returnLogLikelihoodOfEachGraph){
+    dynamics.sampleState(state);
+    MultiGraph otherGraph = graph;
+    otherGraph.removeEdgeIdx(GRAPH_MOVE.removedEdges[0].first, GRAPH_MOVE.removedEdges[0].second);
+    otherGraph.addEdgeIdx(GRAPH_MOVE.addedEdges[0].first, GRAPH_MOVE.addedEdges[0].second);
+    std::vector<MultiGraph> graphs = {graph, otherGraph, otherGraph, graph};
+
+    std::vector<double> expected;
+    for (const auto& g: graphs){
+        dynamics.setGraph(g);
+        expected.push_back(dynamics.getLogLikelihood());
+    }
+    dynamics.setGraph(graph);
+
+    for (size_t numThreads: {1, 3}){
+        auto actual = dynamics.getLogLikelihoods(graphs, numThreads);
+        ASSERT_EQ(actual.size(), graphs.size());
+        for (size_t i = 0; i < graphs.size(); ++i)
+            EXPECT_NEAR(actual[i], expected[i], 1e-6);
+    }
+    EXPECT_EQ(dynamics.getGraph(), graph);
+}
+
 TEST_F(TestDynamicsBaseClass, updateNeighborsStateFromEdgeMove_fromAddedEdge_expectCorrectionInNeighborState){
     dynamics.sampleState();
     BaseGraph::Edge edge = GRAPH_MOVE.addedEdges[0];
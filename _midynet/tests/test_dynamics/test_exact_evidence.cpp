@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <vector>
+
+#include "FastMIDyNet/dynamics/sis.hpp"
+#include "FastMIDyNet/dynamics/exact_evidence.hpp"
+#include "FastMIDyNet/random_graph/erdosrenyi.h"
+#include "FastMIDyNet/random_graph/dcsbm.h"
+#include "FastMIDyNet/utility/graph_enumeration.h"
+#include "FastMIDyNet/rng.h"
+#include "fixtures.hpp"
+
+namespace FastMIDyNet{
+
+class SISReplica{
+public:
+    EdgeCountDeltaPrior edgeCountPrior = {3};
+    ErdosRenyiFamily randomGraph = ErdosRenyiFamily(5, edgeCountPrior);
+    SISDynamics<RandomGraph> dynamics = SISDynamics<RandomGraph>(randomGraph, NUM_STEPS, 0.5, 0.3, 1e-2, 1e-2, false, 2);
+    SISReplica() {
+        seed(42);
+        dynamics.sample();
+    }
+};
+
+/* Every prior is a delta, such that only the graphs with the sampled blocks, edge matrix
+ * and degrees are possible. */
+class DeltaSISReplica{
+public:
+    BlockDeltaPrior blockPrior = {{0, 0, 0, 1, 1}};
+    EdgeCountDeltaPrior edgeCountPrior = {3};
+    EdgeMatrixDeltaPrior edgeMatrixPrior = {getEdgeMatrix(), edgeCountPrior, blockPrior};
+    DegreeDeltaPrior degreePrior = {{1, 2, 1, 1, 1}};
+    DegreeCorrectedStochasticBlockModelFamily randomGraph = DegreeCorrectedStochasticBlockModelFamily(5, blockPrior, edgeMatrixPrior, degreePrior);
+    SISDynamics<RandomGraph> dynamics = SISDynamics<RandomGraph>(randomGraph, NUM_STEPS, 0.5, 0.3, 1e-2, 1e-2, false, 2);
+    DeltaSISReplica() {
+        seed(42);
+        dynamics.sample();
+    }
+    static MultiGraph getEdgeMatrix(){
+        MultiGraph edgeMatrix(2);
+        edgeMatrix.addMultiedgeIdx(0, 0, 2);
+        edgeMatrix.addEdgeIdx(1, 1);
+        return edgeMatrix;
+    }
+};
+
+class TestExactEvidence: public::testing::Test{
+public:
+    std::vector<SISReplica> replicas = std::vector<SISReplica>(3);
+
+    /* Enumeration of the former Python implementation. */
+    double getBruteForceLogEvidence(Dynamics<RandomGraph>& dynamics){
+        MultiGraph originalGraph = dynamics.getGraph();
+        GraphEnumerator enumerator(5, 3);
+        LogSumExp logEvidence;
+        GraphMove move;
+        do {
+            if (not dynamics.getGraphPrior().isCompatible(enumerator.getGraph()))
+                continue;
+            dynamics.setGraph(enumerator.getGraph());
+            logEvidence.add(dynamics.getLogJoint());
+        } while (enumerator.next(move));
+        dynamics.setGraph(originalGraph);
+        return logEvidence.get();
+    }
+};
+
+TEST_F(TestExactEvidence, getExactEvidence_forSingleReplica_returnBruteForceEvidence){
+    double expected = getBruteForceLogEvidence(replicas[0].dynamics);
+    auto exactEvidence = getExactEvidence<RandomGraph>({&replicas[0].dynamics});
+    EXPECT_NEAR(exactEvidence.logEvidence, expected, 1e-6);
+    EXPECT_EQ(exactEvidence.graphCount, GraphEnumerator::getGraphCount(5, 3));
+}
+
+TEST_F(TestExactEvidence, getExactEvidence_forManyReplicas_returnSameAsSingleReplica){
+    auto expected = getExactEvidence<RandomGraph>({&replicas[0].dynamics});
+    auto actual = getExactEvidence<RandomGraph>({&replicas[0].dynamics, &replicas[1].dynamics, &replicas[2].dynamics});
+    EXPECT_NEAR(actual.logEvidence, expected.logEvidence, 1e-6);
+    EXPECT_EQ(actual.graphCount, expected.graphCount);
+    for (const auto& marginals : actual.edgeLogMarginals){
+        double totalProb = 0;
+        for (size_t m = 0; m < marginals.second.size(); ++m){
+            EXPECT_NEAR(marginals.second[m], expected.edgeLogMarginals[marginals.first][m], 1e-6);
+            totalProb += exp(marginals.second[m]);
+        }
+        EXPECT_NEAR(totalProb, 1, 1e-6);
+    }
+}
+
+TEST_F(TestExactEvidence, getExactEvidence_afterEnumeration_restoreOriginalGraph){
+    MultiGraph originalGraph = replicas[0].dynamics.getGraph();
+    getExactEvidence<RandomGraph>({&replicas[0].dynamics});
+    EXPECT_EQ(replicas[0].dynamics.getGraph(), originalGraph);
+}
+
+TEST_F(TestExactEvidence, getExactEvidence_forDeltaPriors_returnBruteForceEvidenceOfCompatibleGraphs){
+    std::vector<DeltaSISReplica> deltaReplicas(2);
+    double expected = getBruteForceLogEvidence(deltaReplicas[0].dynamics);
+    auto exactEvidence = getExactEvidence<RandomGraph>({&deltaReplicas[0].dynamics, &deltaReplicas[1].dynamics});
+    EXPECT_NEAR(exactEvidence.logEvidence, expected, 1e-6);
+    EXPECT_LT(exactEvidence.graphCount, GraphEnumerator::getGraphCount(5, 3));
+    EXPECT_TRUE(deltaReplicas[0].randomGraph.isCompatible(deltaReplicas[0].dynamics.getGraph()));
+}
+
+}
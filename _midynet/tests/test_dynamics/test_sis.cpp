@@ -81,4 +81,36 @@ TEST_F(TestSISDynamics, getLogLikelihoodRatio_forSomeGraphMove_returnLogJointRat
     EXPECT_NEAR(ratio, logLikelihoodAfter - logLikelihoodBefore, 1e-6);
 }
 
+TEST_F(TestSISDynamics, getLogLikelihoods_withNormalizedCouplingForManyEdgeCounts_returnLogLikelihoodOfEachGraph){
+    // the edge count of this family follows the graph, so that each expected value is
+    // normalized by the edge count of its graph
+    EdgeCountPoissonPrior poissonPrior = {10};
+    SimpleErdosRenyiFamily simpleGraph(10, poissonPrior);
+    FastMIDyNet::SISDynamics<RandomGraph> normalizedDynamics(
+        simpleGraph, NUM_STEPS, INFECTION_PROB, RECOVERY_PROB,
+        AUTO_ACTIVATION_PROB, AUTO_DEACTIVATION_PROB,
+        true, NUM_INITIAL_ACTIVE);
+    normalizedDynamics.sample();
+    normalizedDynamics.setGraph(generateSER(10, 10));
+    MultiGraph originalGraph = normalizedDynamics.getGraph();
+    std::vector<MultiGraph> graphs = {generateSER(10, 20), generateSER(10, 10), generateSER(10, 15), generateSER(10, 20)};
+
+    std::vector<double> expected;
+    for (const auto& graph: graphs){
+        normalizedDynamics.setGraph(graph);
+        expected.push_back(normalizedDynamics.getLogLikelihood());
+    }
+    normalizedDynamics.setGraph(originalGraph);
+    size_t priorCacheEpoch = simpleGraph.getCacheEpoch();
+
+    auto actual = normalizedDynamics.getLogLikelihoods(graphs, 2);
+    for (size_t i = 0; i < graphs.size(); ++i)
+        EXPECT_NEAR(actual[i], expected[i], 1e-6);
+    EXPECT_EQ(normalizedDynamics.getGraph(), originalGraph);
+    EXPECT_EQ(simpleGraph.getEdgeCount(), 10);
+    // the graph prior is never set to the evaluated graphs
+    EXPECT_EQ(simpleGraph.getCacheEpoch(), priorCacheEpoch);
+    EXPECT_EQ(normalizedDynamics.getCouplingEdgeCount(), 10);
+}
+
 }
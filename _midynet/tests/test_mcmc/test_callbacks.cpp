@@ -82,6 +82,72 @@ public:
 };
 COLLECTOR_TESTS(TestCollectEdgeMultiplicityOnSweep);
 
+TEST_F(TestCollectEdgeMultiplicityOnSweep, doMHSweep_forManySweeps_matchMultiplicitiesOfCollectedGraphs){
+    CollectGraphOnSweep<GraphReconstructionMCMC<RandomGraph>> graphCollector;
+    mcmc.insertCallBack("collect_graph", graphCollector);
+    mcmc.setUp();
+    callback.collect();
+    graphCollector.collect();
+    for (size_t i = 0; i < 20; ++i)
+        mcmc.doMHSweep(5);
+
+    const auto graphs = graphCollector.getData();
+    EXPECT_EQ(callback.getTotalCount(), graphs.size());
+    double logPosterior = 0;
+    for (auto edge: callback.getMarginals().getObservedEdges()){
+        std::vector<size_t> counts(callback.getMarginals().getMaxObservedMultiplicity(edge) + 1, 0);
+        for (const auto& graph: graphs)
+            ++counts.at(graph.getEdgeMultiplicityIdx(edge));
+        for (size_t count = 0; count < counts.size(); ++count)
+            EXPECT_DOUBLE_EQ(callback.getEdgeCountProb(edge, count), (double) counts[count] / graphs.size());
+        EXPECT_EQ(callback.getEdgeObservationCount(edge), graphs.size() - counts[0]);
+        logPosterior += log((double) counts[graphs[0].getEdgeMultiplicityIdx(edge)] / graphs.size());
+    }
+    EXPECT_DOUBLE_EQ(callback.getLogPosteriorEstimate(graphs[0]), logPosterior);
+    for (const auto& graph: graphs)
+        for (auto vertex: graph)
+            for (auto neighbor: graph.getNeighboursOfIdx(vertex))
+                EXPECT_TRUE(callback.getMarginals().isObserved(getOrderedEdge({vertex, neighbor.vertexIndex})));
+}
+
+TEST_F(TestCollectEdgeMultiplicityOnSweep, collect_afterSetGraph_collectNewGraph){
+    MultiGraph graph(10);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(0, 1);
+    mcmc.setGraph(graph);
+    callback.collect();
+    EXPECT_DOUBLE_EQ(callback.getEdgeCountProb({0, 1}, 2), 1);
+    EXPECT_EQ(callback.getMarginals().getObservedEdges(), std::vector<BaseGraph::Edge>({{0, 1}}));
+
+    /* the edge count is kept, such that only the version reveals the new graph */
+    MultiGraph otherGraph(10);
+    otherGraph.addEdgeIdx(2, 3);
+    otherGraph.addEdgeIdx(4, 5);
+    mcmc.setGraph(otherGraph);
+    mcmc.doMHSweep(10);
+    callback.collect();
+    for (auto vertex: mcmc.getGraph())
+        for (auto neighbor: mcmc.getGraph().getNeighboursOfIdx(vertex))
+            EXPECT_EQ(callback.getMarginals().getMultiplicity(getOrderedEdge({vertex, neighbor.vertexIndex})), neighbor.label);
+    EXPECT_EQ(callback.getMarginals().getTotalMultiplicity(), mcmc.getGraph().getTotalEdgeNumber());
+}
+
+TEST_F(TestCollectEdgeMultiplicityOnSweep, doMHSweep_forTimeWeightedCollector_weightGraphsByStep){
+    CollectEdgeMultiplicityOnSweep<GraphReconstructionMCMC<RandomGraph>> timeWeightedCallback(true);
+    mcmc.insertCallBack("time_weighted", timeWeightedCallback);
+    mcmc.setUp();
+    for (size_t i = 0; i < 4; ++i)
+        mcmc.doMHSweep(5);
+    EXPECT_EQ(timeWeightedCallback.getTotalCount(), 4);
+    EXPECT_DOUBLE_EQ(timeWeightedCallback.getMarginals().getTime(), 20);
+    for (auto edge: timeWeightedCallback.getMarginals().getObservedEdges()){
+        double sum = 0;
+        for (size_t count = 0; count <= timeWeightedCallback.getMarginals().getMaxObservedMultiplicity(edge); ++count)
+            sum += timeWeightedCallback.getEdgeCountProb(edge, count);
+        EXPECT_DOUBLE_EQ(sum, 1);
+    }
+}
+
 class TestCollectLikelihoodOnSweep: public::testing::Test{
 public:
     CollectLikelihoodOnSweep callback ;
@@ -130,6 +196,87 @@ public:
 };
 COLLECTOR_TESTS(TestCollectJointOnSweep);
 
+class TestSummarizePartitionOnSweep: public::testing::Test{
+public:
+    SummarizePartitionOnSweepForCommunity callback = SummarizePartitionOnSweepForCommunity(50, 10);
+    DummySBM randomGraph = DummySBM();
+    GibbsUniformLabelProposer<BlockIndex> proposer = GibbsUniformLabelProposer<BlockIndex>();
+    VertexLabelMCMC<BlockIndex> mcmc = VertexLabelMCMC<BlockIndex>(randomGraph, proposer);
+    std::string name = "summarize_partition";
+    void SetUp(){
+        seed(1);
+        randomGraph.sample();
+        mcmc.insertCallBack(name, callback);
+        mcmc.setUp();
+    }
+};
+COLLECTOR_TESTS(TestSummarizePartitionOnSweep);
+
+TEST_F(TestSummarizePartitionOnSweep, doMHSweep_forManySweeps_matchStatisticsOfCollectedPartitions){
+    CollectPartitionOnSweepForCommunity partitionCollector;
+    mcmc.insertCallBack("collect_partition", partitionCollector);
+    mcmc.setUp();
+    for (size_t i = 0; i < 20; ++i)
+        mcmc.doMHSweep(10);
+
+    const auto& partitions = partitionCollector.getData();
+    const auto& summary = callback.getSummary();
+    EXPECT_EQ(summary.getCount(), partitions.size());
+    const auto probs = summary.getCoassignmentProbs();
+    for (size_t i = 0; i < probs.size(); ++i){
+        auto pair = summary.getPairs()[i];
+        size_t count = 0;
+        for (const auto& partition: partitions)
+            count += partition[pair.first] == partition[pair.second];
+        EXPECT_DOUBLE_EQ(probs[i], (double) count / partitions.size());
+    }
+    size_t histogramSum = 0;
+    for (auto count: summary.getBlockCountHistogram())
+        histogramSum += count;
+    EXPECT_EQ(histogramSum, partitions.size());
+    EXPECT_EQ(summary.getReservoir().size(), 10);
+    EXPECT_EQ(summary.getConsensus().size(), randomGraph.getSize());
+}
+
+class TestCollectStatistics: public::testing::Test{
+public:
+    CollectStatistics callback = CollectStatistics({"log_joint", "log_joint_ratio", "acceptance_rate"}, 2, 3);
+    DummyGraphPrior randomGraph = DummyGraphPrior();
+    SISDynamics<RandomGraph> dynamics = SISDynamics<RandomGraph>(randomGraph, 10, 0.1);
+    HingeFlipUniformProposer proposer = HingeFlipUniformProposer();
+    GraphReconstructionMCMC<RandomGraph> mcmc = GraphReconstructionMCMC<RandomGraph>(dynamics, proposer);
+    std::string name = "collect_statistics";
+    void SetUp(){
+        dynamics.sample();
+        mcmc.insertCallBack(name, callback);
+        mcmc.setUp();
+    }
+};
+COLLECTOR_TESTS(TestCollectStatistics);
+
+TEST_F(TestCollectStatistics, doMHSweep_forManySweeps_keepLastRecordsAtStride){
+    for (size_t i = 0; i < 10; ++i){
+        mcmc.doMHSweep(5);
+        if (i % 2 == 1){
+            EXPECT_DOUBLE_EQ(callback.getBuffer("log_joint").back(), mcmc.getLogJoint());
+        }
+    }
+    EXPECT_EQ(callback.getBuffer("log_joint").getPushCount(), 5);
+    EXPECT_EQ(callback.getData("log_joint").size(), 3);
+    for (auto rate: callback.getData("acceptance_rate")){
+        EXPECT_GE(rate, 0);
+        EXPECT_LE(rate, 1);
+    }
+}
+
+TEST_F(TestCollectStatistics, getBuffer_forUncollectedStatistic_throwLogicError){
+    EXPECT_THROW(callback.getBuffer("log_prior"), std::logic_error);
+}
+
+TEST_F(TestCollectStatistics, constructor_forUnknownStatistic_throwLogicError){
+    EXPECT_THROW(CollectStatistics({"log_posterior"}), std::logic_error);
+}
+
 class TestTimerVerbose: public::testing::Test{
 public:
     TimerVerbose callback ;
@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+#include <stdexcept>
+
+#include "fixtures.hpp"
+#include "FastMIDyNet/clone.hpp"
+#include "FastMIDyNet/prior/sbm/degree.h"
+#include "FastMIDyNet/random_graph/dcsbm.h"
+#include "FastMIDyNet/dynamics/sis.hpp"
+#include "FastMIDyNet/proposer/edge/hinge_flip.h"
+#include "FastMIDyNet/proposer/label/uniform.hpp"
+#include "FastMIDyNet/mcmc/reconstruction.hpp"
+#include "FastMIDyNet/rng.h"
+
+
+namespace FastMIDyNet{
+
+class TestCloneGraphReconstructionMCMC: public::testing::Test{
+public:
+    EdgeCountDeltaPrior edgeCountPrior = EdgeCountDeltaPrior(25);
+    ErdosRenyiFamily randomGraph = ErdosRenyiFamily(10, edgeCountPrior);
+    SISDynamics<RandomGraph> dynamics = SISDynamics<RandomGraph>(randomGraph, 10, 0.5);
+    HingeFlipUniformProposer proposer = HingeFlipUniformProposer();
+    GraphReconstructionMCMC<RandomGraph> mcmc = GraphReconstructionMCMC<RandomGraph>(dynamics, proposer);
+    void SetUp(){
+        seed(1);
+        dynamics.sample();
+        mcmc.setUp();
+    }
+};
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_forSetUpMCMC_returnSafeCloneWithSameLogJoint){
+    CloneMap cloneMap;
+    auto& clone = cloneMap.get(mcmc);
+    EXPECT_NE(&clone, &mcmc);
+    EXPECT_NE(&clone.getDynamics(), &dynamics);
+    EXPECT_NE(&clone.getGraph(), &mcmc.getGraph());
+    EXPECT_EQ(clone.getGraph(), mcmc.getGraph());
+    EXPECT_TRUE(clone.isSafe());
+    EXPECT_DOUBLE_EQ(clone.getLogJoint(), mcmc.getLogJoint());
+    clone.checkConsistency();
+}
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_afterMovesOnClone_leaveOriginalUnchanged){
+    MultiGraph graph = mcmc.getGraph();
+    double logJoint = mcmc.getLogJoint();
+    CloneMap cloneMap;
+    auto& clone = cloneMap.get(mcmc);
+    clone.doMHSweep(100);
+    clone.checkConsistency();
+    EXPECT_EQ(mcmc.getGraph(), graph);
+    EXPECT_DOUBLE_EQ(mcmc.getLogJoint(), logJoint);
+    mcmc.checkConsistency();
+}
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_withSharedData_shareStateSequences){
+    CloneMap cloneMap;
+    auto& clone = cloneMap.get(mcmc);
+    EXPECT_EQ(&clone.getDynamics().getPastStates(), &dynamics.getPastStates());
+    EXPECT_EQ(&clone.getDynamics().getFutureStates(), &dynamics.getFutureStates());
+
+    clone.getDynamicsRef().sampleState();
+    EXPECT_NE(&clone.getDynamics().getPastStates(), &dynamics.getPastStates());
+    dynamics.checkConsistency();
+}
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_withoutSharedData_copyStateSequences){
+    CloneMap cloneMap(false);
+    auto& clone = cloneMap.get(mcmc);
+    EXPECT_NE(&clone.getDynamics().getPastStates(), &dynamics.getPastStates());
+    EXPECT_EQ(clone.getDynamics().getPastStates(), dynamics.getPastStates());
+    EXPECT_EQ(clone.getDynamics().getFutureStates(), dynamics.getFutureStates());
+}
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_forSeveralClones_returnIndependentClones){
+    CloneMap firstCloneMap, secondCloneMap;
+    auto& first = firstCloneMap.get(mcmc);
+    auto& second = secondCloneMap.get(mcmc);
+    EXPECT_EQ(&firstCloneMap.get(mcmc), &first);
+    EXPECT_NE(&first, &second);
+    first.doMHSweep(50);
+    second.checkConsistency();
+    EXPECT_EQ(second.getGraph(), mcmc.getGraph());
+}
+
+TEST_F(TestCloneGraphReconstructionMCMC, get_forClassWithoutClone_throwLogicError){
+    DummyGraphPrior graphPrior;
+    CloneMap cloneMap;
+    EXPECT_THROW(cloneMap.get(graphPrior), std::logic_error);
+}
+
+class TestCloneVertexLabeledGraphReconstructionMCMC: public::testing::Test{
+public:
+    BlockCountPoissonPrior blockCountPrior = BlockCountPoissonPrior(3);
+    BlockUniformPrior blockPrior = BlockUniformPrior(10, blockCountPrior);
+    EdgeCountPoissonPrior edgeCountPrior = EdgeCountPoissonPrior(20);
+    EdgeMatrixUniformPrior edgeMatrixPrior = EdgeMatrixUniformPrior(edgeCountPrior, blockPrior);
+    DegreeUniformPrior degreePrior = DegreeUniformPrior(blockPrior, edgeMatrixPrior);
+    DegreeCorrectedStochasticBlockModelFamily randomGraph = DegreeCorrectedStochasticBlockModelFamily(
+        10, blockPrior, edgeMatrixPrior, degreePrior
+    );
+    SISDynamics<VertexLabeledRandomGraph<BlockIndex>> dynamics = SISDynamics<VertexLabeledRandomGraph<BlockIndex>>(randomGraph, 10, 0.5);
+    HingeFlipUniformProposer edgeProposer = HingeFlipUniformProposer();
+    GibbsUniformLabelProposer<BlockIndex> labelProposer = GibbsUniformLabelProposer<BlockIndex>();
+    VertexLabeledGraphReconstructionMCMC<BlockIndex> mcmc = VertexLabeledGraphReconstructionMCMC<BlockIndex>(
+        dynamics, edgeProposer, labelProposer
+    );
+    void SetUp(){
+        seed(2);
+        dynamics.sample();
+        mcmc.setUp();
+    }
+};
+
+TEST_F(TestCloneVertexLabeledGraphReconstructionMCMC, get_forSharedPriors_cloneEachPriorOnce){
+    CloneMap cloneMap;
+    auto& clone = cloneMap.get(mcmc);
+    const auto& cloneGraph = dynamic_cast<const DegreeCorrectedStochasticBlockModelFamily&>(clone.getGraphPrior());
+    const auto& cloneBlockPrior = cloneGraph.getBlockPrior();
+    EXPECT_NE(&cloneBlockPrior, &blockPrior);
+    EXPECT_EQ(&cloneGraph.getEdgeMatrixPrior().getBlockPrior(), &cloneBlockPrior);
+    EXPECT_EQ(&cloneGraph.getDegreePrior().getBlockPrior(), &cloneBlockPrior);
+    EXPECT_EQ(&cloneGraph.getDegreePrior().getEdgeMatrixPrior(), &cloneGraph.getEdgeMatrixPrior());
+    EXPECT_NE(&cloneBlockPrior.getBlockCountPrior(), &blockCountPrior);
+    EXPECT_DOUBLE_EQ(clone.getLogJoint(), mcmc.getLogJoint());
+}
+
+TEST_F(TestCloneVertexLabeledGraphReconstructionMCMC, get_afterMovesOnClone_keepBothConsistent){
+    double logJoint = mcmc.getLogJoint();
+    CloneMap cloneMap;
+    auto& clone = cloneMap.get(mcmc);
+    clone.doMHSweep(100);
+    clone.checkConsistency();
+    mcmc.checkConsistency();
+    EXPECT_DOUBLE_EQ(mcmc.getLogJoint(), logJoint);
+}
+
+}
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "fixtures.hpp"
+#include "FastMIDyNet/dynamics/sis.hpp"
+#include "FastMIDyNet/proposer/edge/hinge_flip.h"
+#include "FastMIDyNet/mcmc/reconstruction.hpp"
+#include "FastMIDyNet/mcmc/information.hpp"
+
+
+namespace FastMIDyNet{
+
+class InformationModel{
+public:
+    DummyGraphPrior randomGraph;
+    SISDynamics<RandomGraph> dynamics;
+    HingeFlipUniformProposer proposer;
+    GraphReconstructionMCMC<RandomGraph> mcmc;
+    InformationModel(size_t size=5, size_t edgeCount=4):
+        randomGraph(size, edgeCount), dynamics(randomGraph, 10, 0.5), mcmc(dynamics, proposer) { }
+};
+
+class TestInformationEstimator: public::testing::Test{
+public:
+    std::vector<InformationModel> models = std::vector<InformationModel>(2);
+    std::vector<GraphReconstructionMCMC<RandomGraph>*> getMCMCs(size_t count){
+        std::vector<GraphReconstructionMCMC<RandomGraph>*> mcmcs;
+        for (size_t i = 0; i < count; ++i)
+            mcmcs.push_back(&models[i].mcmc);
+        return mcmcs;
+    }
+};
+
+TEST_F(TestInformationEstimator, compute_forMeanfield_returnConsistentQuantities){
+    InformationEstimator<RandomGraph> estimator(getMCMCs(2), "meanfield", 10, 1, 10);
+    auto samples = estimator.compute(6, 42);
+    for (const auto& quantity: InformationEstimator<RandomGraph>::getQuantityNames())
+        EXPECT_EQ(samples.at(quantity).size(), 6);
+    for (size_t i = 0; i < 6; ++i){
+        EXPECT_NEAR(samples.at("hx")[i], samples.at("hg")[i] + samples.at("hxg")[i] - samples.at("hgx")[i], 1e-6);
+        EXPECT_NEAR(samples.at("mi")[i], samples.at("hg")[i] - samples.at("hgx")[i], 1e-6);
+    }
+    EXPECT_GE(estimator.getStandardError("mi"), 0);
+}
+
+TEST_F(TestInformationEstimator, compute_forDifferentModelCounts_returnSameSamples){
+    InformationEstimator<RandomGraph> singleEstimator(getMCMCs(1), "meanfield", 5, 1, 5);
+    InformationEstimator<RandomGraph> parallelEstimator(getMCMCs(2), "meanfield", 5, 1, 5);
+    auto singleSamples = singleEstimator.compute(4, 7);
+    auto parallelSamples = parallelEstimator.compute(4, 7);
+    for (const auto& quantity: InformationEstimator<RandomGraph>::getQuantityNames())
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_DOUBLE_EQ(singleSamples.at(quantity)[i], parallelSamples.at(quantity)[i]);
+}
+
+TEST_F(TestInformationEstimator, compute_forExactMethod_returnNonNegativeEntropies){
+    InformationEstimator<RandomGraph> estimator(getMCMCs(2), "exact");
+    auto samples = estimator.compute(4, 3);
+    for (size_t i = 0; i < 4; ++i){
+        EXPECT_GE(samples.at("hgx")[i], -1e-6);
+        EXPECT_GE(samples.at("hx")[i], -1e-6);
+    }
+}
+
+TEST_F(TestInformationEstimator, compute_forClonedModels_returnSameSamplesAsGivenModels){
+    EdgeCountDeltaPrior edgeCountPrior(4);
+    ErdosRenyiFamily randomGraph(5, edgeCountPrior);
+    SISDynamics<RandomGraph> dynamics(randomGraph, 10, 0.5);
+    HingeFlipUniformProposer proposer;
+    GraphReconstructionMCMC<RandomGraph> mcmc(dynamics, proposer);
+    seed(1);
+    dynamics.sample();
+    MultiGraph graph = mcmc.getGraph();
+
+    InformationEstimator<RandomGraph> givenEstimator(getMCMCs(2), "meanfield", 5, 1, 5);
+    InformationEstimator<RandomGraph> clonedEstimator(mcmc, 2, "meanfield", 5, 1, 5);
+    EXPECT_EQ(clonedEstimator.getModelCount(), 2);
+    auto givenSamples = givenEstimator.compute(4, 11);
+    auto clonedSamples = clonedEstimator.compute(4, 11);
+    for (const auto& quantity: InformationEstimator<RandomGraph>::getQuantityNames())
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_DOUBLE_EQ(givenSamples.at(quantity)[i], clonedSamples.at(quantity)[i]);
+    EXPECT_EQ(mcmc.getGraph(), graph);
+}
+
+TEST_F(TestInformationEstimator, constructor_forInvalidMethod_throwLogicError){
+    EXPECT_THROW(InformationEstimator<RandomGraph>(getMCMCs(1), "harmonic"), std::logic_error);
+    EXPECT_THROW(InformationEstimator<RandomGraph>({}), std::logic_error);
+}
+
+}
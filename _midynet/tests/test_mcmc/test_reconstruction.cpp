@@ -6,7 +6,9 @@
 #include "fixtures.hpp"
 #include "FastMIDyNet/dynamics/sis.hpp"
 #include "FastMIDyNet/proposer/edge/hinge_flip.h"
+#include "FastMIDyNet/proposer/edge/labeled_single_edge.h"
 #include "FastMIDyNet/proposer/label/uniform.hpp"
+#include "FastMIDyNet/proposer/label/mixed.hpp"
 #include "FastMIDyNet/mcmc/reconstruction.hpp"
 #include "FastMIDyNet/rng.h"
 
@@ -43,6 +45,38 @@ TEST_F(TestGraphReconstructionMCMC, doMHSweep){
     mcmc.doMHSweep(10);
 }
 
+TEST_F(TestGraphReconstructionMCMC, getProposalStatistics_afterSteps_countEveryStepWhenEnabled){
+    proposer.clearProposalStatistics();
+    for (size_t i = 0; i < 10; ++i)
+        mcmc.doMetropolisHastingsStep();
+    size_t proposed = 0, accepted = 0;
+    for (const auto& counts: proposer.getProposalStatistics()){
+        EXPECT_LE(counts.second.accepted, counts.second.proposed);
+        proposed += counts.second.proposed;
+        accepted += counts.second.accepted;
+    }
+    EXPECT_EQ(proposed, (PROPOSAL_STATS_ENABLED) ? 10 : 0);
+    EXPECT_EQ(proposer.getProposalStatistics().size(), proposer.getMoveCategoryNames().size());
+}
+
+class AdaptingHingeFlipProposer: public HingeFlipUniformProposer{
+public:
+    size_t recordedMoveCount = 0;
+    const bool isAdaptingMoveTypes() const override { return true; }
+    void recordMoveOutcome(bool accepted, uint64_t cycles) override { ++recordedMoveCount; }
+};
+
+TEST_F(TestGraphReconstructionMCMC, doMetropolisHastingsStep_withAdaptingProposer_recordEveryMoveOutcome){
+    AdaptingHingeFlipProposer adaptingProposer;
+    mcmc.setEdgeProposer(adaptingProposer);
+    mcmc.setUp();
+    for (size_t i = 0; i < 10; ++i)
+        mcmc.doMetropolisHastingsStep();
+    EXPECT_EQ(adaptingProposer.recordedMoveCount, 10);
+    mcmc.setEdgeProposer(proposer);
+    mcmc.setUp();
+}
+
 class TestVertexLabeledGraphReconstructionMCMC: public::testing::Test{
     size_t numSteps=10;
 public:
@@ -73,5 +107,61 @@ TEST_F(TestVertexLabeledGraphReconstructionMCMC, doMHSweep){
     mcmc.doMHSweep(10);
 }
 
+TEST_F(TestVertexLabeledGraphReconstructionMCMC, startMoveTypeAdaptation_thenFreeze_sampleLabelProbFixedAfterBurnIn){
+    double minWeight = 0.1;
+    mcmc.startMoveTypeAdaptation(10, minWeight);
+    EXPECT_TRUE(mcmc.isAdaptingMoveTypes());
+    mcmc.doMHSweep(100);
+    double sampleLabelProb = mcmc.getSampleLabelProb();
+    EXPECT_GE(sampleLabelProb, minWeight / 2);
+    EXPECT_LE(sampleLabelProb, 1 - minWeight / 2);
+
+    mcmc.freezeMoveTypeWeights();
+    mcmc.doMHSweep(100);
+    EXPECT_FALSE(mcmc.isAdaptingMoveTypes());
+    EXPECT_EQ(mcmc.getSampleLabelProb(), sampleLabelProb);
+}
+
+class IdentityEdgeProposer: public HingeFlipUniformProposer{
+public:
+    const GraphMove proposeMove() const override { return {{}, {}}; }
+};
+
+TEST_F(TestVertexLabeledGraphReconstructionMCMC, startMoveTypeAdaptation_forIdentityGraphMoves_graphMovesDoNotGainWeight){
+    IdentityEdgeProposer identityEdgeProposer;
+    mcmc.setEdgeProposer(identityEdgeProposer);
+    mcmc.setUp();
+    double sampleLabelProb = mcmc.getSampleLabelProb();
+    mcmc.startMoveTypeAdaptation(10, 0.1);
+    mcmc.doMHSweep(1000);
+    EXPECT_GE(mcmc.getSampleLabelProb(), sampleLabelProb);
+    mcmc.setEdgeProposer(edgeProposer);
+    mcmc.setUp();
+}
+
+TEST_F(TestVertexLabeledGraphReconstructionMCMC, doMHSweep_withLabeledEdgeProposer_followLabelMoves){
+    LabeledSingleEdgeProposer labeledEdgeProposer;
+    mcmc.setEdgeProposer(labeledEdgeProposer);
+    mcmc.setUp();
+    for (size_t i = 0; i < 10; ++i){
+        mcmc.doMHSweep(10);
+        mcmc.checkConsistency();
+    }
+    mcmc.setEdgeProposer(edgeProposer);
+    mcmc.setUp();
+}
+
+TEST_F(TestVertexLabeledGraphReconstructionMCMC, doMHSweep_withMixedLabelProposer_followGraphMoves){
+    GibbsMixedBlockProposer mixedBlockProposer;
+    mcmc.setLabelProposer(mixedBlockProposer);
+    mcmc.setUp();
+    for (size_t i = 0; i < 10; ++i){
+        mcmc.doMHSweep(10);
+        mcmc.checkConsistency();
+    }
+    mcmc.setLabelProposer(blockProposer);
+    mcmc.setUp();
+}
+
 
 } // FastMIDyNet
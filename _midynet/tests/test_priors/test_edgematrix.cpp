@@ -90,6 +90,12 @@ TEST_F(TestEdgeMatrixPrior, applyLabelMoveToState_vertexChangingBlockWithSelfloo
     EXPECT_EQ(prior.getState().getEdgeMultiplicityIdx(0, 1), 5);
     EXPECT_EQ(prior.getState().getEdgeMultiplicityIdx(1, 1), 0);
 }
+
+TEST_F(TestEdgeMatrixPrior, applyLabelMoveToState_withoutGraph_throwSafetyError) {
+    DummyEdgeMatrixPrior unboundPrior = {edgeCountPrior, blockPrior};
+    EXPECT_THROW(unboundPrior.applyLabelMoveToState({0, 0, 1}), SafetyError);
+}
+
 TEST_F(TestEdgeMatrixPrior, checkSelfConsistency_validData_noThrow) {
     EXPECT_NO_THROW(prior.checkSelfConsistency());
 }
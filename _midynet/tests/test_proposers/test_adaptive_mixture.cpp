@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+
+#include "FastMIDyNet/proposer/adaptive_mixture.hpp"
+
+
+namespace FastMIDyNet{
+
+class TestAdaptiveMixture: public ::testing::Test {
+public:
+    AdaptiveMixture mixture = AdaptiveMixture({1, 3});
+};
+
+TEST_F(TestAdaptiveMixture, getWeights_afterConstruction_returnNormalizedWeights) {
+    EXPECT_FLOAT_EQ(mixture.getWeight(0), 0.25);
+    EXPECT_FLOAT_EQ(mixture.getWeight(1), 0.75);
+    EXPECT_FALSE(mixture.isAdapting());
+}
+
+TEST_F(TestAdaptiveMixture, record_whenFrozen_weightsUnchanged) {
+    for (size_t i = 0; i < 5000; ++i)
+        mixture.record(i % 2, i % 2 == 0, 10);
+    EXPECT_FLOAT_EQ(mixture.getWeight(0), 0.25);
+    EXPECT_EQ(mixture.getCounts(0).proposed, 0);
+}
+
+TEST_F(TestAdaptiveMixture, record_whileAdapting_favorMoreAcceptedMovesPerCycle) {
+    double minWeight = 0.1;
+    mixture.startAdaptation(100, minWeight);
+    for (size_t i = 0; i < 1000; ++i){
+        mixture.record(0, true, 10);
+        mixture.record(1, i % 10 == 0, 100);
+    }
+    EXPECT_GT(mixture.getWeight(0), 0.9);
+    EXPECT_GE(mixture.getWeight(1), minWeight / 2);
+    EXPECT_FLOAT_EQ(mixture.getWeight(0) + mixture.getWeight(1), 1);
+
+    mixture.freeze();
+    std::vector<double> frozenWeights = mixture.getWeights();
+    for (size_t i = 0; i < 1000; ++i)
+        mixture.record(1, true, 1);
+    EXPECT_EQ(mixture.getWeights(), frozenWeights);
+}
+
+TEST_F(TestAdaptiveMixture, record_forCheapMovesNeverAccepted_keepFloorWeight) {
+    double minWeight = 0.1;
+    mixture.startAdaptation(100, minWeight);
+    for (size_t i = 0; i < 1000; ++i){
+        mixture.record(0, false, 1);
+        mixture.record(1, i % 10 == 0, 1000);
+    }
+    EXPECT_FLOAT_EQ(mixture.getWeight(0), minWeight / 2);
+}
+
+TEST_F(TestAdaptiveMixture, setWeights_invalidWeights_throwInvalidArgument) {
+    EXPECT_THROW(mixture.setWeights({}), std::invalid_argument);
+    EXPECT_THROW(mixture.setWeights({0, 0}), std::invalid_argument);
+    EXPECT_THROW(mixture.setWeights({-1, 2}), std::invalid_argument);
+    EXPECT_THROW(mixture.startAdaptation(0), std::invalid_argument);
+}
+
+}
@@ -165,5 +165,45 @@ TEST_F(TestDoubleEdgeSwapProposer, getLogProposalProbRatio_forHingeGraphMove_ret
     EXPECT_FLOAT_EQ(proposer.getLogProposalProbRatio(move), log(2) + log(w12 + 1) + log(w33 + 1) - log(w13) - log(w23));
 }
 
+TEST_F(TestDoubleEdgeSwapProposer, getMoveCategory_forEachKindOfMove_returnCorrectCategory) {
+    proposer.setUp(toyGraph);
+    EXPECT_EQ(proposer.getMoveCategory({{{0, 1}, {0, 1}}, {{0, 1}, {0, 1}}}), DoubleEdgeSwapProposer::TRIVIAL);
+    EXPECT_EQ(proposer.getMoveCategory({{{1, 1}, {3, 3}}, {{1, 3}, {1, 3}}}), DoubleEdgeSwapProposer::DOUBLE_LOOPY);
+    EXPECT_EQ(proposer.getMoveCategory({{{1, 1}, {0, 2}}, {{0, 1}, {1, 2}}}), DoubleEdgeSwapProposer::SINGLE_LOOPY);
+    EXPECT_EQ(proposer.getMoveCategory({{{1, 3}, {2, 3}}, {{1, 2}, {3, 3}}}), DoubleEdgeSwapProposer::HINGE);
+    EXPECT_EQ(proposer.getMoveCategory({{{0, 1}, {0, 1}}, {{0, 0}, {1, 1}}}), DoubleEdgeSwapProposer::DOUBLE_EDGE);
+    EXPECT_EQ(proposer.getMoveCategory({{{0, 2}, {1, 3}}, {{0, 1}, {2, 3}}}), DoubleEdgeSwapProposer::NORMAL);
+    EXPECT_EQ(proposer.getMoveCategoryNames().size(), 6);
+}
+
+TEST_F(TestDoubleEdgeSwapProposer, proposeSwapMove_forProposedMoves_carryCategoryAndWeightsOfMove) {
+    proposer.setUp(toyGraph);
+    for (size_t i = 0; i < 100; ++i){
+        auto swapMove = proposer.proposeSwapMove();
+        auto describedMove = proposer.describeMove(swapMove.move);
+        EXPECT_EQ(swapMove.category, proposer.getMoveCategory(swapMove.move));
+        for (size_t k = 0; k < 2 and swapMove.category != DoubleEdgeSwapProposer::TRIVIAL; ++k){
+            EXPECT_EQ(swapMove.removedEdgeWeights[k], toyGraph.getEdgeMultiplicityIdx(swapMove.move.removedEdges[k]));
+            EXPECT_EQ(swapMove.addedEdgeWeights[k], describedMove.addedEdgeWeights[k]);
+        }
+        EXPECT_EQ(proposer.getLogProposalProbRatio(swapMove), proposer.getLogProposalProbRatio(describedMove));
+    }
+}
+
+TEST_F(TestDoubleEdgeSwapProposer, getLogProposalProbRatio_afterApplyingMove_lookUpWeightsAgain) {
+    proposer.setUp(toyGraph);
+    GraphMove move = proposer.proposeRawMove();
+    while (proposer.getMoveCategory(move) == DoubleEdgeSwapProposer::TRIVIAL)
+        move = proposer.proposeRawMove();
+    GraphMove reverseMove = {move.addedEdges, move.removedEdges};
+    double logRatio = proposer.getLogProposalProbRatio(move);
+    for (auto edge : move.removedEdges)
+        toyGraph.removeEdgeIdx(edge);
+    for (auto edge : move.addedEdges)
+        toyGraph.addEdgeIdx(edge);
+    proposer.applyGraphMove(move);
+    EXPECT_EQ(proposer.getLogProposalProbRatio(move), proposer.getLogProposalProbRatio(proposer.describeMove(move)));
+    EXPECT_NEAR(proposer.getLogProposalProbRatio(reverseMove), -logRatio, 1e-6);
+}
 
 }
@@ -64,6 +64,41 @@ TEST_F(TestEdgeSampler, addEdge_addEdgeToSampler){
     EXPECT_EQ(sampler.getTotalWeight(), edgeCount + 1);
 }
 
+TEST_F(TestEdgeSampler, onEdgeInsertion_withWeightAboveHundred_sampleProportionallyToWeight){
+    sampler.onEdgeInsertion({2, 3}, 1000);
+    EXPECT_EQ(sampler.getEdgeWeight({2, 3}), 1000);
+    EXPECT_EQ(sampler.getTotalWeight(), edgeCount + 1000);
+    size_t count = 0;
+    for(size_t i=0; i<1000; ++i)
+        count += (sampler.sample() == BaseGraph::Edge(2, 3));
+    EXPECT_GT(count, 900);
+}
+
+TEST_F(TestEdgeSampler, sampleExcluding_forEdgeOfUnitWeight_neverReturnThatEdge){
+    for(size_t i=0; i<100; ++i){
+        auto edge = sampler.sampleExcluding({1, 0});
+        EXPECT_NE(edge, BaseGraph::Edge(0, 1));
+        EXPECT_GT(graph.getEdgeMultiplicityIdx(edge), 0);
+    }
+    sampler.onEdgeAddition({0, 1});
+    bool sampledExcludedEdge = false;
+    for(size_t i=0; i<100; ++i)
+        sampledExcludedEdge = sampledExcludedEdge or (sampler.sampleExcluding({0, 1}) == BaseGraph::Edge(0, 1));
+    EXPECT_TRUE(sampledExcludedEdge);
+}
 
+TEST_F(TestEdgeSampler, onEdgeErasure_forEveryEdge_keepOtherWeights){
+    sampler.onEdgeAddition({1, 2});
+    double erasedWeight = sampler.onEdgeErasure({0, 2});
+    EXPECT_EQ(erasedWeight, 1);
+    EXPECT_FALSE(sampler.contains({0, 2}));
+    EXPECT_EQ(sampler.getEdgeWeight({1, 2}), 2);
+    EXPECT_EQ(sampler.getTotalWeight(), edgeCount);
+    EXPECT_EQ(sampler.getSize(), 5);
+    for (const auto& edge: sampler.enumerateEdges())
+        sampler.onEdgeErasure(edge);
+    EXPECT_EQ(sampler.getSize(), 0);
+    EXPECT_EQ(sampler.getTotalWeight(), 0);
+}
 
 }
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include "FastMIDyNet/proposer/edge/informed_edge.h"
+#include "FastMIDyNet/proposer/movetypes.h"
+#include "FastMIDyNet/rng.h"
+#include "fixtures.hpp"
+
+
+namespace FastMIDyNet{
+
+class TestInformedEdgeProposer: public::testing::Test {
+public:
+    size_t stepCount = 100;
+    MultiGraph graph = getUndirectedHouseMultiGraph();
+    StateSequence pastStates, futureStates;
+    InformedEdgeProposer proposer = InformedEdgeProposer(true, true, 2, 0.1, 1);
+    void SetUp() {
+        /* vertex 0 is always active and vertex 1 every other step; vertex 2 activates
+         * at every step and vertex 4 every fourth step */
+        pastStates.assign(graph.getSize(), State(stepCount, 0));
+        futureStates.assign(graph.getSize(), State(stepCount, 0));
+        for (size_t t = 0; t < stepCount; ++t){
+            pastStates[0][t] = futureStates[0][t] = 1;
+            pastStates[1][t] = futureStates[1][t] = t % 2 == 0;
+            futureStates[2][t] = 1;
+            futureStates[4][t] = t % 4 == 0;
+        }
+        seed(42);
+        proposer.setUpStates(pastStates, futureStates);
+        proposer.setUp(graph);
+    }
+    void TearDown() {
+        proposer.checkConsistency();
+    }
+    void applyGraphMove(const GraphMove& move){
+        for (auto edge: move.removedEdges)
+            graph.removeEdgeIdx(edge.first, edge.second);
+        for (auto edge: move.addedEdges)
+            graph.addEdgeIdx(edge.first, edge.second);
+        proposer.applyGraphMove(move);
+    }
+};
+
+TEST_F(TestInformedEdgeProposer, computeCandidateNeighbors_forCorrelatedVertices_rankByCoactivation) {
+    auto candidates = InformedEdgeProposer::computeCandidateNeighbors(pastStates, futureStates, 2, 1);
+    ASSERT_EQ(candidates.size(), graph.getSize());
+    ASSERT_EQ(candidates[0].size(), 2);
+    EXPECT_EQ(candidates[0][0].first, 2);
+    EXPECT_EQ(candidates[0][0].second, stepCount);
+    EXPECT_EQ(candidates[0][1].first, 4);
+    EXPECT_EQ(candidates[0][1].second, stepCount / 4);
+    ASSERT_EQ(candidates[2].size(), 2);
+    EXPECT_EQ(candidates[2][0].first, 0);
+    EXPECT_EQ(candidates[2][1].first, 1);
+    EXPECT_EQ(candidates[2][1].second, stepCount / 2);
+    EXPECT_EQ(candidates[3].size(), 0);
+
+    auto parallelCandidates = InformedEdgeProposer::computeCandidateNeighbors(pastStates, futureStates, 2, 4);
+    EXPECT_EQ(parallelCandidates, candidates);
+}
+
+TEST_F(TestInformedEdgeProposer, proposeMove_withoutUniformProposals_addOnlyCandidateEdges) {
+    InformedEdgeProposer informedProposer(true, true, 2, 0, 1);
+    informedProposer.setUpStates(pastStates, futureStates);
+    informedProposer.setUp(graph);
+    for (size_t i = 0; i < 1000; ++i){
+        auto move = informedProposer.proposeMove();
+        for (auto edge: move.addedEdges)
+            EXPECT_GT(informedProposer.getCandidateSampler().getEdgeWeight(edge), 0);
+        for (auto edge: move.removedEdges)
+            EXPECT_GT(graph.getEdgeMultiplicityIdx(edge), 0);
+    }
+}
+
+TEST_F(TestInformedEdgeProposer, getLogProposalProbRatio_forAdditionThenRemoval_ratiosAreOpposite) {
+    for (BaseGraph::Edge edge: std::vector<BaseGraph::Edge>({{0, 2}, {0, 4}, {5, 6}, {3, 3}})){
+        GraphMove addition = {{}, {edge}};
+        double logRatio = proposer.getLogProposalProbRatio(addition);
+        applyGraphMove(addition);
+        GraphMove removal = {{edge}, {}};
+        EXPECT_NEAR(proposer.getLogProposalProbRatio(removal), -logRatio, 1e-10);
+    }
+}
+
+TEST_F(TestInformedEdgeProposer, proposeMove_withoutMultiedges_proposeIdentityForExistingEdges) {
+    InformedEdgeProposer simpleProposer(true, false, 2, 1, 1);
+    simpleProposer.setUp(graph);
+    for (size_t i = 0; i < 1000; ++i){
+        auto move = simpleProposer.proposeMove();
+        for (auto edge: move.addedEdges)
+            EXPECT_EQ(graph.getEdgeMultiplicityIdx(edge), 0);
+    }
+}
+
+}
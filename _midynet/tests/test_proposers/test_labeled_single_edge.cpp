@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include <cmath>
+
+#include "FastMIDyNet/proposer/edge/labeled_single_edge.h"
+#include "FastMIDyNet/proposer/movetypes.h"
+#include "FastMIDyNet/rng.h"
+#include "fixtures.hpp"
+
+
+namespace FastMIDyNet{
+
+class TestLabeledSingleEdgeProposer: public::testing::Test {
+public:
+    double shift = 0.5;
+    DummySBMGraph graphPrior = DummySBMGraph(20);
+    LabeledSingleEdgeProposer proposer = LabeledSingleEdgeProposer(true, true, shift);
+    void SetUp() {
+        seed(42);
+        graphPrior.sample();
+        proposer.setUpLabels(graphPrior);
+        proposer.setUp(graphPrior.getGraph());
+        proposer.checkSafety();
+    }
+    void TearDown() {
+        proposer.checkConsistency();
+    }
+    void applyGraphMove(const GraphMove& move){
+        graphPrior.applyGraphMove(move);
+        proposer.applyGraphMove(move);
+    }
+    void applyLabelMove(const BlockMove& move){
+        graphPrior.applyLabelMove(move);
+        proposer.applyLabelMove(move);
+    }
+};
+
+TEST_F(TestLabeledSingleEdgeProposer, setUp_withoutLabels_throwLogicError) {
+    LabeledSingleEdgeProposer unlabeledProposer;
+    EXPECT_THROW(unlabeledProposer.setUp(graphPrior.getGraph()), std::logic_error);
+}
+
+TEST_F(TestLabeledSingleEdgeProposer, getLabelPairWeight_forEveryLabelPair_sumToTotalWeight) {
+    const auto& graph = graphPrior.getGraph();
+    double totalWeight = 0;
+    for (BlockIndex r = 0; r < graphPrior.getLabelCount(); ++r){
+        for (BlockIndex s = r; s < graphPrior.getLabelCount(); ++s){
+            double edgeCount = 0;
+            for (auto vertex: graph)
+                for (auto neighbor: graph.getNeighboursOfIdx(vertex))
+                    if (vertex <= neighbor.vertexIndex and ((graphPrior.getLabelOfIdx(vertex) == r and graphPrior.getLabelOfIdx(neighbor.vertexIndex) == s)
+                            or (graphPrior.getLabelOfIdx(vertex) == s and graphPrior.getLabelOfIdx(neighbor.vertexIndex) == r)))
+                        edgeCount += neighbor.label;
+            double vertexPairCount = proposer.getLabelSize(r) * proposer.getLabelSize(s) * ((r == s) ? 1. : 2.);
+            EXPECT_EQ(proposer.getLabelPairWeight(r, s), edgeCount + shift * vertexPairCount);
+            totalWeight += proposer.getLabelPairWeight(r, s);
+        }
+    }
+    EXPECT_DOUBLE_EQ(totalWeight, proposer.getTotalLabelPairWeight());
+}
+
+TEST_F(TestLabeledSingleEdgeProposer, getLogProposalProbRatio_forProposedMoves_equalMinusReverseRatio) {
+    for (size_t i = 0; i < 100; ++i){
+        auto move = proposer.proposeMove();
+        double logRatio = proposer.getLogProposalProbRatio(move);
+        applyGraphMove(move);
+        GraphMove reverseMove = {move.addedEdges, move.removedEdges};
+        EXPECT_NEAR(logRatio, -proposer.getLogProposalProbRatio(reverseMove), 1e-6);
+    }
+}
+
+TEST_F(TestLabeledSingleEdgeProposer, proposeMove_forAdditions_sampleWithAdditionProb) {
+    /* the frequency of the proposed label pairs must follow their weights */
+    size_t sampleSize = 20000;
+    std::map<LabelPair, double> counts;
+    size_t additionCount = 0;
+    for (size_t i = 0; i < sampleSize; ++i){
+        auto move = proposer.proposeMove();
+        if (move.addedEdges.size() == 0)
+            continue;
+        auto edge = move.addedEdges[0];
+        BlockIndex r = graphPrior.getLabelOfIdx(edge.first), s = graphPrior.getLabelOfIdx(edge.second);
+        ++counts[{std::min(r, s), std::max(r, s)}];
+        ++additionCount;
+    }
+    for (const auto& count: counts){
+        double prob = proposer.getLabelPairWeight(count.first.first, count.first.second) / proposer.getTotalLabelPairWeight();
+        EXPECT_NEAR(count.second / additionCount, prob, 4 * sqrt(prob * (1 - prob) / additionCount));
+    }
+}
+
+TEST_F(TestLabeledSingleEdgeProposer, applyLabelMove_forSomeLabelMoves_sampleVerticesWithNewLabels) {
+    for (BaseGraph::VertexIndex vertex = 0; vertex < 5; ++vertex){
+        BlockIndex prevLabel = graphPrior.getLabelOfIdx(vertex);
+        BlockIndex nextLabel = (prevLabel + 1) % graphPrior.getLabelCount();
+        applyLabelMove({vertex, prevLabel, nextLabel});
+        proposer.checkConsistency();
+    }
+    for (BlockIndex r = 0; r < graphPrior.getLabelCount(); ++r)
+        for (size_t i = 0; i < 10 and proposer.getLabelSize(r) > 0; ++i)
+            EXPECT_EQ(graphPrior.getLabelOfIdx(proposer.sampleVertexWithLabel(r)), r);
+    for (size_t i = 0; i < 10; ++i){
+        auto move = proposer.proposeMove();
+        double logRatio = proposer.getLogProposalProbRatio(move);
+        applyGraphMove(move);
+        EXPECT_NEAR(logRatio, -proposer.getLogProposalProbRatio({move.addedEdges, move.removedEdges}), 1e-6);
+    }
+}
+
+}
@@ -72,6 +72,18 @@ TEST_F(TestGibbsMixedBlockProposer, getLogProposalProb_forLabelMoveAddingNewLabe
     EXPECT_EQ(logProb, revLogProb);
 }
 
+TEST_F(TestGibbsMixedBlockProposer, applyGraphMove_forSomeEdges_keepSamplerConsistent){
+    const auto& graph = graphPrior.getGraph();
+    BaseGraph::VertexIndex vertex = 0;
+    while (graph.getNeighboursOfIdx(vertex).size() == 0)
+        ++vertex;
+    BaseGraph::Edge removedEdge = {vertex, graph.getNeighboursOfIdx(vertex).begin()->vertexIndex};
+    GraphMove move = {{removedEdge}, {{0, 1}, {2, 2}, {3, 4}}};
+    graphPrior.applyGraphMove(move);
+    proposer.applyGraphMove(move);
+    proposer.checkConsistency();
+}
+
 class TestRestrictedMixedBlockProposer: public::testing::Test{
 public:
     double SAMPLE_LABEL_PROB=0.1, LABEL_CREATION_PROB=0.5, SHIFT=1;
@@ -134,4 +146,16 @@ TEST_F(TestRestrictedMixedBlockProposer, getLogProposalProb_forLabelMoveAddingNe
     EXPECT_EQ(logProb, revLogProb);
 }
 
+TEST_F(TestRestrictedMixedBlockProposer, proposeLabelMove_forManySamples_followLogProposalProb){
+    size_t sampleSize = 20000;
+    std::map<BlockIndex, double> counts;
+    for (size_t i = 0; i < sampleSize; ++i)
+        ++counts[proposer.proposeLabelMove(0).nextLabel];
+    for (const auto& count : counts){
+        LabelMove<BlockIndex> move = {0, graphPrior.getLabelOfIdx(0), count.first};
+        double prob = exp(proposer.getLogProposalProb(move)) / (1 - SAMPLE_LABEL_PROB);
+        EXPECT_NEAR(count.second / sampleSize, prob, 4 * sqrt(prob * (1 - prob) / sampleSize));
+    }
+}
+
 }
@@ -69,6 +69,31 @@ TEST_F(TestMultipleMoveProposer, proposeMove_biasedMoveChoice_averageMoveChoiceI
     EXPECT_NEAR(averageMoveChoice/randomGenerationsNumber, p, 1e-2);
 }
 
+TEST_F(TestMultipleMoveProposer, recordMoveOutcome_duringAndAfterAdaptation_weightsOnlyChangeDuringAdaptation) {
+    FastMIDyNet::rng.seed(3012);
+    FastMIDyNet::Proposer<DummyMove>& baseProposer = proposer;
+    /* only the moves of the second proposer are accepted, as in a MH step */
+    auto doSteps = [&](size_t stepCount){
+        for (size_t i=0; i<stepCount; i++) {
+            DummyMove move = baseProposer.proposeMove();
+            FastMIDyNet::ProposalRecord record = baseProposer.startProposalRecord(move);
+            baseProposer.stopProposalRecord(record, move);
+            if (baseProposer.isAdaptingMoveTypes())
+                baseProposer.recordMoveOutcome(move, FastMIDyNet::readCycleCounter() - record.startCycle);
+        }
+    };
+    proposer.startMoveTypeAdaptation(100, 0.1);
+    EXPECT_TRUE(baseProposer.isAdaptingMoveTypes());
+    doSteps(1000);
+    std::vector<double> adaptedWeights = proposer.getMoveWeights();
+    EXPECT_GT(adaptedWeights[1], p);
+
+    proposer.freezeMoveTypeWeights();
+    EXPECT_FALSE(baseProposer.isAdaptingMoveTypes());
+    doSteps(1000);
+    EXPECT_EQ(proposer.getMoveWeights(), adaptedWeights);
+}
+
 // TEST_F(TestMultipleMoveProposer, getProposalProb_biasedMoveChoice_averageProbabilityIsBiased) {
 //     FastMIDyNet::rng.seed(3012);
 //     double averageProbability=0;
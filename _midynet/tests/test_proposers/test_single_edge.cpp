@@ -5,6 +5,7 @@
 #include "FastMIDyNet/proposer/edge/single_edge.h"
 #include "FastMIDyNet/proposer/movetypes.h"
 #include "FastMIDyNet/utility/functions.h"
+#include "FastMIDyNet/rng.h"
 #include "fixtures.hpp"
 
 namespace FastMIDyNet{
@@ -95,4 +96,75 @@ TEST_F(TestSingleEdgeDegreeProposer, getLogProposalProbRatio_removeEdgeWithMulti
     // proposer.applyGraphMove(move);
 }
 
+class TestSingleEdgeSimpleProposer: public::testing::Test {
+    public:
+        SingleEdgeSimpleProposer proposer;
+        MultiGraph graph = MultiGraph(10);
+        void SetUp() {
+            seed(42);
+            graph.addEdgeIdx(0, 1);
+            graph.addEdgeIdx(0, 2);
+            graph.addEdgeIdx(3, 4);
+            proposer.setUp(graph);
+            proposer.checkSafety();
+        }
+        void TearDown() {
+            proposer.checkConsistency();
+        }
+        void applyGraphMove(const GraphMove& move){
+            for (auto edge: move.removedEdges)
+                graph.removeEdgeIdx(edge);
+            for (auto edge: move.addedEdges)
+                graph.addEdgeIdx(edge);
+            proposer.applyGraphMove(move);
+        }
+};
+
+TEST_F(TestSingleEdgeSimpleProposer, getPair_forEveryPairIndex_returnPairWithSameIndex) {
+    EXPECT_EQ(proposer.getPairCount(), 45);
+    for (size_t pairIndex = 0; pairIndex < proposer.getPairCount(); ++pairIndex){
+        auto edge = proposer.getPair(pairIndex);
+        EXPECT_LT(edge.first, edge.second);
+        EXPECT_EQ(proposer.getPairIndex(edge), pairIndex);
+    }
+    SingleEdgeSimpleProposer selfLoopProposer(true);
+    selfLoopProposer.setUp(graph);
+    EXPECT_EQ(selfLoopProposer.getPairCount(), 55);
+    for (size_t pairIndex = 0; pairIndex < selfLoopProposer.getPairCount(); ++pairIndex)
+        EXPECT_EQ(selfLoopProposer.getPairIndex(selfLoopProposer.getPair(pairIndex)), pairIndex);
+}
+
+TEST_F(TestSingleEdgeSimpleProposer, proposeMove_forManyMoves_keepGraphSimple) {
+    for (size_t i = 0; i < 1000; ++i){
+        auto move = proposer.proposeMove();
+        for (auto edge: move.addedEdges){
+            EXPECT_NE(edge.first, edge.second);
+            EXPECT_EQ(graph.getEdgeMultiplicityIdx(edge), 0);
+        }
+        for (auto edge: move.removedEdges)
+            EXPECT_EQ(graph.getEdgeMultiplicityIdx(edge), 1);
+        applyGraphMove(move);
+    }
+    EXPECT_EQ(proposer.getEdgeCount(), graph.getTotalEdgeNumber());
+}
+
+TEST_F(TestSingleEdgeSimpleProposer, getLogProposalProbRatio_forProposedMoves_equalMinusReverseRatio) {
+    for (size_t i = 0; i < 100; ++i){
+        auto move = proposer.proposeMove();
+        double logRatio = proposer.getLogProposalProbRatio(move);
+        applyGraphMove(move);
+        EXPECT_NEAR(logRatio, -proposer.getLogProposalProbRatio({move.addedEdges, move.removedEdges}), 1e-6);
+    }
+}
+
+TEST_F(TestSingleEdgeSimpleProposer, setUp_forMultigraph_throwLogicError) {
+    graph.addEdgeIdx(0, 1);
+    EXPECT_THROW(proposer.setUp(graph), std::logic_error);
+    graph.removeEdgeIdx(0, 1);
+    graph.addEdgeIdx(5, 5);
+    EXPECT_THROW(proposer.setUp(graph), std::logic_error);
+    graph.removeEdgeIdx(5, 5);
+    proposer.setUp(graph);
+}
+
 }
@@ -61,6 +61,32 @@ TEST_F(TestVertexUniformSampler, getTotalWeight_returnSizeOfVertexSet){
 
 }
 
+TEST_F(TestVertexUniformSampler, onVertexErasure_forSomeVertices_sampleOnlyRemainingVertices){
+    for (BaseGraph::VertexIndex vertex: {0, 9, 4})
+        sampler.onVertexErasure(vertex);
+    EXPECT_EQ(sampler.getSize(), 7);
+    EXPECT_FALSE(sampler.contains(4));
+    EXPECT_EQ(sampler.getVertexWeight(4), 0);
+    EXPECT_THROW(sampler.onVertexErasure(4), std::logic_error);
+    for (size_t i=0; i<100; ++i){
+        auto vertex = sampler.sample();
+        EXPECT_TRUE(sampler.contains(vertex));
+        EXPECT_NE(vertex, 0);
+        EXPECT_NE(vertex, 9);
+        EXPECT_NE(vertex, 4);
+    }
+    sampler.onVertexInsertion(4);
+    EXPECT_TRUE(sampler.contains(4));
+    EXPECT_EQ(sampler.getSize(), 8);
+}
+
+TEST_F(TestVertexUniformSampler, sample_afterErasingEveryVertex_throwLogicError){
+    for (BaseGraph::VertexIndex vertex=0; vertex<10; ++vertex)
+        sampler.onVertexErasure(vertex);
+    EXPECT_EQ(sampler.getSize(), 0);
+    EXPECT_THROW(sampler.sample(), std::logic_error);
+}
+
 class TestVertexDegreeSampler: public ::testing::Test{
 public:
     double shift = 3;
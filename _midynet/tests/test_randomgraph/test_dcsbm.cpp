@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <list>
+#include <memory>
 #include <algorithm>
 #include <string>
 
@@ -300,3 +301,39 @@ TEST_F(TestDegreeCorrectedStochasticBlockModelFamily, isCompatible_forGraphWithO
     }
     EXPECT_FALSE(randomGraph.isCompatible(g));
 }
+
+TEST_F(TestDegreeCorrectedStochasticBlockModelFamily, getCompatibilityTracker_afterGraphMoves_followIsCompatible){
+    auto graph = randomGraph.getGraph();
+    std::unique_ptr<FastMIDyNet::GraphCompatibilityTracker> tracker(randomGraph.getCompatibilityTracker());
+    tracker->setGraph(graph);
+    EXPECT_TRUE(tracker->isCompatible());
+
+    FastMIDyNet::GraphMove move = {{findEdge()}, {{0, 2}}};
+    tracker->applyGraphMove(move);
+    graph.removeEdgeIdx(move.removedEdges[0]);
+    graph.addEdgeIdx(move.addedEdges[0]);
+    EXPECT_EQ(tracker->isCompatible(), randomGraph.isCompatible(graph));
+
+    tracker->applyGraphMove({move.addedEdges, move.removedEdges});
+    EXPECT_TRUE(tracker->isCompatible());
+
+    tracker->setGraph(MultiGraph(0));
+    EXPECT_FALSE(tracker->isCompatible());
+}
+
+TEST_F(TestDegreeCorrectedStochasticBlockModelFamily, getLogJoint_afterAppliedMoves_returnSameValueAsRecomputed){
+    randomGraph.getLogJoint();
+    for (size_t i = 0; i < 10; ++i){
+        FastMIDyNet::GraphMove graphMove = {{findEdge()}, {{0, 2}}};
+        randomGraph.getLogJointRatioFromGraphMove(graphMove);
+        randomGraph.applyGraphMove(graphMove);
+    }
+    FastMIDyNet::BlockMove blockMove = {vertexIdx, randomGraph.getLabelOfIdx(vertexIdx), findBlockMove(vertexIdx)};
+    randomGraph.getLogJointRatioFromLabelMove(blockMove);
+    randomGraph.applyLabelMove(blockMove);
+
+    double cachedLogJoint = randomGraph.getLogJoint();
+    blockCountPrior.invalidateCaches();
+    edgeCountPrior.invalidateCaches();
+    EXPECT_NEAR(cachedLogJoint, randomGraph.getLogJoint(), 1E-6);
+}
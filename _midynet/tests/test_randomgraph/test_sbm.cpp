@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <list>
+#include <memory>
 #include <algorithm>
 #include <string>
 
@@ -292,6 +293,25 @@ TEST_F(TestStochasticBlockModelFamily, isCompatible_forGraphWithOneEdgeMissing_r
     EXPECT_FALSE(randomGraph.isCompatible(g));
 }
 
+TEST_F(TestStochasticBlockModelFamily, getCompatibilityTracker_afterGraphMoves_followIsCompatible){
+    auto graph = randomGraph.getGraph();
+    std::unique_ptr<FastMIDyNet::GraphCompatibilityTracker> tracker(randomGraph.getCompatibilityTracker());
+    tracker->setGraph(graph);
+    EXPECT_TRUE(tracker->isCompatible());
+
+    FastMIDyNet::GraphMove move = {{findEdge()}, {{0, 2}}};
+    tracker->applyGraphMove(move);
+    graph.removeEdgeIdx(move.removedEdges[0]);
+    graph.addEdgeIdx(move.addedEdges[0]);
+    EXPECT_EQ(tracker->isCompatible(), randomGraph.isCompatible(graph));
+
+    tracker->applyGraphMove({move.addedEdges, move.removedEdges});
+    EXPECT_TRUE(tracker->isCompatible());
+
+    tracker->setGraph(MultiGraph(0));
+    EXPECT_FALSE(tracker->isCompatible());
+}
+
 
 TEST_F(TestStochasticBlockModelFamily, setLabels_forSomeRandomLabels_returnConsistentState){
     size_t N = randomGraph.getSize();
@@ -304,3 +324,29 @@ TEST_F(TestStochasticBlockModelFamily, setLabels_forSomeRandomLabels_returnConsi
     EXPECT_EQ(randomGraph.getLabels(), newLabels);
     EXPECT_NO_THROW(randomGraph.checkConsistency());
 }
+
+TEST_F(TestStochasticBlockModelFamily, getLogJoint_afterAppliedMoves_returnSameValueAsRecomputed){
+    randomGraph.getLogJoint();
+    for (size_t i = 0; i < 10; ++i){
+        FastMIDyNet::GraphMove graphMove = {{findEdge()}, {{0, 2}}};
+        randomGraph.getLogJointRatioFromGraphMove(graphMove);
+        randomGraph.applyGraphMove(graphMove);
+    }
+    FastMIDyNet::BlockMove blockMove = {vertex, randomGraph.getLabelOfIdx(vertex), findBlockMove(vertex)};
+    randomGraph.getLogJointRatioFromLabelMove(blockMove);
+    randomGraph.applyLabelMove(blockMove);
+
+    double cachedLogJoint = randomGraph.getLogJoint();
+    blockCountPrior.invalidateCaches();
+    edgeCountPrior.invalidateCaches();
+    EXPECT_NEAR(cachedLogJoint, randomGraph.getLogJoint(), 1E-6);
+}
+
+TEST_F(TestStochasticBlockModelFamily, getCacheEpoch_afterInvalidatingCaches_increaseOnlyForDependentModel){
+    BlockCountPoissonPrior otherBlockCountPrior = {NUM_BLOCKS};
+    size_t epoch = randomGraph.getCacheEpoch();
+    otherBlockCountPrior.invalidateCaches();
+    EXPECT_EQ(randomGraph.getCacheEpoch(), epoch);
+    blockCountPrior.invalidateCaches();
+    EXPECT_GT(randomGraph.getCacheEpoch(), epoch);
+}
@@ -0,0 +1,124 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/edge_marginals.h"
+
+
+namespace FastMIDyNet{
+
+TEST(TestEdgeMarginalAccumulator, advance_forChangingMultiplicities_creditElapsedTime){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    marginals.advance(2);
+    marginals.setMultiplicity({0, 1}, 2);
+    marginals.advance(3);
+    marginals.setMultiplicity({0, 1}, 0);
+    marginals.advance(5);
+    EXPECT_DOUBLE_EQ(marginals.getTime(), 10);
+    EXPECT_DOUBLE_EQ(marginals.getWeight({0, 1}, 0), 5);
+    EXPECT_DOUBLE_EQ(marginals.getWeight({0, 1}, 1), 2);
+    EXPECT_DOUBLE_EQ(marginals.getWeight({0, 1}, 2), 3);
+    EXPECT_DOUBLE_EQ(marginals.getProb({0, 1}, 2), 0.3);
+    EXPECT_EQ(marginals.getMaxObservedMultiplicity({0, 1}), 2);
+}
+
+TEST(TestEdgeMarginalAccumulator, getWeight_forCurrentMultiplicity_includePendingTime){
+    EdgeMarginalAccumulator marginals;
+    marginals.advance(1);
+    marginals.addMultiplicity({2, 3}, 1);
+    marginals.advance(4);
+    EXPECT_DOUBLE_EQ(marginals.getWeight({2, 3}, 1), 4);
+    EXPECT_DOUBLE_EQ(marginals.getWeight({2, 3}, 0), 1);
+    EXPECT_EQ(marginals.getTotalMultiplicity(), 1);
+}
+
+TEST(TestEdgeMarginalAccumulator, setMultiplicity_aboveHistogramWidth_storeOverflowWeights){
+    EdgeMarginalAccumulator marginals;
+    size_t multiplicity = EdgeMarginalAccumulator::HISTOGRAM_WIDTH + 3;
+    marginals.setMultiplicity({0, 0}, multiplicity);
+    marginals.advance(2);
+    marginals.setMultiplicity({0, 0}, 1);
+    marginals.advance(2);
+    EXPECT_DOUBLE_EQ(marginals.getProb({0, 0}, multiplicity), 0.5);
+    EXPECT_DOUBLE_EQ(marginals.getProb({0, 0}, multiplicity + 1), 0);
+    EXPECT_EQ(marginals.getMaxObservedMultiplicity(), multiplicity);
+}
+
+TEST(TestEdgeMarginalAccumulator, addMultiplicity_belowZero_throwLogicError){
+    EdgeMarginalAccumulator marginals;
+    EXPECT_THROW(marginals.addMultiplicity({0, 1}, -1), std::logic_error);
+}
+
+TEST(TestEdgeMarginalAccumulator, setMultiplicity_forManyEdges_keepEveryHistogram){
+    EdgeMarginalAccumulator marginals(2);
+    for (size_t i = 0; i < 100; ++i)
+        marginals.setMultiplicity({i, i + 1}, 1 + i % 3);
+    marginals.advance();
+    EXPECT_EQ(marginals.size(), 100);
+    for (size_t i = 0; i < 100; ++i)
+        EXPECT_DOUBLE_EQ(marginals.getProb({i, i + 1}, 1 + i % 3), 1);
+    EXPECT_DOUBLE_EQ(marginals.getProb({0, 2}, 0), 1);
+}
+
+TEST(TestEdgeMarginalAccumulator, getObservedEdges_forEdgeRemovedBeforeAdvance_ignoreEdge){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    marginals.setMultiplicity({1, 2}, 1);
+    marginals.setMultiplicity({0, 1}, 0);
+    marginals.advance();
+    EXPECT_EQ(marginals.getObservedEdges(), std::vector<BaseGraph::Edge>({{1, 2}}));
+    EXPECT_FALSE(marginals.isObserved({0, 1}));
+    EXPECT_EQ(marginals.size(), 2);
+}
+
+TEST(TestEdgeMarginalAccumulator, setGraph_forDifferentGraph_setEveryMultiplicity){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    MultiGraph graph(4);
+    graph.addEdgeIdx(1, 2);
+    graph.addEdgeIdx(2, 3);
+    graph.addEdgeIdx(2, 3);
+    marginals.setGraph(graph);
+    EXPECT_EQ(marginals.getMultiplicity({0, 1}), 0);
+    EXPECT_EQ(marginals.getMultiplicity({1, 2}), 1);
+    EXPECT_EQ(marginals.getMultiplicity({2, 3}), 2);
+    EXPECT_EQ(marginals.getTotalMultiplicity(), 3);
+}
+
+TEST(TestEdgeMarginalAccumulator, getProbs_forObservedEdges_writeRowsInOrder){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    marginals.advance();
+    marginals.setMultiplicity({0, 1}, 0);
+    marginals.setMultiplicity({1, 2}, 2);
+    marginals.advance();
+    std::vector<double> probs(6);
+    marginals.getProbs(probs.data(), 3);
+    EXPECT_EQ(probs, std::vector<double>({0.5, 0.5, 0, 0.5, 0, 0.5}));
+    EXPECT_DOUBLE_EQ(marginals.getEntropy(), 2 * log(2));
+}
+
+TEST(TestEdgeMarginalAccumulator, getLogProb_forGraph_sumLogMarginalsOfObservedEdges){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    marginals.advance(3);
+    marginals.setMultiplicity({0, 1}, 0);
+    marginals.advance(1);
+    MultiGraph graph(3);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(1, 2);
+    EXPECT_DOUBLE_EQ(marginals.getLogProb(graph), log(0.75));
+}
+
+TEST(TestEdgeMarginalAccumulator, clear_afterAdvance_resetHistograms){
+    EdgeMarginalAccumulator marginals;
+    marginals.setMultiplicity({0, 1}, 1);
+    marginals.advance();
+    marginals.clear();
+    EXPECT_EQ(marginals.size(), 0);
+    EXPECT_DOUBLE_EQ(marginals.getTime(), 0);
+    EXPECT_EQ(marginals.getMultiplicity({0, 1}), 0);
+}
+
+}
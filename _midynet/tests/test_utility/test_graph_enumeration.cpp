@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "FastMIDyNet/utility/graph_enumeration.h"
+
+namespace FastMIDyNet{
+
+template<typename GrayCode>
+void expectValidGrayCode(size_t total, size_t slotCount){
+    GrayCode grayCode(total, slotCount);
+    std::set<std::vector<size_t>> visited = {grayCode.getState()};
+    size_t decrementedSlot, incrementedSlot;
+    while (grayCode.next(decrementedSlot, incrementedSlot)){
+        auto state = grayCode.getState();
+        EXPECT_TRUE(visited.count(state) == 0);
+        visited.insert(state);
+
+        // the transition is a single unit moved between two slots
+        EXPECT_NE(decrementedSlot, incrementedSlot);
+        ++state[decrementedSlot];
+        --state[incrementedSlot];
+        EXPECT_TRUE(visited.count(state) == 1);
+
+        // starting from the rank reaches the same state
+        EXPECT_EQ(GrayCode(total, slotCount, grayCode.getRank()).getState(), grayCode.getState());
+    }
+    EXPECT_EQ(visited.size(), grayCode.getStateCount());
+    EXPECT_EQ(grayCode.getRank() + 1, grayCode.getStateCount());
+}
+
+TEST(TestCompositionGrayCode, next_forAllCompositions_visitEachOnceBySingleUnitMoves){
+    for (size_t slotCount: {1, 2, 3, 5})
+        for (size_t total: {0, 1, 2, 4})
+            expectValidGrayCode<CompositionGrayCode>(total, slotCount);
+}
+
+TEST(TestCombinationGrayCode, next_forAllCombinations_visitEachOnceBySingleSwaps){
+    for (size_t slotCount: {1, 2, 5, 6, 7})
+        for (size_t total = 0; total <= slotCount; ++total)
+            expectValidGrayCode<CombinationGrayCode>(total, slotCount);
+}
+
+TEST(TestBinomialCoefficient, getBinomialCoefficient_forLargestFittingCoefficient_returnExactValue){
+    EXPECT_EQ(getBinomialCoefficient(66, 33), 7219428434016265740ULL);
+    EXPECT_EQ(getBinomialCoefficient(66, 0), 1);
+    EXPECT_EQ(getBinomialCoefficient(3, 4), 0);
+}
+
+TEST(TestBinomialCoefficient, getBinomialCoefficient_forOverflowingCoefficient_throwOverflowError){
+    EXPECT_THROW(getBinomialCoefficient(68, 34), std::overflow_error);
+    EXPECT_THROW(GraphEnumerator::getGraphCount(50, 40), std::overflow_error);
+}
+
+TEST(TestGraphEnumerator, next_forMultigraphs_enumerateAllGraphsWithEdgeCount){
+    GraphEnumerator enumerator(4, 3, true, true);
+    MultiGraph graph = enumerator.getGraph();
+    size_t graphCount = 1;
+    GraphMove move;
+    while (enumerator.next(move)){
+        ++graphCount;
+        EXPECT_EQ(move.removedEdges.size(), 1);
+        EXPECT_EQ(move.addedEdges.size(), 1);
+        graph.removeEdgeIdx(move.removedEdges[0].first, move.removedEdges[0].second);
+        graph.addEdgeIdx(move.addedEdges[0].first, move.addedEdges[0].second);
+        EXPECT_EQ(graph, enumerator.getGraph());
+    }
+    EXPECT_EQ(graphCount, GraphEnumerator::getGraphCount(4, 3, true, true));
+    EXPECT_EQ(graphCount, 220);
+}
+
+TEST(TestGraphEnumerator, next_forRankRange_enumerateOnlyRange){
+    GraphEnumerator enumerator(5, 3, false, false, 10, 20);
+    size_t graphCount = 1;
+    GraphMove move;
+    while (enumerator.next(move))
+        ++graphCount;
+    EXPECT_EQ(graphCount, 10);
+    EXPECT_EQ(enumerator.getRank(), 19);
+}
+
+}
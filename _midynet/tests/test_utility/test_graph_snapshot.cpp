@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include <vector>
+
+#include "FastMIDyNet/utility/graph_snapshot.h"
+#include "FastMIDyNet/generators.h"
+#include "FastMIDyNet/rng.h"
+
+namespace FastMIDyNet{
+
+class TestGraphSnapshot: public::testing::Test{
+public:
+    std::vector<MultiGraph> graphs;
+    void SetUp(){
+        seed(42);
+        for (size_t i = 0; i < 20; ++i)
+            graphs.push_back(generateCM({4, 6, 2, 1, 0, 3, 8, 2, 130, 2}));
+        graphs.push_back(MultiGraph(10));
+        graphs.push_back(generateCM({4, 6, 2, 1, 0, 3, 8, 2, 130, 2}));
+    }
+};
+
+TEST_F(TestGraphSnapshot, getGraph_forMultigraphWithSelfLoops_returnSameGraph){
+    for (const auto& graph: graphs){
+        GraphSnapshot snapshot(graph);
+        EXPECT_EQ(snapshot.getGraph(), graph);
+        EXPECT_EQ(snapshot.getSize(), graph.getSize());
+        EXPECT_EQ(snapshot.getEdgeCount(), graph.getTotalEdgeNumber());
+    }
+}
+
+TEST_F(TestGraphSnapshot, getGraphs_forManyKeyframePeriods_returnPushedGraphs){
+    for (size_t keyframePeriod: {1, 3, 64}){
+        GraphSnapshotSequence sequence(keyframePeriod);
+        for (const auto& graph: graphs)
+            sequence.push(graph);
+        ASSERT_EQ(sequence.size(), graphs.size());
+        auto decodedGraphs = sequence.getGraphs();
+        for (size_t i = 0; i < graphs.size(); ++i){
+            EXPECT_EQ(decodedGraphs[i], graphs[i]);
+            EXPECT_EQ(sequence.getGraph(i), graphs[i]);
+        }
+    }
+}
+
+TEST_F(TestGraphSnapshot, getByteCount_forSlowlyChangingGraphs_diffsAreSmallerThanKeyframes){
+    GraphSnapshotSequence keyframes(1), diffs(64);
+    MultiGraph graph = graphs[0];
+    for (size_t i = 0; i < 10; ++i){
+        graph.addEdgeIdx(i, (i + 1) % 10);
+        keyframes.push(graph);
+        diffs.push(graph);
+    }
+    EXPECT_LT(diffs.getByteCount(), keyframes.getByteCount());
+    EXPECT_EQ(diffs.getGraph(9), graph);
+}
+
+TEST_F(TestGraphSnapshot, push_graphOfDifferentSize_throwLogicError){
+    GraphSnapshotSequence sequence;
+    sequence.push(graphs[0]);
+    EXPECT_THROW(sequence.push(MultiGraph(3)), std::logic_error);
+}
+
+}
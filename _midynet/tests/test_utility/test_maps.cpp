@@ -174,4 +174,48 @@ TEST(VectorOfMaps, erase_forSomeKey_noMemoryLoss){
     EXPECT_EQ(maps.size(), 8);
 }
 
+TEST(FlatIntMapClass, increment_forPairKeys_returnSameValuesAsIntMap){
+    FlatIntMap<std::pair<size_t, size_t>> flatMap(2);
+    IntMap<std::pair<size_t, size_t>> map;
+    for (size_t i = 0; i < 100; ++i){
+        std::pair<size_t, size_t> key = {i % 13, i % 7};
+        flatMap.increment(key, i);
+        map.increment(key, i);
+    }
+    EXPECT_EQ(flatMap.size(), map.size());
+    for (const auto& entry : flatMap)
+        EXPECT_EQ(entry.second, map[entry.first]);
+}
+
+TEST(FlatIntMapClass, clear_forNonEmptyMap_mapIsReusable){
+    FlatIntMap<size_t> map;
+    map.increment(3, 2);
+    map.decrement(5);
+    map.clear();
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.isEmpty(3));
+    EXPECT_EQ(map.get(5), 0);
+    map.increment(5);
+    EXPECT_EQ(map[5], 1);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(FlatIntMapClass, erase_forManyKeys_keepOtherKeysReachable){
+    FlatIntMap<size_t> map(2);
+    for (size_t i = 0; i < 200; ++i)
+        map.set(i, i + 1);
+    for (size_t i = 0; i < 200; i += 3)
+        map.erase(i);
+    map.erase(1000);
+    for (size_t i = 0; i < 200; ++i){
+        EXPECT_EQ(map.isEmpty(i), i % 3 == 0);
+        EXPECT_EQ(map.get(i), (i % 3 == 0) ? 0 : i + 1);
+    }
+    EXPECT_EQ(map.size(), 133);
+    map.clear();
+    EXPECT_EQ(map.size(), 0);
+    for (size_t i = 0; i < 200; ++i)
+        EXPECT_TRUE(map.isEmpty(i));
+}
+
 }
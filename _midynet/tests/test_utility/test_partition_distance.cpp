@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/partition_distance.h"
+
+
+namespace FastMIDyNet{
+
+TEST(TestContingencyTable, constructor_forSparseLabels_countVerticesOfEachBlockPair){
+    ContingencyTable table({5, 5, 2, 2}, {0, 1, 1, 1});
+    EXPECT_EQ(table.getRowCount(), 2);
+    EXPECT_EQ(table.getColumnCount(), 2);
+    EXPECT_EQ(table.getRowLabels(), std::vector<BlockIndex>({5, 2}));
+    EXPECT_EQ(table.get(0, 0), 1);
+    EXPECT_EQ(table.get(0, 1), 1);
+    EXPECT_EQ(table.get(1, 1), 2);
+    EXPECT_EQ(table.getColumnSums(), std::vector<size_t>({1, 3}));
+}
+
+TEST(TestContingencyTable, constructor_forDifferentSizes_throwLogicError){
+    EXPECT_THROW(ContingencyTable({0, 1}, {0}), std::logic_error);
+}
+
+TEST(TestPartitionDistance, getNormalizedMutualInformation_forPermutedLabels_returnOne){
+    EXPECT_DOUBLE_EQ(getNormalizedMutualInformation({0, 0, 1, 1, 2}, {2, 2, 0, 0, 1}), 1);
+    EXPECT_NEAR(getVariationOfInformation({0, 0, 1, 1, 2}, {2, 2, 0, 0, 1}), 0, 1e-12);
+    EXPECT_DOUBLE_EQ(getNormalizedMutualInformation({0, 0, 0}, {1, 1, 1}), 1);
+}
+
+TEST(TestPartitionDistance, getVariationOfInformation_forIndependentPartitions_returnSumOfEntropies){
+    BlockSequence partition1 = {0, 0, 1, 1}, partition2 = {0, 1, 0, 1};
+    EXPECT_NEAR(getMutualInformation(partition1, partition2), 0, 1e-12);
+    EXPECT_DOUBLE_EQ(getPartitionEntropy(partition1), log(2));
+    EXPECT_DOUBLE_EQ(getVariationOfInformation(partition1, partition2), 2 * log(2));
+    EXPECT_NEAR(getNormalizedMutualInformation(partition1, partition2), 0, 1e-12);
+}
+
+TEST(TestPartitionDistance, getMaximumWeightMatching_forSquareMatrix_returnOptimalMatching){
+    std::vector<std::vector<double>> weights = {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}};
+    EXPECT_EQ(getMaximumWeightMatching(weights, 3), std::vector<size_t>({0, 2, 1}));
+}
+
+TEST(TestPartitionDistance, getMaximumWeightMatching_forMoreRowsThanColumns_leaveRowsUnmatched){
+    std::vector<std::vector<double>> weights = {{1}, {5}, {2}};
+    EXPECT_EQ(getMaximumWeightMatching(weights, 1), std::vector<size_t>({1, 0, 1}));
+}
+
+TEST(TestPartitionDistance, alignPartition_forPermutedLabels_returnReference){
+    BlockSequence reference = {0, 0, 1, 1, 3, 3};
+    EXPECT_EQ(alignPartition({2, 2, 0, 0, 1, 1}, reference), reference);
+    EXPECT_EQ(alignPartition({2, 2, 0, 1, 1, 1}, reference), BlockSequence({0, 0, 1, 3, 3, 3}));
+}
+
+TEST(TestPartitionDistance, alignPartition_forMoreBlocksThanReference_labelUnmatchedBlocksAbove){
+    EXPECT_EQ(alignPartition({0, 1, 2, 2}, {0, 0, 1, 1}), BlockSequence({0, 2, 1, 1}));
+    EXPECT_DOUBLE_EQ(getAlignedAccuracy({0, 1, 2, 2}, {0, 0, 1, 1}), 0.75);
+}
+
+TEST(TestPartitionDistance, getPartitionDistanceMatrix_forSeveralThreads_returnSymmetricPairwiseDistances){
+    std::vector<BlockSequence> partitions = {{0, 0, 1, 1}, {1, 1, 0, 0}, {0, 1, 0, 1}, {0, 0, 0, 1}, {0, 1, 2, 3}};
+    auto distances = getPartitionDistanceMatrix(partitions, "vi", 3);
+    ASSERT_EQ(distances.size(), partitions.size());
+    for (size_t i = 0; i < partitions.size(); ++i){
+        EXPECT_EQ(distances[i][i], 0);
+        for (size_t j = 0; j < partitions.size(); ++j){
+            EXPECT_EQ(distances[i][j], distances[j][i]);
+            if (i != j){
+                EXPECT_DOUBLE_EQ(distances[i][j], getVariationOfInformation(partitions[i], partitions[j]));
+            }
+        }
+    }
+    auto accuracyDistances = getPartitionDistanceMatrix(partitions, "accuracy", 1);
+    EXPECT_DOUBLE_EQ(accuracyDistances[0][2], 0.5);
+}
+
+TEST(TestPartitionDistance, getPartitionDistanceMatrix_forUnknownMetric_throwLogicError){
+    EXPECT_THROW(getPartitionDistanceMatrix({{0}}, "rand"), std::logic_error);
+}
+
+}
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/partition_summary.h"
+#include "FastMIDyNet/rng.h"
+
+
+namespace FastMIDyNet{
+
+TEST(TestCompressedPartition, getCanonicalPartition_forPermutedLabels_returnSamePartition){
+    EXPECT_EQ(CompressedPartition::getCanonicalPartition({3, 3, 0, 5, 0}), BlockSequence({0, 0, 1, 2, 1}));
+    EXPECT_EQ(CompressedPartition::getCanonicalPartition({1, 1, 2, 0, 2}), BlockSequence({0, 0, 1, 2, 1}));
+}
+
+TEST(TestCompressedPartition, getPartition_forManyLabels_returnCanonicalPartition){
+    BlockSequence partition;
+    for (size_t i = 0; i < 200; ++i)
+        partition.push_back((i * 7) % 37);
+    CompressedPartition compressed(partition);
+    EXPECT_EQ(compressed.getPartition(), CompressedPartition::getCanonicalPartition(partition));
+    EXPECT_EQ(compressed.getByteCount(), 8 * ((200 * 6 + 63) / 64));
+}
+
+TEST(TestPartitionSummarizer, update_forPermutedPartitions_alignLabels){
+    PartitionSummarizer summarizer(0);
+    summarizer.update({0, 0, 1, 1, 2});
+    summarizer.update({2, 2, 0, 0, 1});
+    summarizer.update({1, 1, 0, 0, 0});
+    EXPECT_EQ(summarizer.getCount(), 3);
+    EXPECT_EQ(summarizer.getAlignedBlockCount(), 3);
+    EXPECT_EQ(summarizer.getConsensus(), BlockSequence({0, 0, 1, 1, 2}));
+    EXPECT_EQ(summarizer.getLabelCount(0, 0), 3);
+    EXPECT_EQ(summarizer.getLabelCount(4, 1), 1);
+    EXPECT_EQ(summarizer.getBlockCountHistogram(), std::vector<size_t>({0, 0, 1, 2}));
+    EXPECT_DOUBLE_EQ(summarizer.getMarginalEntropy(), -(1. / 3 * log(1. / 3) + 2. / 3 * log(2. / 3)));
+}
+
+TEST(TestPartitionSummarizer, update_forUniformPartition_zeroEntropy){
+    PartitionSummarizer summarizer(0);
+    summarizer.update({4, 4, 4});
+    summarizer.update({1, 1, 1});
+    EXPECT_DOUBLE_EQ(summarizer.getMeanPartitionEntropy(), 0);
+    EXPECT_DOUBLE_EQ(summarizer.getMarginalEntropy(), 0);
+    summarizer.update({0, 1, 1});
+    EXPECT_DOUBLE_EQ(summarizer.getMeanPartitionEntropy(), -(1. / 3 * log(1. / 3) + 2. / 3 * log(2. / 3)) / 3);
+}
+
+TEST(TestPartitionSummarizer, getCoassignmentProbs_forSampledPairs_returnFractionInSameBlock){
+    seed(1);
+    PartitionSummarizer summarizer(20);
+    summarizer.update({0, 0, 1, 1});
+    summarizer.update({0, 1, 1, 1});
+    const auto probs = summarizer.getCoassignmentProbs();
+    ASSERT_EQ(summarizer.getPairs().size(), 20);
+    for (size_t i = 0; i < probs.size(); ++i){
+        auto pair = summarizer.getPairs()[i];
+        EXPECT_LT(pair.first, pair.second);
+        double expected = 0;
+        expected += (pair == std::make_pair<size_t, size_t>(0, 1)) or (pair == std::make_pair<size_t, size_t>(2, 3));
+        expected += (pair.first != 0);
+        EXPECT_DOUBLE_EQ(probs[i], expected / 2);
+    }
+}
+
+TEST(TestPartitionSummarizer, update_forManyPartitions_keepReservoirAtCapacity){
+    seed(2);
+    PartitionSummarizer summarizer(0, 5);
+    for (size_t i = 0; i < 100; ++i)
+        summarizer.update({i % 2, 0, 1});
+    const auto reservoir = summarizer.getReservoir();
+    EXPECT_EQ(reservoir.size(), 5);
+    for (const auto& partition: reservoir)
+        EXPECT_TRUE(partition == BlockSequence({0, 0, 1}) or partition == BlockSequence({0, 1, 0}));
+    EXPECT_EQ(summarizer.getReservoirByteCount(), 5 * 8);
+}
+
+TEST(TestPartitionSummarizer, update_forDifferentSize_throwLogicError){
+    PartitionSummarizer summarizer;
+    summarizer.update({0, 1});
+    EXPECT_THROW(summarizer.update({0, 1, 2}), std::logic_error);
+    summarizer.clear();
+    summarizer.update({0, 1, 2});
+    EXPECT_EQ(summarizer.getSize(), 3);
+}
+
+}
@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+#include <stdexcept>
+
+#include "FastMIDyNet/utility/ring_buffer.hpp"
+
+
+namespace FastMIDyNet{
+
+TEST(TestRingBuffer, push_belowCapacity_keepAllValuesInOrder){
+    RingBuffer<int> buffer(5);
+    for (int i = 0; i < 3; ++i)
+        buffer.push(i);
+    EXPECT_EQ(buffer.size(), 3);
+    EXPECT_FALSE(buffer.isFull());
+    EXPECT_EQ(buffer.getData(), std::vector<int>({0, 1, 2}));
+}
+
+TEST(TestRingBuffer, push_aboveCapacity_keepLastValuesInOrder){
+    RingBuffer<int> buffer(3);
+    for (int i = 0; i < 7; ++i)
+        buffer.push(i);
+    EXPECT_TRUE(buffer.isFull());
+    EXPECT_EQ(buffer.getPushCount(), 7);
+    EXPECT_EQ(buffer.getData(), std::vector<int>({4, 5, 6}));
+    EXPECT_EQ(buffer[0], 4);
+    EXPECT_EQ(buffer.back(), 6);
+}
+
+TEST(TestRingBuffer, clear_forFullBuffer_emptyBuffer){
+    RingBuffer<int> buffer(2);
+    for (int i = 0; i < 3; ++i)
+        buffer.push(i);
+    buffer.clear();
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(buffer.getPushCount(), 0);
+    buffer.push(8);
+    EXPECT_EQ(buffer.getData(), std::vector<int>({8}));
+}
+
+TEST(TestRingBuffer, constructor_forZeroCapacity_throwLogicError){
+    EXPECT_THROW(RingBuffer<int>(0), std::logic_error);
+}
+
+}
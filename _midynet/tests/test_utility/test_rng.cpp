@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+#include "FastMIDyNet/rng.h"
+
+
+namespace FastMIDyNet{
+
+static std::vector<size_t> getSeededSequence(size_t n){
+    seed(n);
+    std::vector<size_t> sequence;
+    for (size_t i = 0; i < 10; ++i)
+        sequence.push_back(rng());
+    return sequence;
+}
+
+TEST(TestRNG, seed_inOtherThreads_keepThreadStreamsIndependent) {
+    auto expectedSequence = getSeededSequence(42);
+    seed(1);
+    auto mainValue = rng();
+
+    seed(1);
+    std::vector<std::vector<size_t>> sequences(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < sequences.size(); ++i)
+        threads.push_back(std::thread([&, i](){ sequences[i] = getSeededSequence(42); }));
+    for (auto& thread: threads)
+        thread.join();
+
+    for (const auto& sequence: sequences)
+        EXPECT_EQ(sequence, expectedSequence);
+    EXPECT_EQ(getSeed(), 1);
+    EXPECT_EQ(rng(), mainValue);
+}
+
+}
@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "FastMIDyNet/utility/scheduler.h"
+
+
+namespace FastMIDyNet{
+
+TEST(TestTaskScheduler, run_forManyTasks_runEachTaskOnce){
+    TaskScheduler scheduler(4);
+    std::vector<std::atomic<size_t>> counts(103);
+    for (auto& count : counts)
+        count = 0;
+    size_t endedTaskCount = 0;
+    scheduler.run(counts.size(), [&](size_t task){ ++counts[task]; }, [&](size_t task){ ++endedTaskCount; });
+    for (const auto& count : counts)
+        EXPECT_EQ(count, 1);
+    EXPECT_EQ(endedTaskCount, counts.size());
+}
+
+TEST(TestTaskScheduler, run_forSingleThread_runTasksInOrder){
+    TaskScheduler scheduler(1);
+    std::vector<size_t> order;
+    scheduler.run(5, [&](size_t task){ order.push_back(task); });
+    EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST(TestTaskScheduler, run_forUnbalancedTasks_stealTasksFromBusyThread){
+    TaskScheduler scheduler(2);
+    /* the first task blocks its thread, which leaves the rest of its block to be stolen */
+    scheduler.run(10, [&](size_t task){
+        if (task == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    EXPECT_GT(scheduler.getStolenTaskCount(), 0);
+}
+
+TEST(TestTaskScheduler, run_forThrowingTask_rethrowException){
+    TaskScheduler scheduler(3);
+    EXPECT_THROW(
+        scheduler.run(20, [&](size_t task){ if (task == 7) throw std::logic_error("task failed"); }),
+        std::logic_error
+    );
+    size_t taskCount = 0;
+    scheduler.run(4, [&](size_t task){ }, [&](size_t task){ ++taskCount; });
+    EXPECT_EQ(taskCount, 4);
+}
+
+}
@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include <vector>
+
+#include "FastMIDyNet/utility/shared_buffer.hpp"
+
+
+namespace FastMIDyNet{
+
+TEST(TestSharedBuffer, push_withoutView_modifyInPlace){
+    SharedBuffer<int> buffer;
+    buffer.push(0);
+    const int* data = buffer.getData().data();
+    buffer.clear();
+    buffer.push(1);
+    EXPECT_EQ(buffer.getData().data(), data);
+    EXPECT_EQ(buffer.getData(), std::vector<int>({1}));
+}
+
+TEST(TestSharedBuffer, push_whileShared_leaveViewUnchanged){
+    SharedBuffer<int> buffer;
+    buffer.push(0);
+    auto view = buffer.share();
+    buffer.push(1);
+    EXPECT_EQ(*view, std::vector<int>({0}));
+    EXPECT_EQ(buffer.getData(), std::vector<int>({0, 1}));
+}
+
+TEST(TestSharedBuffer, clear_whileShared_leaveViewUnchanged){
+    SharedBuffer<int> buffer;
+    buffer.push(0);
+    auto view = buffer.share();
+    buffer.clear();
+    EXPECT_EQ(*view, std::vector<int>({0}));
+    EXPECT_EQ(buffer.size(), 0);
+}
+
+}
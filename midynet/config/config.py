@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 import copy
+import hashlib
 import itertools
 import pathlib
 import pickle
@@ -157,6 +158,24 @@ class Config:
             message = "unhashable type, must not be sequenced."
             raise TypeError(message)
 
+    def digest(self) -> str:
+        """
+        Hexadecimal digest of the non-unique parameters of `self`. Unlike
+        `hash(self)`, which depends on the salt of string hashes of the
+        interpreter, it is the same from one session to the next, so that it can
+        identify results saved on disk.
+        """
+        if self.is_sequenced():
+            message = "cannot digest, must not be sequenced."
+            raise TypeError(message)
+        params = []
+        for k, v in self.dict_copy().items():
+            if v.is_config or v.is_unique():
+                continue
+            value = v.value.item() if hasattr(v.value, "item") else v.value
+            params.append((k, repr(value)))
+        return hashlib.sha1(repr(sorted(params)).encode()).hexdigest()
+
     @classmethod
     def auto(
         cls, config_type: Any, *others: Any, **kwargs: Any
@@ -35,6 +35,7 @@ class ExperimentConfig(Config):
         path: Union[str, pathlib.Path] = ".",
         num_procs: int = 1,
         num_async_process: int = 1,
+        use_scheduler: bool = False,
         seed: Optional[int] = None,
         dynamics_params=None,
         graph_params=None,
@@ -66,6 +67,12 @@ class ExperimentConfig(Config):
             force_non_sequence=True,
             unique=True,
         )
+        obj.insert(
+            "use_scheduler",
+            use_scheduler,
+            force_non_sequence=True,
+            unique=True,
+        )
         obj.insert(
             "seed",
             seed or int(time.time()),
@@ -84,6 +91,7 @@ class ExperimentConfig(Config):
         path: Union[str, pathlib.Path] = ".",
         num_procs: int = 1,
         num_async_process: int = 1,
+        use_scheduler: bool = False,
         seed: Optional[int] = None,
         graph_params=None,
     ) -> ExperimentConfig:
@@ -112,6 +120,12 @@ class ExperimentConfig(Config):
             force_non_sequence=True,
             unique=True,
         )
+        obj.insert(
+            "use_scheduler",
+            use_scheduler,
+            force_non_sequence=True,
+            unique=True,
+        )
         obj.insert(
             "seed",
             seed or int(time.time()),
@@ -23,6 +23,10 @@ class MCMCFactory(Factory):
         graph = RandomGraphFactory.build(config.graph)
         edge_proposer = EdgeProposerFactory.build(config.graph.edge_proposer)
         if not config.graph.labeled:
+            if config.graph.edge_proposer.name == "labeled":
+                raise ValueError(
+                    "The `labeled` edge proposer requires a labeled graph prior."
+                )
             dynamics = DynamicsFactory.build(config.dynamics)
             dynamics.set_graph_prior(graph.wrap)
             mcmc = GraphReconstructionMCMC(dynamics, edge_proposer)
@@ -18,6 +18,10 @@ class EdgeProposerConfig(Config):
     def single_uniform(cls):
         return cls(name="single_uniform", allow_self_loops=True, allow_multiedges=True)
 
+    @classmethod
+    def single_simple(cls):
+        return cls(name="single_simple", allow_self_loops=False, allow_multiedges=False)
+
     @classmethod
     def single_degree(cls):
         return cls(
@@ -48,6 +52,25 @@ class EdgeProposerConfig(Config):
     def double_swap(cls):
         return cls(name="double_swap", allow_self_loops=True, allow_multiedges=True)
 
+    @classmethod
+    def informed(cls):
+        return cls(
+            name="informed",
+            allow_self_loops=True,
+            allow_multiedges=True,
+            candidate_count=10,
+            uniform_prob=0.1,
+        )
+
+    @classmethod
+    def labeled(cls):
+        return cls(
+            name="labeled",
+            allow_self_loops=True,
+            allow_multiedges=True,
+            label_pair_shift=1.0,
+        )
+
 
 class BlockProposerConfig(Config):
     @classmethod
@@ -84,6 +107,16 @@ class EdgeProposerFactory(Factory):
             allow_multiedges=config.allow_multiedges,
         )
 
+    @staticmethod
+    def build_single_simple(
+        config: EdgeProposerConfig,
+    ) -> proposer.edge.SingleEdgeSimpleProposer:
+        if config.allow_multiedges:
+            raise ValueError("`single_simple` proposer does not allow multiedges.")
+        return proposer.edge.SingleEdgeSimpleProposer(
+            allow_self_loops=config.allow_self_loops,
+        )
+
     @staticmethod
     def build_single_degree(
         config: EdgeProposerConfig,
@@ -122,6 +155,27 @@ class EdgeProposerFactory(Factory):
             allow_multiedges=config.allow_multiedges,
         )
 
+    @staticmethod
+    def build_informed(
+        config: EdgeProposerConfig,
+    ) -> proposer.edge.InformedEdgeProposer:
+        return proposer.edge.InformedEdgeProposer(
+            allow_self_loops=config.allow_self_loops,
+            allow_multiedges=config.allow_multiedges,
+            candidate_count=config.candidate_count,
+            uniform_prob=config.uniform_prob,
+        )
+
+    @staticmethod
+    def build_labeled(
+        config: EdgeProposerConfig,
+    ) -> proposer.edge.LabeledSingleEdgeProposer:
+        return proposer.edge.LabeledSingleEdgeProposer(
+            allow_self_loops=config.allow_self_loops,
+            allow_multiedges=config.allow_multiedges,
+            label_pair_shift=config.label_pair_shift,
+        )
+
 
 class BlockProposerFactory(Factory):
     @staticmethod
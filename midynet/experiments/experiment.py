@@ -8,7 +8,7 @@ import typing
 from dataclasses import dataclass, field
 from _midynet import utility
 from midynet.config import Config, MetricsFactory
-from midynet.metrics import Metrics
+from midynet.metrics import Metrics, MetricsStore
 from midynet.util import (
     LoggerDict,
     Verbose,
@@ -112,6 +112,7 @@ class Experiment:
         self.metrics = MetricsFactory.build(self.config)
         for k in self.config.metrics.metrics_names:
             self.loggers.on_task_update("metrics")
+            self.metrics[k].store = MetricsStore(self.path / f"{k}.store")
             self.metrics[k].compute(verbose=self.verbose)
             if save:
                 self.metrics[k].save(pathlib.Path(self.path) / f"{k}.pickle")
@@ -126,10 +127,18 @@ class Experiment:
         self.metrics = MetricsFactory.build(self.config)
         for k in self.config.metrics.metrics_names:
             self.metrics[k].load(pathlib.Path(self.path) / f"{k}.pickle")
+            self.metrics[k].store = MetricsStore(self.path / f"{k}.store")
         self.loggers.load(self.path / self.log_filename)
 
-    def clean(self):
+    def clean(self, keep_stores=True):
+        """
+        Deletes the content of `path`. The metrics stores are kept unless
+        `keep_stores` is False, so that a new run only computes the samples that
+        they do not contain.
+        """
         for p in self.path.iterdir():
+            if keep_stores and p.suffix == ".store":
+                continue
             delete_path(p)
 
     @classmethod
@@ -1,6 +1,7 @@
 from .metrics import Metrics
 from .multiprocess import MultiProcess, Expectation
 from .statistics import Statistics
+from .store import MetricsStore
 from .dynamics_entropy import DynamicsEntropyMetrics
 from .dynamics_prediction_entropy import DynamicsPredictionEntropyMetrics
 from .graph_entropy import GraphEntropyMetrics
@@ -14,6 +15,7 @@ __all__ = (
     "MultiProcess",
     "Expectation",
     "Statistics",
+    "MetricsStore",
     "DynamicsEntropyMetrics",
     "DynamicsPredictionEntropyMetrics",
     "GraphEntropyMetrics",
@@ -24,15 +24,18 @@ class DynamicsEntropy(Expectation):
 
 
 class DynamicsEntropyMetrics(Metrics):
-    def eval(self, config: Config):
-        dynamics_entropy = DynamicsEntropy(
+    def get_expectation(self, config: Config):
+        return DynamicsEntropy(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
-        samples = dynamics_entropy.compute(
-            config.metrics.dynamics_entropy.get_value("num_samples", 10)
-        )
+
+    def get_num_samples(self, config: Config):
+        return config.metrics.dynamics_entropy.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
             samples, error_type=config.metrics.dynamics_entropy.error_type
         )
@@ -22,20 +22,22 @@ class DynamicsPredictionEntropy(Expectation):
 
 
 class DynamicsPredictionEntropyMetrics(Metrics):
-    def eval(self, config: Config):
+    def get_expectation(self, config: Config):
         dynamics_entropy = DynamicsPredictionEntropy(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())) + self.counter,
         )
         self.counter += len(self.config)
-        samples = dynamics_entropy.compute(
-            config.metrics.dynamics_prediction_entropy.get_value("num_samples", 10)
-        )
+        return dynamics_entropy
+
+    def get_num_samples(self, config: Config):
+        return config.metrics.dynamics_prediction_entropy.get_value("num_samples", 10)
 
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
-            samples,
-            error_type=config.metrics.dynamics_prediction_entropy.error_type,
+            samples, error_type=config.metrics.dynamics_prediction_entropy.error_type
         )
 
 
@@ -23,16 +23,18 @@ class GraphEntropy(Expectation):
 
 
 class GraphEntropyMetrics(Metrics):
-    def eval(self, config: Config):
-        graph_entropy = GraphEntropy(
+    def get_expectation(self, config: Config):
+        return GraphEntropy(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
-        samples = graph_entropy.compute(
-            config.metrics.graph_entropy.get_value("num_samples", 10)
-        )
 
+    def get_num_samples(self, config: Config):
+        return config.metrics.graph_entropy.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
             samples, error_type=config.metrics.graph_entropy.error_type
         )
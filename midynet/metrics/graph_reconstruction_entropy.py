@@ -25,19 +25,20 @@ class GraphReconstructionEntropy(Expectation):
 
 
 class GraphReconstructionEntropyMetrics(Metrics):
-    def eval(self, config: Config):
-        reconstruction_entropy = GraphReconstructionEntropy(
+    def get_expectation(self, config: Config):
+        return GraphReconstructionEntropy(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
-        samples = reconstruction_entropy.compute(
-            config.metrics.graph_reconstruction_entropy.get_value("num_samples", 10)
-        )
 
+    def get_num_samples(self, config: Config):
+        return config.metrics.graph_reconstruction_entropy.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
-            samples,
-            error_type=config.metrics.graph_reconstruction_entropy.error_type,
+            samples, error_type=config.metrics.graph_reconstruction_entropy.error_type
         )
 
 
@@ -5,9 +5,11 @@ from collections import defaultdict
 from dataclasses import dataclass, field
 import numpy as np
 
+from _midynet.utility import TaskScheduler
 from midynet.config import Config
 from midynet.util import Verbose, to_batch
-from .multiprocess import NestablePool
+from .multiprocess import Expectation, NestablePool
+from .store import MetricsStore
 
 __all__ = ("Metrics",)
 
@@ -20,6 +22,7 @@ class Metrics:
     )
     counter: int = field(repr=False, default=0, init=False)
     raw_data: dict = field(repr=False, default_factory=dict)
+    store: MetricsStore = field(repr=False, default_factory=MetricsStore)
 
     def set_up(self):
         self.counter = 0
@@ -28,9 +31,33 @@ class Metrics:
         self.counter = 0
 
     def eval(self, config: Config) -> typing.Dict[str, float]:
+        """
+        Summarizes the samples of `config`. Only the seeds that are not found in
+        the store are computed, and their samples are added to the store.
+        """
+        expectation = self.get_expectation(config)
+        digest = config.digest()
+        seeds = expectation.get_seeds(self.get_num_samples(config))
+        missing = [s for s in seeds if not self.store.has(digest, s)]
+        for s, sample in zip(missing, expectation.compute_seeds(missing)):
+            self.store.add(digest, s, sample)
+        return self.summarize(config, [self.store.get(digest, s) for s in seeds])
+
+    def get_expectation(self, config: Config) -> Expectation:
+        raise NotImplementedError()
+
+    def get_num_samples(self, config: Config) -> int:
         raise NotImplementedError()
 
+    def summarize(self, config: Config, samples: list) -> typing.Dict[str, float]:
+        raise NotImplementedError()
+
+    def on_config_end(self, config: Config, value: typing.Dict[str, float]):
+        pass
+
     def compute(self, verbose=Verbose()) -> None:
+        if self.config.get_value("use_scheduler", False):
+            return self.compute_with_scheduler(verbose)
         self.set_up()
         pb = verbose.init_progress(
             self.__class__.__name__, total=len(self.config)
@@ -44,9 +71,11 @@ class Metrics:
             vals = pool.map(self.eval, batch)
             pool.close()
             pool.join()
+            self.store.load()
             for val, c in zip(vals, batch):
                 for k, v in val.items():
                     raw_data[c.name][k].append(v)
+                self.on_config_end(c, val)
                 if pb is not None:
                     pb.update()
                 verbose.update_progress()
@@ -55,6 +84,77 @@ class Metrics:
         self.data = self.format(raw_data)
         self.tear_down()
 
+    def compute_with_scheduler(self, verbose=Verbose()) -> None:
+        """
+        Runs every (config, seed) pair of the sequence as one flat list of tasks on a
+        single pool of threads, instead of a pool of processes per batch of configs
+        and per config. The configs are built once and shared by the threads, which
+        run in parallel in the C++ calls since these release the GIL. The samples
+        found in the store are not recomputed, and each new sample is added to the
+        store as soon as it is done.
+        """
+        self.set_up()
+        pb = verbose.init_progress(
+            self.__class__.__name__, total=len(self.config)
+        )
+        configs = list(self.config.sequence())
+        expectations = [self.get_expectation(c) for c in configs]
+        digests = [c.digest() for c in configs]
+        seeds = [
+            e.get_seeds(self.get_num_samples(c))
+            for c, e in zip(configs, expectations)
+        ]
+        tasks = [
+            (i, s)
+            for i, d in enumerate(digests)
+            for s in seeds[i]
+            if not self.store.has(d, s)
+        ]
+        remaining = [0] * len(configs)
+        for i, _ in tasks:
+            remaining[i] += 1
+        vals = [None] * len(configs)
+
+        def end_config(i):
+            vals[i] = self.summarize(
+                configs[i], [self.store.get(digests[i], s) for s in seeds[i]]
+            )
+            self.on_config_end(configs[i], vals[i])
+            if pb is not None:
+                pb.update()
+            verbose.update_progress()
+
+        samples = {}
+
+        def run_task(index):
+            i, seed = tasks[index]
+            samples[index] = expectations[i].func(seed)
+
+        def on_task_end(index):
+            i, seed = tasks[index]
+            self.store.add(digests[i], seed, samples.pop(index))
+            remaining[i] -= 1
+            if remaining[i] == 0:
+                end_config(i)
+
+        for i in range(len(configs)):
+            if remaining[i] == 0:
+                end_config(i)
+
+        scheduler = TaskScheduler(
+            self.config.get_value("num_procs", 1)
+            * self.config.get_value("num_async_process", 1)
+        )
+        scheduler.run(len(tasks), run_task, on_task_end)
+        verbose.end_progress()
+
+        raw_data = defaultdict(lambda: defaultdict(list))
+        for val, c in zip(vals, configs):
+            for k, v in val.items():
+                raw_data[c.name][k].append(v)
+        self.data = self.format(raw_data)
+        self.tear_down()
+
     def format(self, data: dict) -> np.array:
         formatted_data = {}
         for name, data_in_name in data.items():
@@ -111,6 +211,7 @@ class Metrics:
                 + f"is different from {self.__class__}."
             )
             raise TypeError(message)
+        self.store.merge_with(other.store)
         self_flat = self.flatten(self.data)
         other_flat = other.flatten(other.data)
 
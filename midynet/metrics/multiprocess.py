@@ -1,6 +1,7 @@
 import multiprocessing as mp
 import multiprocessing.pool
 import time
+from concurrent.futures import ThreadPoolExecutor
 from dataclasses import dataclass, field
 
 import numpy as np
@@ -28,16 +29,28 @@ class NestablePool(multiprocessing.pool.Pool):
         super(NestablePool, self).__init__(*args, **kwargs)
 
 
+def get_pool(num_procs: int, use_threads: bool = False):
+    """Pool of processes, or of threads sharing the memory of this process.
+
+    Threads run in parallel since the long-running C++ entry points release the
+    GIL, and each thread seeds its own random number generator.
+    """
+    if use_threads:
+        return ThreadPoolExecutor(num_procs)
+    return mp.Pool(num_procs)
+
+
 @dataclass
 class MultiProcess:
     num_procs: int = 1
+    use_threads: bool = False
 
     def func(self, inputs):
         raise NotImplementedError()
 
     def compute(self, inputs):
-        with mp.Pool(self.num_procs) as p:
-            out = p.map(self.func, inputs)
+        with get_pool(self.num_procs, self.use_threads) as p:
+            out = list(p.map(self.func, inputs))
         return out
 
 
@@ -48,11 +61,16 @@ class Expectation(MultiProcess):
     def func(self, seed: int) -> float:
         raise NotImplementedError()
 
+    def get_seeds(self, num_samples: int = 1) -> np.ndarray:
+        return self.seed + np.arange(num_samples)
+
     def compute(self, num_samples: int = 1) -> list[float]:
-        seeds = self.seed + np.arange(num_samples)
-        if self.num_procs > 1:
-            with mp.Pool(self.num_procs) as p:
-                out = p.map(self.func, seeds)
+        return self.compute_seeds(self.get_seeds(num_samples))
+
+    def compute_seeds(self, seeds) -> list[float]:
+        if self.num_procs > 1 and len(seeds) > 1:
+            with get_pool(self.num_procs, self.use_threads) as p:
+                out = list(p.map(self.func, seeds))
         else:
             out = [self.func(s) for s in seeds]
         return out
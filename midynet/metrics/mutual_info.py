@@ -8,7 +8,13 @@ from midynet.config import Config, MCMCFactory
 from .metrics import Metrics
 from .multiprocess import Expectation
 from .statistics import Statistics
-from .util import get_log_evidence, get_log_posterior, get_log_prior_meanfield
+from .util import (
+    get_log_evidence,
+    get_log_posterior,
+    get_log_prior_meanfield,
+    get_information_samples,
+    has_native_estimator,
+)
 
 __all__ = ("MutualInformation", "MutualInformationMetrics")
 
@@ -32,18 +38,28 @@ class MutualInformation(Expectation):
         out = {"hx": hx, "hg": hg, "hxg": hxg, "hgx": hgx, "mi": mi}
         return out
 
+    def compute_seeds(self, seeds) -> list[dict]:
+        if not has_native_estimator(self.config.metrics.mutualinfo):
+            return super().compute_seeds(seeds)
+        samples = get_information_samples(
+            self.config, self.config.metrics.mutualinfo, seeds, self.num_procs
+        )
+        return [{k: v / np.log(2) for k, v in s.items()} for s in samples]
+
 
 class MutualInformationMetrics(Metrics):
-    def eval(self, config: Config):
-        mutual_info = MutualInformation(
+    def get_expectation(self, config: Config):
+        return MutualInformation(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
 
-        samples = mutual_info.compute(
-            config.metrics.mutualinfo.get_value("num_samples", 10)
-        )
+    def get_num_samples(self, config: Config):
+        return config.metrics.mutualinfo.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         sample_dict = defaultdict(list)
         for s in samples:
             for k, v in s.items():
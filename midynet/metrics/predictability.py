@@ -5,7 +5,7 @@ from midynet.config import Config, MCMCFactory
 from .metrics import Metrics
 from .multiprocess import Expectation
 from .statistics import Statistics
-from .util import get_log_evidence
+from .util import get_log_evidence, get_information_samples, has_native_estimator
 
 __all__ = ("Predictability", "PredictabilityMetrics")
 
@@ -23,17 +23,28 @@ class Predictability(Expectation):
         hx = -get_log_evidence(mcmc, self.config.metrics.predictability)
         return (hx - hxg) / hx
 
+    def compute_seeds(self, seeds) -> list[float]:
+        if not has_native_estimator(self.config.metrics.predictability):
+            return super().compute_seeds(seeds)
+        samples = get_information_samples(
+            self.config, self.config.metrics.predictability, seeds, self.num_procs
+        )
+        return [s["mi"] / s["hx"] for s in samples]
+
 
 class PredictabilityMetrics(Metrics):
-    def eval(self, config: Config):
-        predictability = Predictability(
+    def get_expectation(self, config: Config):
+        return Predictability(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
-        samples = predictability.compute(
-            config.metrics.predictability.get_value("num_samples", 10)
-        )
+
+    def get_num_samples(self, config: Config):
+        return config.metrics.predictability.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
             samples, error_type=config.metrics.predictability.error_type
         )
@@ -5,7 +5,7 @@ from midynet.config import Config, MCMCFactory
 from .metrics import Metrics
 from .multiprocess import Expectation
 from .statistics import Statistics
-from .util import get_log_posterior
+from .util import get_log_posterior, get_information_samples, has_native_estimator
 
 __all__ = ("Reconstructability", "ReconstructabilityMetrics")
 
@@ -24,17 +24,28 @@ class Reconstructability(Expectation):
 
         return (hg - hgx) / hg
 
+    def compute_seeds(self, seeds) -> list[float]:
+        if not has_native_estimator(self.config.metrics.reconstructability):
+            return super().compute_seeds(seeds)
+        samples = get_information_samples(
+            self.config, self.config.metrics.reconstructability, seeds, self.num_procs
+        )
+        return [s["mi"] / s["hg"] for s in samples]
+
 
 class ReconstructabilityMetrics(Metrics):
-    def eval(self, config: Config):
-        reconstructability = Reconstructability(
+    def get_expectation(self, config: Config):
+        return Reconstructability(
             config=config,
             num_procs=config.get_value("num_procs", 1),
+            use_threads=config.get_value("use_threads", False),
             seed=config.get_value("seed", int(time.time())),
         )
-        samples = reconstructability.compute(
-            config.metrics.reconstructability.get_value("num_samples", 10)
-        )
+
+    def get_num_samples(self, config: Config):
+        return config.metrics.reconstructability.get_value("num_samples", 10)
+
+    def summarize(self, config: Config, samples: list):
         return Statistics.compute(
             samples, error_type=config.metrics.reconstructability.error_type
         )
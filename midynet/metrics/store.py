@@ -0,0 +1,117 @@
+import os
+import pathlib
+import pickle
+import struct
+import typing
+import zlib
+from dataclasses import dataclass, field
+
+__all__ = ("MetricsStore",)
+
+
+@dataclass
+class MetricsStore:
+    """
+    Cache of the samples computed for each (config, seed) task, keyed by the
+    digest of the config and the seed. When `path` is given, every new sample is
+    appended to the file as a separate record, so that the samples computed
+    before a crash, or for a smaller grid, are found when the store is loaded
+    again.
+
+    Each record is the pickled (key, sample) pair, preceded by its length and
+    its CRC-32. When loading, the bytes of a record that is truncated or
+    corrupted by a crash are skipped up to the next valid header, so that the
+    records appended after it are still read. The file is never rewritten, and
+    the store can thus be loaded while other processes append to it.
+    """
+
+    HEADER = struct.Struct("<QI")
+
+    path: typing.Optional[pathlib.Path] = None
+    records: typing.Dict[typing.Tuple[str, int], typing.Any] = field(
+        repr=False, default_factory=dict, init=False
+    )
+
+    def __post_init__(self):
+        if self.path is not None:
+            self.path = pathlib.Path(self.path)
+            self.load()
+
+    def __len__(self):
+        return len(self.records)
+
+    def __contains__(self, key):
+        return key in self.records
+
+    def has(self, digest: str, seed: int) -> bool:
+        return (digest, int(seed)) in self.records
+
+    def get(self, digest: str, seed: int):
+        return self.records[(digest, int(seed))]
+
+    def add(self, digest: str, seed: int, sample: typing.Any):
+        key = (digest, int(seed))
+        self.records[key] = sample
+        if self.path is None:
+            return
+        self.path.parent.mkdir(exist_ok=True, parents=True)
+        payload = pickle.dumps((key, sample))
+        record = memoryview(
+            self.HEADER.pack(len(payload), zlib.crc32(payload)) + payload
+        )
+        # The whole record is written by a single call on a file opened in
+        # append mode, so that the records of concurrent processes do not
+        # interleave. The rest of a short write, e.g. on a full disk, could be
+        # appended after the record of another process: the record is failed
+        # instead, and its partial bytes are skipped when loading.
+        fd = os.open(self.path, os.O_WRONLY | os.O_APPEND | os.O_CREAT, 0o644)
+        try:
+            written = os.write(fd, record)
+            if written != len(record):
+                raise OSError(
+                    f"short write of {written} bytes out of {len(record)} "
+                    f"for the record {key} in {self.path}."
+                )
+            os.fsync(fd)
+        finally:
+            os.close(fd)
+
+    def load(self):
+        if self.path is None or not self.path.exists():
+            return
+        content = self.path.read_bytes()
+        offset = 0
+        while offset + self.HEADER.size <= len(content):
+            record = self._read_record(content, offset)
+            if record is None:
+                offset += 1
+                continue
+            key, sample, offset = record
+            self.records[key] = sample
+
+    def _read_record(self, content: bytes, offset: int):
+        size, checksum = self.HEADER.unpack_from(content, offset)
+        start = offset + self.HEADER.size
+        end = start + size
+        if end > len(content):
+            return None
+        payload = content[start:end]
+        if zlib.crc32(payload) != checksum:
+            return None
+        try:
+            key, sample = pickle.loads(payload)
+        except Exception:
+            return None
+        if (
+            not isinstance(key, tuple)
+            or len(key) != 2
+            or not isinstance(key[0], str)
+            or not isinstance(key[1], int)
+        ):
+            return None
+        return key, sample, end
+
+    def merge_with(self, other):
+        for (digest, seed), sample in other.records.items():
+            if not self.has(digest, seed):
+                self.add(digest, seed, sample)
@@ -1,15 +1,35 @@
 import numpy as np
-from collections import defaultdict
-from _midynet.mcmc import GraphReconstructionMCMC
+from _midynet.mcmc import (
+    GraphReconstructionMCMC,
+    InformationEstimator,
+    BlockLabeledInformationEstimator,
+)
+from _midynet.dynamics import get_exact_evidence as _get_exact_evidence
 from _midynet.mcmc.callbacks import (
     CollectEdgeMultiplicityOnSweep,
     CollectLikelihoodOnSweep,
 )
-from _midynet.utility import get_weighted_edge_list
-from midynet.config import Config, MCMCVerboseFactory
-from midynet.util import enumerate_all_graphs, log_mean_exp, log_sum_exp
+from midynet.config import Config, MCMCFactory, MCMCVerboseFactory
+from midynet.util import log_mean_exp
+
+__all__ = ("get_log_evidence", "get_log_posterior", "get_information_samples")
 
-__all__ = ("get_log_evidence", "get_log_posterior")
+
+def do_initial_burn(mcmc: GraphReconstructionMCMC, config: Config):
+    """
+    Burns the chain for `config.initial_burn` steps. When the chain mixes graph and
+    label moves, their proportion is tuned during this burn-in and frozen after it,
+    unless `config.adapt_move_types` is False.
+    """
+    adapt = config.get_value("adapt_move_types", True) and hasattr(
+        mcmc, "start_move_type_adaptation"
+    )
+    if adapt:
+        mcmc.start_move_type_adaptation()
+    s, f = mcmc.do_MH_sweep(burn=config.initial_burn)
+    if adapt:
+        mcmc.freeze_move_type_weights()
+    return s, f
 
 
 def get_log_evidence_arithmetic(
@@ -17,11 +37,13 @@ def get_log_evidence_arithmetic(
 ):
     logp = []
     g = mcmc.get_graph()
+    graph_prior = mcmc.get_graph_prior()
     for k in range(config.K):
-        logp_k = []
+        graphs = []
         for m in range(config.num_sweeps):
-            mcmc.get_dynamics().sample_graph()
-            logp_k.append(mcmc.get_log_likelihood())
+            graph_prior.sample()
+            graphs.append(graph_prior.get_graph())
+        logp_k = mcmc.get_dynamics().get_log_likelihoods(graphs)
         logp.append(log_mean_exp(logp_k))
     mcmc.set_graph(g)
 
@@ -41,7 +63,7 @@ def get_log_evidence_harmonic(
     g = mcmc.get_graph()
     mcmc.set_up()
     burn = config.burn_per_vertex * mcmc.get_dynamics().get_size()
-    s, f = mcmc.do_MH_sweep(burn=config.initial_burn)
+    s, f = do_initial_burn(mcmc, config)
     for i in range(config.num_sweeps):
         s, f = mcmc.do_MH_sweep(burn=burn)
 
@@ -94,7 +116,7 @@ def get_log_evidence_annealed(
         # else:
         #     mcmc.get_dynamics().sample_graph()
         #     mcmc.set_graph(mcmc.get_graph())
-        s, f = mcmc.do_MH_sweep(burn=config.initial_burn)
+        s, f = do_initial_burn(mcmc, config)
         for i in range(config.num_sweeps):
             mcmc.do_MH_sweep(burn=burn)
             mcmc.check_consistency()
@@ -110,27 +132,31 @@ def get_log_evidence_annealed(
     return sum(logp)
 
 
-def get_log_evidence_exact(mcmc: GraphReconstructionMCMC, config: Config, **kwargs):
-    logevidence = []
-    original_graph = mcmc.get_graph()
-    size = mcmc.get_dynamics().get_size()
+def get_exact_evidence(mcmc: GraphReconstructionMCMC, num_threads: int = 1):
+    """
+    Exact evidence of `mcmc`, whose graph enumeration is split between `num_threads`
+    replicas of the chain cloned in C++. A chain with a component that cannot be
+    cloned is enumerated on a single thread.
+    """
     edge_proposer = mcmc.get_edge_proposer()
-    graph = mcmc.get_graph_prior()
-    edge_count = graph.get_edge_count()
-    allow_self_loops = edge_proposer.allow_self_loops()
-    allow_multiedges = edge_proposer.allow_multiedges()
-
+    replicas = [mcmc]
+    try:
+        replicas += [mcmc.clone() for i in range(num_threads - 1)]
+    except RuntimeError:
+        pass
     mcmc.set_up()
-    counter = 0
-    for g in enumerate_all_graphs(size, edge_count, allow_self_loops, allow_multiedges):
-        counter += 1
-        if graph.is_compatible(g):
-            mcmc.set_graph(g)
-            logevidence.append(mcmc.get_log_joint())
+    exact_evidence = _get_exact_evidence(
+        [replica.get_dynamics() for replica in replicas],
+        edge_proposer.allow_self_loops(),
+        edge_proposer.allow_multiedges(),
+    )
     mcmc.tear_down()
+    return exact_evidence
 
-    mcmc.set_graph(original_graph)
-    return log_sum_exp(logevidence)
+
+def get_log_evidence_exact(mcmc: GraphReconstructionMCMC, config: Config, **kwargs):
+    num_threads = config.get_value("num_threads", 1)
+    return get_exact_evidence(mcmc, num_threads).log_evidence
 
 
 def get_log_evidence_exact_meanfield(
@@ -187,7 +213,7 @@ def get_log_posterior_meanfield(
     #     mcmc.get_dynamics().sample_graph()
     #     mcmc.set_up()
     burn = config.burn_per_vertex * mcmc.get_dynamics().get_size()
-    s, f = mcmc.do_MH_sweep(burn=config.initial_burn)
+    s, f = do_initial_burn(mcmc, config)
 
     for i in range(config.num_sweeps):
         _s, _f = mcmc.do_MH_sweep(burn=burn)
@@ -216,37 +242,12 @@ def get_log_posterior_exact_meanfield(
     mcmc: GraphReconstructionMCMC, config: Config, **kwargs
 ):
     original_graph = mcmc.get_graph()
-    size = mcmc.get_dynamics().get_size()
-    edge_proposer = mcmc.get_edge_proposer()
-    graph = mcmc.get_graph_prior()
-    edge_count = graph.get_edge_count()
-    allow_self_loops = edge_proposer.allow_self_loops()
-    allow_multiedges = edge_proposer.allow_multiedges()
-
-    mcmc.set_up()
-    i = 0
-    edge_weights = defaultdict(lambda: defaultdict(list))
-    edge_total = defaultdict(list)
-    evidence = get_log_evidence_exact(mcmc, config)
-    for g in enumerate_all_graphs(size, edge_count, allow_self_loops, allow_multiedges):
-        if graph.is_compatible(g):
-            i += 1
-            mcmc.get_dynamics().set_graph(g)
-            weight = mcmc.get_log_joint() - evidence
-            for e, w in get_weighted_edge_list(g).items():
-                edge_weights[e][w].append(weight)
-                edge_total[e].append(weight)
-    mcmc.tear_down()
-    mcmc.set_graph(original_graph)
     log_posterior = 0
-    for e, weights in edge_weights.items():
-        probs = np.zeros(len(weights) + 1)
-        probs[0] = 1 - np.exp(log_sum_exp(edge_total[e]))
-        for w, ww in weights.items():
-            probs[w] = np.exp(log_sum_exp(ww))
-        probs = np.array(probs)
+    num_threads = config.get_value("num_threads", 1)
+    exact_evidence = get_exact_evidence(mcmc, num_threads)
+    for e, log_marginals in exact_evidence.edge_log_marginals.items():
         w = original_graph.get_edge_multiplicity_idx(*e)
-        log_posterior += np.log(probs[w])
+        log_posterior += log_marginals[w] if w < len(log_marginals) else -np.inf
 
     return log_posterior
 
@@ -287,3 +288,48 @@ def get_log_prior_meanfield(
     mcmc.set_graph(original_graph)
     mcmc.remove_callback("edge")
     return hg
+
+
+NATIVE_METHODS = {"meanfield": "meanfield", "full-meanfield": "meanfield", "exact": "exact"}
+
+
+def has_native_estimator(config: Config) -> bool:
+    return config.get_value("native", True) and (
+        config.get_value("method", "meanfield") in NATIVE_METHODS
+    )
+
+
+def get_information_samples(
+    config: Config, metrics_config: Config, seeds, num_threads: int = 1
+):
+    """
+    Samples, in nats, of the entropies `hx`, `hg`, `hxg`, `hgx` and of the mutual
+    information `mi` for each seed, computed in C++ on `num_threads` threads, each
+    with its own model, without returning to Python between the samples. The model
+    is built once and cloned in C++ for each thread; a model with a component that
+    cannot be cloned is built once per thread instead.
+    """
+    if len(seeds) == 0:
+        return []
+    num_models = max(1, min(num_threads, len(seeds)))
+    estimator_type = (
+        BlockLabeledInformationEstimator
+        if config.graph.labeled
+        else InformationEstimator
+    )
+    kwargs = dict(
+        method=NATIVE_METHODS[metrics_config.get_value("method", "meanfield")],
+        num_sweeps=metrics_config.get_value("num_sweeps", 1000),
+        burn_per_vertex=metrics_config.get_value("burn_per_vertex", 5),
+        initial_burn=metrics_config.get_value("initial_burn", 2000),
+    )
+    model = MCMCFactory.build_reconstruction(config)
+    try:
+        estimator = estimator_type(model.wrap, num_models, **kwargs)
+    except RuntimeError:
+        models = [model] + [
+            MCMCFactory.build_reconstruction(config) for i in range(num_models - 1)
+        ]
+        estimator = estimator_type([m.wrap for m in models], **kwargs)
+    samples = estimator.compute(seeds=[int(s) for s in seeds])
+    return [{k: v[i] for k, v in samples.items()} for i in range(len(seeds))]
@@ -98,6 +98,12 @@ ext_modules = [
             "_midynet/src/utility/functions.cpp",
             "_midynet/src/utility/integer_partition.cpp",
             "_midynet/src/utility/polylog2_integral.cpp",
+            "_midynet/src/utility/graph_enumeration.cpp",
+            "_midynet/src/utility/graph_snapshot.cpp",
+            "_midynet/src/utility/scheduler.cpp",
+            "_midynet/src/utility/edge_marginals.cpp",
+            "_midynet/src/utility/partition_summary.cpp",
+            "_midynet/src/utility/partition_distance.cpp",
             "_midynet/src/prior/sbm/block_count.cpp",
             "_midynet/src/prior/sbm/block.cpp",
             "_midynet/src/prior/sbm/edge_count.cpp",
@@ -120,9 +126,11 @@ ext_modules = [
             "_midynet/src/proposer/edge/double_edge_swap.cpp",
             "_midynet/src/proposer/edge/hinge_flip.cpp",
             "_midynet/src/proposer/edge/single_edge.cpp",
+            "_midynet/src/proposer/edge/informed_edge.cpp",
             "_midynet/src/proposer/edge/labeled_edge_proposer.cpp",
             "_midynet/src/proposer/edge/labeled_double_edge_swap.cpp",
             "_midynet/src/proposer/edge/labeled_hinge_flip.cpp",
+            "_midynet/src/proposer/edge/labeled_single_edge.cpp",
             "_midynet/src/proposer/label/uniform.cpp",
             "_midynet/src/proposer/label/mixed.cpp",
             "_midynet/src/mcmc/mcmc.cpp",
@@ -179,11 +187,11 @@ class BuildExt(build_ext):
 
     c_opts = {
         "msvc": ["/EHsc"],
-        "unix": [],
+        "unix": ["-pthread"],
     }
     l_opts = {
         "msvc": [],
-        "unix": [],
+        "unix": ["-pthread"],
     }
 
     if sys.platform == "darwin":
@@ -202,6 +210,8 @@ class BuildExt(build_ext):
                 opts.append("-fvisibility=hidden")
         elif ct == "msvc":
             opts.append('/DVERSION_INFO=\\"%s\\"' % self.distribution.get_version())
+        if os.environ.get("PROPOSAL_STATS", "0") != "0":
+            opts.append("/DPROPOSAL_STATS" if ct == "msvc" else "-DPROPOSAL_STATS")
         for ext in self.extensions:
             ext.extra_compile_args = opts
             ext.extra_link_args = link_opts
@@ -162,6 +162,14 @@ def test_baseconfig_hash_dict(m_config):
             assert hash(c) in m_config.hash_dict()[c.name]
 
 
+def test_baseconfig_digest(m_config):
+    digests = [c.digest() for c in m_config.sequence()]
+    assert len(set(digests)) == len(digests)
+    assert digests == [c.digest() for c in m_config.deepcopy().sequence()]
+    with pytest.raises(TypeError):
+        m_config.digest()
+
+
 def test_baseconfig_merge_nonsequence_configs():
     c1 = Config(name="c1", x=1, y=4)
     c2 = Config(name="c2", x=2, y=4)
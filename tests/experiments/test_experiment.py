@@ -68,6 +68,7 @@ def test_compute_metrics(experiment):
     experiment.compute_metrics()
     for n in experiment.config.metrics.metrics_names:
         (experiment.path / f"{n}.pickle").unlink()
+        (experiment.path / f"{n}.store").unlink()
 
 
 def test_save(experiment):
@@ -22,6 +22,24 @@ class DummyMetrics(metrics.Metrics):
         return {"dummy": self.value}
 
 
+@dataclass
+class DummyExpectation(metrics.Expectation):
+    def func(self, seed):
+        return float(seed)
+
+
+@dataclass
+class DummyExpectationMetrics(metrics.Metrics):
+    def get_expectation(self, config):
+        return DummyExpectation(seed=1)
+
+    def get_num_samples(self, config):
+        return 3
+
+    def summarize(self, config, samples):
+        return {"mean": np.mean(samples)}
+
+
 @pytest.fixture
 def base_metrics():
     coupling = np.linspace(0, 10, 2)
@@ -81,6 +99,25 @@ def test_basemetrics_load(base_metrics):
     pathlib.Path("metrics.pickle").unlink()
 
 
+def test_basemetrics_compute_with_store(base_metrics):
+    path = pathlib.Path("metrics.store")
+    m = DummyExpectationMetrics(
+        config=base_metrics.config, store=metrics.MetricsStore(path)
+    )
+    m.compute()
+    assert len(m.store) == 3 * len(base_metrics.config)
+    size = path.stat().st_size
+
+    other = DummyExpectationMetrics(
+        config=base_metrics.config, store=metrics.MetricsStore(path)
+    )
+    other.compute()
+    assert path.stat().st_size == size
+    for name, data in other.data.items():
+        assert np.all(data["mean"] == 2)
+    path.unlink()
+
+
 metrics_dict = {
     "dynamics_entropy": metrics.DynamicsEntropyMetrics,
     "dynamics_prediction_entropy": metrics.DynamicsPredictionEntropyMetrics,
@@ -130,5 +167,15 @@ def test_eval(args):
         m.eval(c)
 
 
+def test_compute_with_scheduler(args):
+    config, metrics = args
+    config.insert("use_scheduler", True, force_non_sequence=True, unique=True)
+    m = metrics(config)
+    m.compute()
+    for name, data in m.data.items():
+        for key, value in data.items():
+            assert value.shape == (2,)
+
+
 if __name__ == "__main__":
     pass
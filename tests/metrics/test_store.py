@@ -0,0 +1,110 @@
+import os
+import pathlib
+
+import pytest
+
+from midynet.metrics import MetricsStore
+
+
+@pytest.fixture
+def path():
+    path = pathlib.Path("metrics.store")
+    yield path
+    if path.exists():
+        path.unlink()
+
+
+def test_add_without_path():
+    store = MetricsStore()
+    store.add("abc", 1, 0.5)
+    assert store.has("abc", 1)
+    assert not store.has("abc", 2)
+    assert store.get("abc", 1) == 0.5
+
+
+def test_load_after_add(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    store.add("abc", 2, {"mi": 1.0})
+    other = MetricsStore(path)
+    assert len(other) == 2
+    assert other.get("abc", 2) == {"mi": 1.0}
+
+
+def test_load_truncated_record(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    store.add("abc", 2, 0.25)
+    content = path.read_bytes()
+    path.write_bytes(content[:-3])
+    other = MetricsStore(path)
+    assert len(other) == 1
+    assert other.get("abc", 1) == 0.5
+
+
+def test_load_corrupted_record(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    store.add("abc", 2, 0.25)
+    content = bytearray(path.read_bytes())
+    content[-1] ^= 0xFF
+    path.write_bytes(bytes(content))
+    other = MetricsStore(path)
+    assert len(other) == 1
+    assert not other.has("abc", 2)
+
+
+def test_add_after_loading_truncated_record(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    store.add("abc", 2, 0.25)
+    content = path.read_bytes()
+    path.write_bytes(content[:-3])
+    other = MetricsStore(path)
+    other.add("abc", 3, 0.125)
+    reloaded = MetricsStore(path)
+    assert len(reloaded) == 2
+    assert reloaded.get("abc", 3) == 0.125
+    assert path.read_bytes().startswith(content[:-3])
+
+
+def test_load_corrupted_record_keep_records_after_it(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    first = path.stat().st_size
+    store.add("abc", 2, 0.25)
+    second = path.stat().st_size
+    store.add("abc", 3, 0.125)
+    content = bytearray(path.read_bytes())
+    content[(first + second) // 2] ^= 0xFF
+    path.write_bytes(bytes(content))
+    other = MetricsStore(path)
+    assert len(other) == 2
+    assert not other.has("abc", 2)
+    assert other.get("abc", 3) == 0.125
+    assert path.read_bytes() == bytes(content)
+
+
+def test_add_with_short_write_raise_error(path, monkeypatch):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    write = os.write
+    monkeypatch.setattr(os, "write", lambda fd, data: write(fd, data[:5]))
+    with pytest.raises(OSError):
+        store.add("abc", 2, 0.25)
+    monkeypatch.setattr(os, "write", write)
+    store.add("abc", 3, 0.125)
+    other = MetricsStore(path)
+    assert len(other) == 2
+    assert other.get("abc", 3) == 0.125
+
+
+def test_merge_with(path):
+    store = MetricsStore(path)
+    store.add("abc", 1, 0.5)
+    other = MetricsStore()
+    other.add("abc", 1, 1.0)
+    other.add("def", 1, 2.0)
+    store.merge_with(other)
+    assert store.get("abc", 1) == 0.5
+    assert MetricsStore(path).get("def", 1) == 2.0
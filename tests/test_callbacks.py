@@ -0,0 +1,37 @@
+import pytest
+from _midynet.mcmc.callbacks import Verbose, VerboseToConsole
+from midynet.config import ExperimentConfig, MCMCFactory
+
+
+class HookProbe(Verbose):
+    def __init__(self):
+        Verbose.__init__(self)
+        self.calls = []
+
+    def get_message(self):
+        return ""
+
+    def set_up(self, mcmc):
+        self.calls.append("set_up")
+
+    def on_begin(self):
+        self.calls.append("on_begin")
+
+
+@pytest.fixture
+def mcmc():
+    config = ExperimentConfig.reconstruction(name="test", dynamics="sis", graph="er")
+    config.dynamics.set_value("num_steps", 5)
+    config.graph.set_value("size", 4)
+    config.graph.edge_count.set_value("state", 2)
+    return MCMCFactory.build_reconstruction(config)
+
+
+def test_python_hooks_called_from_cpp(mcmc):
+    probe = HookProbe()
+    mcmc.insert_callback("probe", probe)
+    assert probe.calls == ["set_up"]
+
+    display = VerboseToConsole([probe])
+    display.on_begin()
+    assert probe.calls == ["set_up", "on_begin"]